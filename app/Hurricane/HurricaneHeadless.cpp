@@ -0,0 +1,155 @@
+#include "HurricaneConfig.hpp"
+#include <HurricaneConstants.hpp>
+#include <HurricaneGameplay.hpp>
+#include <Components/EntityComponent.hpp>
+#include <Events/EnemySpawnEvent.hpp>
+#include <Events/ShootEvent.hpp>
+#include <helsinki/Engine/HeadlessGame.hpp>
+#include <helsinki/System/Events/EventRecorder.hpp>
+#include <helsinki/System/Events/KeyEvents.hpp>
+#include <GLFW/glfw3.h>
+#include <optional>
+#include <string>
+#include <string_view>
+
+// Input for a player weaving from side to side and firing as fast as the
+// fire button allows.
+static hl::EventRecording scriptInput(uint64_t updates)
+{
+	constexpr uint64_t WeaveUpdates = 120;
+
+	hl::EventRecorder recorder;
+	for (uint64_t update = 0; update < updates; ++update)
+	{
+		recorder.BeginUpdate(update);
+
+		if (update % WeaveUpdates == 0)
+		{
+			const auto right = (update / WeaveUpdates) % 2 == 0;
+			recorder.Record(hl::KeyReleaseEvent(right ? GLFW_KEY_A : GLFW_KEY_D));
+			recorder.Record(hl::KeyPressEvent(right ? GLFW_KEY_D : GLFW_KEY_A));
+		}
+
+		if (update % 2 == 0)
+		{
+			recorder.Record(hl::KeyPressEvent(GLFW_KEY_SPACE));
+		}
+		else
+		{
+			recorder.Record(hl::KeyReleaseEvent(GLFW_KEY_SPACE));
+		}
+
+		recorder.EndFrame();
+	}
+
+	return recorder.GetRecording();
+}
+
+class HurricaneHeadless : public hl::HeadlessGame
+{
+protected:
+	int parseOption(std::string_view arg, const char* value) override
+	{
+		if (arg == "--bullet-hell")
+		{
+			_enemyCount = 200;
+			_projectileCount = 6000;
+			return 1;
+		}
+		if (value != nullptr && arg == "--enemies")
+		{
+			_enemyCount = std::stoull(value);
+			return 2;
+		}
+		if (value != nullptr && arg == "--projectiles")
+		{
+			_projectileCount = std::stoull(value);
+			return 2;
+		}
+		return 0;
+	}
+
+	std::string getOptionUsage() const override
+	{
+		return
+			"  --enemies <n>       enemies kept alive, topped up as they die or leave\n"
+			"  --projectiles <n>   player projectiles kept in flight the same way\n"
+			"  --bullet-hell       200 enemies and 6000 projectiles, several thousand\n"
+			"                      shots a second\n";
+	}
+
+	void initialise(const hl::HeadlessOptions& options) override
+	{
+		_resourceService.loadSpriteSheet(std::string(hur::HurricaneConfig::RootPath) + "/data/spritesheet/sheet.xml");
+
+		hur::HurricaneGameplay::addSystems(_scene, _eventBus, _inputManager, _resourceService);
+
+		_enemies.emplace(_scene.query<hur::EntityComponent>(hur::HurricaneTags::Enemy));
+		_projectiles.emplace(_scene.query<hur::EntityComponent>(hur::HurricaneTags::Projectile));
+
+		// The first half of the run warms the pools up, the second should not
+		// need to allocate anything new for entities.
+		_halfway = options.updates / 2;
+	}
+
+	hl::EventRecording scriptInput(uint64_t updates) override
+	{
+		return ::scriptInput(updates);
+	}
+
+	void update(uint64_t update, float /*delta*/) override
+	{
+		if (update == _halfway)
+		{
+			_warmUpStats = _scene.getAllocationStats();
+		}
+
+		// The player never runs out of lives.
+		auto player = _scene.getEntity("Player");
+		if (player == nullptr)
+		{
+			player = hur::HurricaneGameplay::spawnPlayer(_scene, _resourceService);
+		}
+
+		for (auto count = _enemies->size(); count < _enemyCount; ++count)
+		{
+			_eventBus.Publish(hur::EnemySpawnEvent());
+		}
+		for (auto count = _projectiles->size(); count < _projectileCount; ++count)
+		{
+			_eventBus.Publish(hur::ShootEvent(player->Id));
+		}
+	}
+
+	std::string getName() const override
+	{
+		return "Hurricane, " + std::to_string(_enemyCount) + " enemies, " + std::to_string(_projectileCount) + " projectiles";
+	}
+
+	void report(std::ostream& stream) const override
+	{
+		const auto endStats = _scene.getAllocationStats();
+		stream << _enemies->size() << " enemies and " << _projectiles->size() << " projectiles at the end" << std::endl;
+		stream << "Entity blocks: " << _warmUpStats.entities.blockAllocations << " at halfway, " << endStats.entities.blockAllocations
+			<< " at the end, chunk blocks: " << _warmUpStats.chunks.blockAllocations << " at halfway, " << endStats.chunks.blockAllocations
+			<< " at the end" << std::endl;
+		stream << "Prefab pools: " << endStats.prefabPools.spawns - _warmUpStats.prefabPools.spawns << " spawns in the second half, "
+			<< _warmUpStats.prefabPools.grows << " grows at halfway, " << endStats.prefabPools.grows << " at the end" << std::endl;
+	}
+
+private:
+	size_t _enemyCount{ 500 };
+	size_t _projectileCount{ 500 };
+	hur::ResourceService _resourceService;
+	std::optional<hl::Query<hur::EntityComponent>> _enemies;
+	std::optional<hl::Query<hur::EntityComponent>> _projectiles;
+	uint64_t _halfway{ 0 };
+	hl::SceneAllocationStats _warmUpStats;
+};
+
+int main(int argc, char** argv)
+{
+	// Runs Hurricane's systems without a window or a device, --help lists the options.
+	HurricaneHeadless game;
+	return game.run(argc, argv);
+}
@@ -2,6 +2,7 @@
 
 #include <string>
 #include <helsinki/Engine/ECS/Component.hpp>
+#include <helsinki/Engine/Physics/CollisionFilter.hpp>
 #include <helsinki/System/glm.hpp>
 
 namespace hur
@@ -22,6 +23,16 @@ namespace hur
         CollisionLayer layer{ CollisionLayer::None };
         CollisionLayer mask{ CollisionLayer::None };
 
+        hl::CollisionFilter getFilter() const
+        {
+            return hl::CollisionFilter{ .layer = (uint32_t)layer, .mask = (uint32_t)mask };
+        }
+
+        void checksum(hl::Checksum& checksum) const
+        {
+            checksum.add(layer);
+            checksum.add(mask);
+        }
 	};
 
     constexpr CollisionLayer operator|(CollisionLayer lhs, CollisionLayer rhs)
@@ -35,11 +46,4 @@ namespace hur
         return static_cast<CollisionLayer>(
             static_cast<uint32_t>(lhs) & static_cast<uint32_t>(rhs));
     }
-
-    static bool ShouldTest(const CollisionComponent& a, const CollisionComponent& b)
-    {
-        return 
-            ((uint32_t)a.mask & (uint32_t)b.layer) &&
-            ((uint32_t)b.mask & (uint32_t)a.layer);
-    }
 }
\ No newline at end of file
@@ -12,6 +12,12 @@ namespace hur
 	public:
 		std::string SpriteName;
 		glm::vec2 Size;
+
+		void checksum(hl::Checksum& checksum) const
+		{
+			checksum.add(SpriteName);
+			checksum.add(Size);
+		}
 	private:
 
 	};
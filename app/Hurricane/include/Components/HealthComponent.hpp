@@ -22,6 +22,12 @@ namespace hur
 		int getCurrentHealth() const { return _currentHealth; }
 		void setCurrentHealth(int health) { _currentHealth = health; }
 
+		void checksum(hl::Checksum& checksum) const
+		{
+			checksum.add(_maxHealth);
+			checksum.add(_currentHealth);
+		}
+
 	private:
 		int _maxHealth;
 		int _currentHealth;
@@ -1,10 +1,11 @@
 #pragma once
 
-#include <helsinki/System/Events/Event.hpp>
+#include <helsinki/System/Events/EventCoalescer.hpp>
+#include <algorithm>
 
 namespace hur
 {
-	class CollisionEvent : public hl::Event
+	class CollisionEvent
 	{
 	public:
 		CollisionEvent(int entityAId, int entityBAId
@@ -16,11 +17,26 @@ namespace hur
 		int getEntityAId() const { return _entityAId; }
 		int getEntityBId() const { return _entityBId; }
 
-		DEFINE_EVENT_TYPE(CollisionEvent)
-
 	private:
 		int _entityAId;
 		int _entityBId;
 	};
 
-}
\ No newline at end of file
+}
+
+namespace hl
+{
+	// A pair is resolved once per frame even if it starts touching more than
+	// once across the frame's updates.
+	template<>
+	struct EventCoalescing<hur::CollisionEvent>
+	{
+		static constexpr EventMergePolicy Policy = EventMergePolicy::UniqueSet;
+		static uint64_t Key(const hur::CollisionEvent& event)
+		{
+			const auto a = (uint32_t)event.getEntityAId();
+			const auto b = (uint32_t)event.getEntityBId();
+			return (uint64_t)std::min(a, b) << 32 | std::max(a, b);
+		}
+	};
+}
@@ -1,13 +1,9 @@
 #pragma once
 
-#include <helsinki/System/Events/Event.hpp>
-
 namespace hur
 {
-	class EnemySpawnEvent : public hl::Event
+	class EnemySpawnEvent
 	{
-	public:
-		DEFINE_EVENT_TYPE(EnemySpawnEvent)
 	};
 
 }
\ No newline at end of file
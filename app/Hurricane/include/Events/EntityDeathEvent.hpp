@@ -1,7 +1,5 @@
 #pragma once
 
-#include <helsinki/System/Events/Event.hpp>
-
 namespace hur
 {
 	enum class DeathType
@@ -10,7 +8,7 @@ namespace hur
 		NO_DROP
 	};
 
-	class EntityDeathEvent : public hl::Event
+	class EntityDeathEvent
 	{
 	public:
 		EntityDeathEvent(int id, DeathType type) : _id(id), _type(type) {}
@@ -18,8 +16,6 @@ namespace hur
 		int getId() const { return _id; }
 		DeathType getDeathType() const { return _type; }
 
-		DEFINE_EVENT_TYPE(EntityDeathEvent)
-
 	private:
 		int _id;
 		DeathType _type;
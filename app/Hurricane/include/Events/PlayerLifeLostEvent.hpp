@@ -1,13 +1,9 @@
 #pragma once
 
-#include <helsinki/System/Events/Event.hpp>
-
 namespace hur
 {
-	class PlayerLifeLostEvent : public hl::Event
+	class PlayerLifeLostEvent
 	{
-	public:
-		DEFINE_EVENT_TYPE(PlayerLifeLostEvent)
 	};
 
 }
\ No newline at end of file
@@ -1,17 +1,14 @@
 #pragma once
 
-#include <helsinki/System/Events/Event.hpp>
-
 namespace hur
 {
-	class PlayerScoreEvent : public hl::Event
+	class PlayerScoreEvent
 	{
 	public:
 		PlayerScoreEvent(int amount) : _amount(amount) {}
 
 		int getAmount() const { return _amount; }
 
-		DEFINE_EVENT_TYPE(PlayerScoreEvent)
 	private:
 		int _amount;
 
@@ -1,13 +1,36 @@
 #pragma once
 
+#include <helsinki/System/Utils/String.hpp>
+#include <cstddef>
+#include <cstdint>
+
 namespace hur
 {
+	using hl::operator""_hash;
+
 	class HurricaneConstants
 	{
 		HurricaneConstants() = delete;
 	public:
 		static const constexpr int Width = 800;
 		static const constexpr int Height = 600;
+
+		// Entities built up front for each pool, they grow past this if needed.
+		static const constexpr size_t ProjectilePoolSize = 256;
+		static const constexpr size_t EnemyPoolSize = 64;
+	};
+
+	class HurricaneTags
+	{
+		HurricaneTags() = delete;
+	public:
+		static const constexpr uint32_t Sprite = "SPRITE"_hash;
+		static const constexpr uint32_t Entity = "ENTITY"_hash;
+		static const constexpr uint32_t Collider = "COLLIDER"_hash;
+		static const constexpr uint32_t Player = "PLAYER"_hash;
+		static const constexpr uint32_t Enemy = "ENEMY"_hash;
+		static const constexpr uint32_t Projectile = "PROJECTILE"_hash;
+		static const constexpr uint32_t Text = "TEXT"_hash;
 	};
 
 	enum class GameState
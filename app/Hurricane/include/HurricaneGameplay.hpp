@@ -0,0 +1,29 @@
+#pragma once
+
+#include <helsinki/Engine/Scene/Scene.hpp>
+#include <helsinki/Engine/Input/InputManager.hpp>
+#include <helsinki/System/Events/EventBus.hpp>
+#include <Services/ResourceService.hpp>
+
+namespace hur
+{
+	// The parts of a game that need no window or device, shared by the game
+	// scene and the headless runner so both simulate the same game.
+	class HurricaneGameplay
+	{
+		HurricaneGameplay() = delete;
+	public:
+		// Sets when collision and death events are handled and adds the
+		// gameplay systems in the order they update.
+		static void addSystems(
+			hl::Scene& scene,
+			hl::EventBus& eventBus,
+			hl::InputManager& inputManager,
+			const ResourceService& resourceService);
+
+		// Adds the player at the bottom middle of the screen.
+		static hl::Entity* spawnPlayer(
+			hl::Scene& scene,
+			const ResourceService& resourceService);
+	};
+}
@@ -6,6 +6,8 @@
 #include <helsinki/Renderer/Resource/StorageBufferResource.hpp>
 #include <Services/ResourceService.hpp>
 #include <Services/GameStateService.hpp>
+#include <Events/PlayerLifeLostEvent.hpp>
+#include <Events/PlayerScoreEvent.hpp>
 #include <helsinki/Renderer/Vulkan/VulkanVertex.hpp>
 #include <helsinki/Renderer/Vulkan/VulkanMappedBuffer.hpp>
 #include <Ui/UiRoot.hpp>
@@ -20,7 +22,6 @@ namespace hur
 		HurricaneGameEngineScene(
 			hl::Engine& engine,
 			const hl::EngineConfiguration& engineConfig);
-		~HurricaneGameEngineScene();
 
 		void initialise(
 			const std::string& cameraMatrixResourceId,
@@ -36,6 +37,8 @@ namespace hur
 		void additionalCleanup() override;
 
 		void OnEvent(const hl::Event& event) override;
+		void OnPlayerLifeLost(const PlayerLifeLostEvent& event);
+		void OnPlayerScore(const PlayerScoreEvent& event);
 
 	private:
 		void handleWindowSizeChange(int width, int height);
@@ -59,6 +62,9 @@ namespace hur
 
 		int _width;
 		int _height;
+
+		// Last so they are removed before anything they refer to is destroyed.
+		std::vector<hl::EventSubscription> _eventSubscriptions;
 	};
 
 }
\ No newline at end of file
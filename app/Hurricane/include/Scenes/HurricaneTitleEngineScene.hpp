@@ -12,7 +12,6 @@ namespace hur
 		HurricaneTitleEngineScene(
 			hl::Engine& engine,
 			const hl::EngineConfiguration& engineConfig);
-		~HurricaneTitleEngineScene();
 
 		void initialise(
 			const std::string& cameraMatrixResourceId,
@@ -33,6 +32,7 @@ namespace hur
 
 	private:
 		const hl::EngineConfiguration& _engineConfig;
+		hl::EventSubscription _eventListener;
 	};
 
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include <string>
 #include <unordered_map>
+#include <vector>
 #include <helsinki/System/glm.hpp>
 
 namespace hur
@@ -10,6 +11,10 @@ namespace hur
 	class ResourceService
 	{
 	public:
+		// Adds every sprite in a TextureAtlas sheet, indexed in the order they
+		// are listed, and returns the left, top, right and bottom of each in
+		// pixels in the same order.
+		std::vector<glm::vec4> loadSpriteSheet(const std::string& path);
 		void addSpriteIndexAndSize(const std::string& name, std::size_t index, glm::vec2 size);
 		std::size_t getIndex(const std::string& name) const;
 		glm::vec2 getSize(const std::string& name) const;
@@ -4,6 +4,11 @@
 #include <helsinki/Engine/Scene/Scene.hpp>
 #include <helsinki/Engine/Input/InputManager.hpp>
 #include <helsinki/System/Events/EventBus.hpp>
+#include <helsinki/Engine/ECS/Components/TransformComponent.hpp>
+#include <helsinki/Engine/Physics/SweepAndPruneBroadphase.hpp>
+#include <helsinki/Engine/Physics/ContactCache.hpp>
+#include <Components/EntityComponent.hpp>
+#include <Components/CollisionComponent.hpp>
 
 namespace hur
 {
@@ -18,6 +23,12 @@ namespace hur
 	private:
 		hl::EventBus& _eventBus;
 		hl::Scene& _scene;
+		hl::Query<hl::TransformComponent, EntityComponent, CollisionComponent> _colliders;
+		// Hurricane has hundreds of colliders at most, below the point where a
+		// uniform grid starts to pay off.
+		hl::SweepAndPruneBroadphase _broadphase;
+		std::vector<hl::BroadphasePair> _pairs;
+		hl::ContactCache _contacts;
 	};
 
 }
\ No newline at end of file
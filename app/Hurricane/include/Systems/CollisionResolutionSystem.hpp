@@ -3,20 +3,20 @@
 #include <helsinki/Engine/ECS/System.hpp>
 #include <helsinki/Engine/Scene/Scene.hpp>
 #include <helsinki/System/Events/EventBus.hpp>
+#include <Events/CollisionEvent.hpp>
 #include <Events/EntityDeathEvent.hpp>
 
 namespace hur
 {
 
-	class CollisionResolutionSystem : public hl::System, public hl::EventListener
+	class CollisionResolutionSystem : public hl::System
 	{
 	public:
 		CollisionResolutionSystem(
 			hl::EventBus& eventBus,
 			hl::Scene& scene);
-		~CollisionResolutionSystem();
 		void update(float delta) override;
-		void OnEvent(const hl::Event& event) override;
+		void OnCollision(const CollisionEvent& event);
 
 	private:
 		void applyDamageToEntity(hl::Entity* entity, int damage, DeathType type);
@@ -24,6 +24,7 @@ namespace hur
 	private:
 		hl::EventBus& _eventBus;
 		hl::Scene& _scene;
+		hl::EventSubscription _collisionSubscription;
 	};
 
 }
\ No newline at end of file
@@ -4,20 +4,21 @@
 #include <helsinki/Engine/Scene/Scene.hpp>
 #include <helsinki/System/Events/EventBus.hpp>
 #include <Services/ResourceService.hpp>
+#include <Components/EntityComponent.hpp>
+#include <Events/EnemySpawnEvent.hpp>
 
 namespace hur
 {
 
-	class EnemySpawnSystem : public hl::System, public hl::EventListener
+	class EnemySpawnSystem : public hl::System
 	{
 	public:
 		EnemySpawnSystem(
 			hl::EventBus& eventBus,
 			hl::Scene& scene,
 			const ResourceService& resourceService);
-		~EnemySpawnSystem();
 		void update(float delta) override;
-		void OnEvent(const hl::Event& event) override;
+		void OnEnemySpawn(const EnemySpawnEvent& event);
 
 	private:
 		void spawnDefaultEnemy();
@@ -26,7 +27,11 @@ namespace hur
 		hl::EventBus& _eventBus;
 		hl::Scene& _scene;
 		const ResourceService& _resourceService;
+		hl::Query<EntityComponent> _enemies;
+		glm::vec2 _enemySize;
+		hl::EntityPool& _enemyPool;
 		float _elapsed{ 0.0f };
+		hl::EventSubscription _enemySpawnSubscription;
 	};
 
 }
\ No newline at end of file
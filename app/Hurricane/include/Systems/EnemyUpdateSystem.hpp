@@ -4,6 +4,8 @@
 #include <helsinki/Engine/Scene/Scene.hpp>
 #include <helsinki/Engine/Input/InputManager.hpp>
 #include <helsinki/System/Events/EventBus.hpp>
+#include <helsinki/Engine/ECS/Components/TransformComponent.hpp>
+#include <Components/EntityComponent.hpp>
 
 namespace hur
 {
@@ -18,6 +20,7 @@ namespace hur
 	private:
 		hl::EventBus& _eventBus;
 		hl::Scene& _scene;
+		hl::Query<hl::TransformComponent, EntityComponent> _enemies;
 	};
 
 }
\ No newline at end of file
@@ -4,23 +4,24 @@
 #include <helsinki/Engine/Scene/Scene.hpp>
 #include <helsinki/System/Events/EventBus.hpp>
 #include <Services/GameStateService.hpp>
+#include <Events/EntityDeathEvent.hpp>
 
 namespace hur
 {
 
-	class EntityDeathSystem : public hl::System, public hl::EventListener
+	class EntityDeathSystem : public hl::System
 	{
 	public:
 		EntityDeathSystem(
 			hl::EventBus& eventBus,
 			hl::Scene& scene);
-		~EntityDeathSystem();
 		void update(float delta) override;
-		void OnEvent(const hl::Event& event) override;
+		void OnEntityDeath(const EntityDeathEvent& event);
 
 	private:
 		hl::EventBus& _eventBus;
 		hl::Scene& _scene;
+		hl::EventSubscription _entityDeathSubscription;
 	};
 
 }
\ No newline at end of file
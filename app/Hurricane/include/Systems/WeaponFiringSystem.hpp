@@ -3,22 +3,24 @@
 #include <helsinki/Engine/ECS/System.hpp>
 #include <helsinki/Engine/Scene/Scene.hpp>
 #include <helsinki/System/Events/EventBus.hpp>
+#include <Events/ShootEvent.hpp>
 
 namespace hur
 {
 
-	class WeaponFiringSystem : public hl::System, public hl::EventListener
+	class WeaponFiringSystem : public hl::System
 	{
 	public:
 		WeaponFiringSystem(
 			hl::EventBus& eventBus,
 			hl::Scene& scene);
-		~WeaponFiringSystem();
 		void update(float delta) override;
-		void OnEvent(const hl::Event& event) override;
+		void OnShoot(const ShootEvent& event);
 	private:
 		hl::EventBus& _eventBus;
 		hl::Scene& _scene;
+		hl::EntityPool& _projectilePool;
+		hl::EventSubscription _shootSubscription;
 	};
 
 }
\ No newline at end of file
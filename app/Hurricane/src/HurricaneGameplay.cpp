@@ -0,0 +1,96 @@
+#include <HurricaneGameplay.hpp>
+#include <HurricaneConstants.hpp>
+#include <Components/EntityComponent.hpp>
+#include <Components/CollisionComponent.hpp>
+#include <Components/HealthComponent.hpp>
+#include <Events/CollisionEvent.hpp>
+#include <Events/EntityDeathEvent.hpp>
+#include <helsinki/Engine/ECS/Components/TransformComponent.hpp>
+#include <helsinki/Engine/ECS/Components/SpriteComponent.hpp>
+#include <helsinki/Engine/Physics/KinematicSystem.hpp>
+#include <Systems/PlayerControlSystem.hpp>
+#include <Systems/WeaponFiringSystem.hpp>
+#include <Systems/ProjectileUpdateSystem.hpp>
+#include <Systems/CollisionDetectionSystem.hpp>
+#include <Systems/CollisionResolutionSystem.hpp>
+#include <Systems/EntityDeathSystem.hpp>
+#include <Systems/EnemySpawnSystem.hpp>
+#include <Systems/EnemyUpdateSystem.hpp>
+
+namespace hur
+{
+
+	void HurricaneGameplay::addSystems(
+		hl::Scene& scene,
+		hl::EventBus& eventBus,
+		hl::InputManager& inputManager,
+		const ResourceService& resourceService)
+	{
+		// Collisions are resolved once everything has moved, and anything
+		// they kill is handled after that, whatever order the systems run in.
+		eventBus.SetPhase<CollisionEvent>(hl::EventPhase::PostPhysics);
+		eventBus.SetPhase<EntityDeathEvent>(hl::EventPhase::EndOfFrame);
+
+		scene.addSystem(new PlayerControlSystem(
+			inputManager,
+			eventBus,
+			scene));
+
+		scene.addSystem(new WeaponFiringSystem(
+			eventBus,
+			scene));
+
+		scene.addSystem(new hl::KinematicSystem(scene));
+
+		scene.addSystem(new ProjectileUpdateSystem(
+			eventBus,
+			scene));
+
+		scene.addSystem(new EnemyUpdateSystem(
+			eventBus,
+			scene));
+
+		scene.addSystem(new EnemySpawnSystem(
+			eventBus,
+			scene,
+			resourceService));
+
+		scene.addSystem(new CollisionDetectionSystem(
+			eventBus,
+			scene));
+
+		scene.addSystem(new CollisionResolutionSystem(
+			eventBus,
+			scene));
+
+		scene.addSystem(new EntityDeathSystem(
+			eventBus,
+			scene));
+	}
+
+	hl::Entity* HurricaneGameplay::spawnPlayer(
+		hl::Scene& scene,
+		const ResourceService& resourceService)
+	{
+		auto entity = scene.addEntity("Player");
+		entity->AddTag(HurricaneTags::Sprite);
+		entity->AddTag(HurricaneTags::Entity);
+		entity->AddTag(HurricaneTags::Collider);
+		entity->AddTag(HurricaneTags::Player);
+		auto [sc, transform, sprite, health, cc] = entity->AddComponents(
+			EntityComponent(),
+			hl::TransformComponent(),
+			hl::SpriteComponent(),
+			HealthComponent(10, 10),
+			CollisionComponent());
+		sc->SpriteName = "playerShip1_blue";
+		sc->Size = resourceService.getSize(sc->SpriteName);
+		transform->SetPosition(glm::vec3(
+			HurricaneConstants::Width / 2.0f,
+			HurricaneConstants::Height - sc->Size.y / 2.0f,
+			0.0f));
+		cc->layer = CollisionLayer::Player;
+		cc->mask = CollisionLayer::EnemyBullet | CollisionLayer::Enemy;
+		return entity;
+	}
+}
@@ -1,11 +1,8 @@
 #include "Scenes/HurricaneGameEngineScene.hpp"
 #include "EntityPushConstantObject.hpp"
 #include <Components/EntityComponent.hpp>
-#include <Components/CollisionComponent.hpp>
-#include <Components/HealthComponent.hpp>
 #include <Events/EnemySpawnEvent.hpp>
-#include <Events/PlayerLifeLostEvent.hpp>
-#include <Events/PlayerScoreEvent.hpp>
+#include <HurricaneConstants.hpp>
 #include <GameCamera.hpp>
 #include <UiCamera.hpp>
 #include <helsinki/System/Events/KeyEvents.hpp>
@@ -18,16 +15,8 @@
 #include <helsinki/Renderer/Resource/VertexArrayResource.hpp>
 #include <helsinki/Renderer/Resource/FrameDataStorageBufferObject.hpp>
 #include <helsinki/Renderer/Vulkan/RenderGraph/SpritePushConstantObject.hpp>
-#include <helsinki/System/Utils/Xml.hpp>
 #include <helsinki/Engine/ECS/Components/SpriteComponent.hpp>
-#include <Systems/PlayerControlSystem.hpp>
-#include <Systems/WeaponFiringSystem.hpp>
-#include <Systems/ProjectileUpdateSystem.hpp>
-#include <Systems/CollisionDetectionSystem.hpp>
-#include <Systems/CollisionResolutionSystem.hpp>
-#include <Systems/EntityDeathSystem.hpp>
-#include <Systems/EnemySpawnSystem.hpp>
-#include <Systems/EnemyUpdateSystem.hpp>
+#include <HurricaneGameplay.hpp>
 #include <GLFW/glfw3.h>
 #include <Ui/UiLayout.hpp>
 
@@ -46,13 +35,11 @@ namespace hur
 	{
         _cameras.insert({ "Ui", new UiCamera() });
         _cameras.insert({ "Game", new GameCamera() });
-		_engine.getEventBus().AddListener(this);
-        _engine.getEventBus().AddListener(&_uiRoot);
-	}
-	HurricaneGameEngineScene::~HurricaneGameEngineScene()
-	{
-        _engine.getEventBus().RemoveListener(&_uiRoot);
-		_engine.getEventBus().RemoveListener(this);
+        auto& eventBus = _engine.getEventBus();
+		_eventSubscriptions.push_back(eventBus.AddScopedListener(this));
+        _eventSubscriptions.push_back(eventBus.AddScopedListener(&_uiRoot));
+        _eventSubscriptions.push_back(eventBus.SubscribeScoped<&HurricaneGameEngineScene::OnPlayerLifeLost>(this));
+        _eventSubscriptions.push_back(eventBus.SubscribeScoped<&HurricaneGameEngineScene::OnPlayerScore>(this));
 	}
 
 	void HurricaneGameEngineScene::initialise(
@@ -240,26 +227,14 @@ namespace hur
 
         {
 
-            const auto& doc = hl::Xml::parseFromFile(_engineConfig.RootPath + "/data/spritesheet/sheet.xml");
+            const auto rects = _resourceService.loadSpriteSheet(_engineConfig.RootPath + "/data/spritesheet/sheet.xml");
 
             std::vector<hl::FrameDataStorageBufferObject> frameData;
 
-            const auto& subTextures = doc.selectMany("TextureAtlas/SubTexture");
-
             const constexpr float TEX_SIZE = 1024.0f;
-            std::size_t idx = 0;
-            for (const auto& subTexture : subTextures)
+            for (const auto& rect : rects)
             {
-                const auto name = hl::String::ReplaceAll(subTexture->attributes["name"], ".png", "");
-                const auto x = std::stoi(subTexture->attributes["x"]);
-                const auto y = std::stoi(subTexture->attributes["y"]);
-                const auto w = std::stoi(subTexture->attributes["width"]);
-                const auto h = std::stoi(subTexture->attributes["height"]);
-
-                frameData.push_back({ .uvRect = glm::vec4((float)x, (float)y, (float)(x + w), (float)(y + h)) / TEX_SIZE });
-                _resourceService.addSpriteIndexAndSize(name, idx, glm::vec2((float)w, (float)h));
-
-                idx++;
+                frameData.push_back({ .uvRect = rect / TEX_SIZE });
             }
 
             _spriteSheetSSBOResourceHandle = resourceManager.Load<hl::StorageBufferResource>(
@@ -305,7 +280,7 @@ namespace hur
                     const auto& sprite = entity->GetComponent<hl::SpriteComponent>();
                     const auto& ec = entity->GetComponent<EntityComponent>();
 
-                    auto modelTransform = transform->GetTransformMatrix();
+                    auto modelTransform = pdd.scene->getWorldMatrix(*transform);
 
                     const auto size = _resourceService.getSize(ec->SpriteName);
 
@@ -352,39 +327,11 @@ namespace hur
 
         setGameState(GameState::INIT);
 
-        _scene.addSystem(new PlayerControlSystem(
-            _engine.getInputManager(),
-            _engine.getEventBus(),
-            this->_scene));
-
-        _scene.addSystem(new WeaponFiringSystem(
-            _engine.getEventBus(),
-            this->_scene));
-
-        _scene.addSystem(new ProjectileUpdateSystem(
-            _engine.getEventBus(),
-            this->_scene));
-
-        _scene.addSystem(new EnemyUpdateSystem(
-            _engine.getEventBus(),
-            this->_scene));
-
-        _scene.addSystem(new CollisionDetectionSystem(
-            _engine.getEventBus(),
-            this->_scene));
-
-        _scene.addSystem(new CollisionResolutionSystem(
-            _engine.getEventBus(),
-            this->_scene));
-
-        _scene.addSystem(new EntityDeathSystem(
-            _engine.getEventBus(),
-            this->_scene));
-
-        _scene.addSystem(new EnemySpawnSystem(
-            _engine.getEventBus(),
+        HurricaneGameplay::addSystems(
             this->_scene,
-            _resourceService));
+            _engine.getEventBus(),
+            _engine.getInputManager(),
+            _resourceService);
 
 		handleWindowSizeChange(_engineConfig.Width, _engineConfig.Height);
 
@@ -451,23 +398,7 @@ namespace hur
             return;
         }
 
-        auto entity = _scene.addEntity("Player");
-        entity->AddTag("SPRITE");
-        entity->AddTag("ENTITY");
-        entity->AddTag("COLLIDER");
-        entity->AddTag("PLAYER");
-        auto sc = entity->AddComponent<EntityComponent>();
-        sc->SpriteName = "playerShip1_blue";
-        sc->Size = _resourceService.getSize(sc->SpriteName);
-        entity->AddComponent<hl::TransformComponent>()->SetPosition(glm::vec3(
-            HurricaneConstants::Width / 2.0f,
-            HurricaneConstants::Height - sc->Size.y / 2.0f,
-            0.0f));
-        entity->AddComponent<hl::SpriteComponent>();
-        entity->AddComponent< HealthComponent>(10, 10);
-        auto cc = entity->AddComponent<CollisionComponent>();
-        cc->layer = CollisionLayer::Player;
-        cc->mask = CollisionLayer::EnemyBullet | CollisionLayer::Enemy;
+        HurricaneGameplay::spawnPlayer(_scene, _resourceService);
     }
 
     void HurricaneGameEngineScene::transitionFromGameOverToInit()
@@ -506,7 +437,7 @@ namespace hur
     void HurricaneGameEngineScene::transitionFromInitToPlaying()
     {
         spawnPlayer();
-        _engine.getEventBus().PublishEvent(EnemySpawnEvent());
+        _engine.getEventBus().Publish(EnemySpawnEvent());
 
         _gameStateService.setLivesRemaining(3);
         _gameStateService.setScore(0);
@@ -522,7 +453,7 @@ namespace hur
 
             if (code == GLFW_KEY_ENTER)
             {
-                _engine.getEventBus().PublishEvent(EnemySpawnEvent());
+                _engine.getEventBus().Publish(EnemySpawnEvent());
             }
             else if (code == GLFW_KEY_R)
             {
@@ -537,30 +468,32 @@ namespace hur
         {
             handleWindowSizeChange(wre->GetWidth(), wre->GetHeight());
         }
-        else if (auto plle = dynamic_cast<const PlayerLifeLostEvent*>(&event))
-        {
-            const auto lives = _gameStateService.getLivesRemaining() - 1;
+	}
 
-            if (lives < 0)
-            {
-                setGameState(GameState::GAME_OVER);
-            }
-            else
-            {
-                _gameStateService.setLivesRemaining(lives);
-                // TODO: 
-                // Clear out enemies, restart wave/enemy spawning?
-                // Spawn player again
-                std::cout << "LIVES: " << _gameStateService.getLivesRemaining() << std::endl;
-            }
+    void HurricaneGameEngineScene::OnPlayerLifeLost(const PlayerLifeLostEvent& event)
+    {
+        const auto lives = _gameStateService.getLivesRemaining() - 1;
+
+        if (lives < 0)
+        {
+            setGameState(GameState::GAME_OVER);
         }
-        else if (auto pse = dynamic_cast<const PlayerScoreEvent*>(&event))
+        else
         {
-            _gameStateService.incrementScore(pse->getAmount());
-
-            std::cout << "SCORE: " << _gameStateService.getScore() << std::endl;
+            _gameStateService.setLivesRemaining(lives);
+            // TODO: 
+            // Clear out enemies, restart wave/enemy spawning?
+            // Spawn player again
+            std::cout << "LIVES: " << _gameStateService.getLivesRemaining() << std::endl;
         }
-	}
+    }
+
+    void HurricaneGameEngineScene::OnPlayerScore(const PlayerScoreEvent& event)
+    {
+        _gameStateService.incrementScore(event.getAmount());
+
+        std::cout << "SCORE: " << _gameStateService.getScore() << std::endl;
+    }
 
 	void HurricaneGameEngineScene::handleWindowSizeChange(int width, int height)
 	{
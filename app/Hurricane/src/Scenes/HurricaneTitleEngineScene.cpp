@@ -9,6 +9,7 @@
 #include <GLFW/glfw3.h>
 #include <helsinki/Engine/ECS/Components/TransformComponent.hpp>
 #include <helsinki/Engine/ECS/Components/TextComponent.hpp>
+#include <HurricaneConstants.hpp>
 
 namespace hur
 {
@@ -21,12 +22,7 @@ namespace hur
 		_engineConfig(engineConfig)
 	{
         _cameras.insert({ "Default", new hl::Camera2D() });
-		_engine.getEventBus().AddListener(this);
-	}
-
-	HurricaneTitleEngineScene::~HurricaneTitleEngineScene()
-	{
-		_engine.getEventBus().RemoveListener(this);
+		_eventListener = _engine.getEventBus().AddScopedListener(this);
 	}
 
     void HurricaneTitleEngineScene::initialise(
@@ -64,7 +60,7 @@ namespace hur
 
         {
             auto entity = _scene.addEntity("title");
-            entity->AddTag("TEXT");
+            entity->AddTag(HurricaneTags::Text);
             entity->AddComponent<hl::TransformComponent>();
             // TODO: Dont like having to pass text system here...
             entity->AddComponent<hl::TextComponent>()->setString(
@@ -76,7 +72,7 @@ namespace hur
         }
         {
             auto entity = _scene.addEntity("start");
-            entity->AddTag("TEXT");
+            entity->AddTag(HurricaneTags::Text);
             entity->AddComponent<hl::TransformComponent>();
             // TODO: Dont like having to pass text system here...
             entity->AddComponent<hl::TextComponent>()->setString(
@@ -87,7 +83,7 @@ namespace hur
         }
         {
             auto entity = _scene.addEntity("quit");
-            entity->AddTag("TEXT");
+            entity->AddTag(HurricaneTags::Text);
             entity->AddComponent<hl::TransformComponent>();
             // TODO: Dont like having to pass text system here...
             entity->AddComponent<hl::TextComponent>()->setString(
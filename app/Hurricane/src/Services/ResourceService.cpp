@@ -1,8 +1,30 @@
 #include <Services/ResourceService.hpp>
+#include <helsinki/System/Utils/Xml.hpp>
+#include <helsinki/System/Utils/String.hpp>
 
 namespace hur
 {
 
+	std::vector<glm::vec4> ResourceService::loadSpriteSheet(const std::string& path)
+	{
+		const auto& doc = hl::Xml::parseFromFile(path);
+
+		std::vector<glm::vec4> rects;
+		for (const auto& subTexture : doc.selectMany("TextureAtlas/SubTexture"))
+		{
+			const auto name = hl::String::ReplaceAll(subTexture->attributes["name"], ".png", "");
+			const auto x = std::stoi(subTexture->attributes["x"]);
+			const auto y = std::stoi(subTexture->attributes["y"]);
+			const auto w = std::stoi(subTexture->attributes["width"]);
+			const auto h = std::stoi(subTexture->attributes["height"]);
+
+			addSpriteIndexAndSize(name, rects.size(), glm::vec2((float)w, (float)h));
+			rects.push_back(glm::vec4((float)x, (float)y, (float)(x + w), (float)(y + h)));
+		}
+
+		return rects;
+	}
+
 	void ResourceService::addSpriteIndexAndSize(const std::string& name, std::size_t index, glm::vec2 size)
 	{
 		_spriteToIndexAndSize.insert({ name, { index, size } });
@@ -12,64 +12,30 @@ namespace hur
 		hl::Scene& scene
 	) :
 		_eventBus(eventBus),
-		_scene(scene)
+		_scene(scene),
+		_colliders(scene.query<hl::TransformComponent, EntityComponent, CollisionComponent>(HurricaneTags::Collider))
 	{
-
+		_eventBus.Coalesce<CollisionEvent>();
 	}
 
 	void CollisionDetectionSystem::update(float delta)
 	{
-		const auto colliders = _scene.getEntitiesByTag("COLLIDER");
-
-		for (auto i = 0; i < colliders.size(); ++i)
-		{
-			auto colliderEntityI = colliders[i];
-
-			const auto iTc = colliderEntityI->GetComponent<hl::TransformComponent>();
-			const auto iEc = colliderEntityI->GetComponent<EntityComponent>();
-			const auto iCc = colliderEntityI->GetComponent<CollisionComponent>();
-
-			const auto iPos = iTc->GetPosition();
-			const auto iSize = iEc->Size;
-
-			const auto iLeft = iPos.x - iSize.x / 2.0f;
-			const auto iRight = iPos.x + iSize.x / 2.0f;
-
-			const auto iTop = iPos.y - iSize.y / 2.0f;
-			const auto iBottom = iPos.y + iSize.y / 2.0f;
-
-			for (auto j = i + 1; j < colliders.size(); ++j)
+		_broadphase.beginUpdate();
+		_colliders.each([&](hl::Entity& entity, hl::TransformComponent& transform, EntityComponent& ec, CollisionComponent& cc)
 			{
-				auto colliderEntityJ = colliders[j];
-
-				const auto jTc = colliderEntityJ->GetComponent<hl::TransformComponent>();
-				const auto jEc = colliderEntityJ->GetComponent<EntityComponent>();
-				const auto jCc = colliderEntityJ->GetComponent<CollisionComponent>();
-
-				if (!ShouldTest(*iCc, *jCc))
-				{
-					continue;
-				}
-
-				const auto jPos = jTc->GetPosition();
-				const auto jSize = jEc->Size;
-
-				const auto jLeft = jPos.x - jSize.x / 2.0f;
-				const auto jRight = jPos.x + jSize.x / 2.0f;
-
-				const auto jTop = jPos.y - jSize.y / 2.0f;
-				const auto jBottom = jPos.y + jSize.y / 2.0f;
-
-				if (iLeft > jRight ||
-					iRight < jLeft ||
-					iTop > jBottom ||
-					iBottom < jTop)
-				{
-					continue;
-				}
-
-				_eventBus.PublishEvent(CollisionEvent(colliderEntityI->Id, colliderEntityJ->Id));
-			}
+				const auto position = transform.GetPosition();
+				_broadphase.update(entity.Id, hl::Aabb::fromCentre({ position.x, position.y }, ec.Size), cc.getFilter());
+			});
+		_broadphase.endUpdate();
+
+		// Boxes overlapping or touching is all Hurricane needs, so every
+		// candidate is a collision. Only collisions that have just started are
+		// published, a pair staying in contact is not hit again each update.
+		_broadphase.findPairs(_pairs);
+		_contacts.update(_pairs);
+		for (const auto& pair : _contacts.getEntered())
+		{
+			_eventBus.Publish(CollisionEvent(pair.entityA, pair.entityB));
 		}
 	}
 }
\ No newline at end of file
@@ -1,6 +1,6 @@
 #include <Systems/CollisionResolutionSystem.hpp>
-#include <Events/CollisionEvent.hpp>
 #include <Components/HealthComponent.hpp>
+#include <HurricaneConstants.hpp>
 
 namespace hur
 {
@@ -12,11 +12,7 @@ namespace hur
 		_eventBus(eventBus),
 		_scene(scene)
 	{
-		_eventBus.AddListener(this);
-	}
-	CollisionResolutionSystem::~CollisionResolutionSystem()
-	{
-		_eventBus.RemoveListener(this);
+		_collisionSubscription = _eventBus.SubscribeScoped<&CollisionResolutionSystem::OnCollision>(this);
 	}
 
 	void CollisionResolutionSystem::update(float delta)
@@ -24,59 +20,59 @@ namespace hur
 
 	}
 
-	void CollisionResolutionSystem::OnEvent(const hl::Event& event)
+	void CollisionResolutionSystem::OnCollision(const CollisionEvent& event)
 	{
-		// TODO: What happens if projectile hits multiple enemies in one frame?
-		if (auto ce = dynamic_cast<const CollisionEvent*>(&event))
+		auto entityA = _scene.getEntity(event.getEntityAId());
+		auto entityB = _scene.getEntity(event.getEntityBId());
+
+		// A projectile touching several enemies at once only hits the first,
+		// the rest see it already removed.
+		if (entityA == nullptr || entityB == nullptr ||
+			_scene.isPendingRemoval(entityA->Id) ||
+			_scene.isPendingRemoval(entityB->Id))
 		{
-			auto entityA = _scene.getEntity(ce->getEntityAId());
-			auto entityB = _scene.getEntity(ce->getEntityBId());
+			return;
+		}
 
-			if (entityA == nullptr || entityB == nullptr)
-			{
-				return;
-			}
+		auto projectileIsA = entityA->HasTag(HurricaneTags::Projectile);
+		auto projectileIsB = entityB->HasTag(HurricaneTags::Projectile);
 
-			auto projectileIsA = entityA->HasTag("PROJECTILE"); // TODO: CONSTANTS
-			auto projectileIsB = entityB->HasTag("PROJECTILE");
+		if (projectileIsA)
+		{
+			_scene.removeEntity(entityA->Id);
 
-			if (projectileIsA)
-			{
-				_scene.removeEntity(entityA->Id);
+			const int damage = 3;
+			applyDamageToEntity(entityB, damage, DeathType::DROP);
 
-				const int damage = 3;
-				applyDamageToEntity(entityB, damage, DeathType::DROP);
+		}
+		else if (projectileIsB)
+		{
+			_scene.removeEntity(entityB->Id);
 
-			}
-			else if (projectileIsB)
+			const int damage = 3;
+			applyDamageToEntity(entityA, damage, DeathType::DROP);
+		}
+		else
+		{
+			const auto aIsPlayer = entityA->HasTag(HurricaneTags::Player);
+			const auto bIsPlayer = entityB->HasTag(HurricaneTags::Player);
+
+			const auto aIsEnemy = entityA->HasTag(HurricaneTags::Enemy);
+			const auto bIsEnemy = entityB->HasTag(HurricaneTags::Enemy);
+
+			if (aIsPlayer && bIsEnemy)
 			{
-				_scene.removeEntity(entityB->Id);
+				const int damage = 5;
+				applyDamageToEntity(entityA, damage, DeathType::NO_DROP); // PLAYER DOESNT DROP
 
-				const int damage = 3;
-				applyDamageToEntity(entityA, damage, DeathType::DROP);
+				_eventBus.Publish(EntityDeathEvent(entityB->Id, DeathType::NO_DROP));
 			}
-			else
+			else if (bIsPlayer && aIsEnemy)
 			{
-				const auto aIsPlayer = entityA->HasTag("PLAYER");// TODO: CONSTANT
-				const auto bIsPlayer = entityB->HasTag("PLAYER");// TODO: CONSTANT
-
-				const auto aIsEnemy = entityA->HasTag("ENEMY");// TODO: CONSTANT
-				const auto bIsEnemy = entityB->HasTag("ENEMY");// TODO: CONSTANT
-
-				if (aIsPlayer && bIsEnemy)
-				{
-					const int damage = 5;
-					applyDamageToEntity(entityA, damage, DeathType::NO_DROP); // PLAYER DOESNT DROP
-
-					_eventBus.PublishEvent(EntityDeathEvent(entityB->Id, DeathType::NO_DROP));
-				}
-				else if (bIsPlayer && aIsEnemy)
-				{
-					const int damage = 5;
-					applyDamageToEntity(entityB, damage, DeathType::NO_DROP); // PLAYER DOESNT DROP
-
-					_eventBus.PublishEvent(EntityDeathEvent(entityA->Id, DeathType::NO_DROP));
-				}
+				const int damage = 5;
+				applyDamageToEntity(entityB, damage, DeathType::NO_DROP); // PLAYER DOESNT DROP
+
+				_eventBus.Publish(EntityDeathEvent(entityA->Id, DeathType::NO_DROP));
 			}
 		}
 	}
@@ -91,7 +87,7 @@ namespace hur
 
 		if (aHealth->getCurrentHealth() <= 0)
 		{
-			_eventBus.PublishEvent(EntityDeathEvent(entity->Id, type));
+			_eventBus.Publish(EntityDeathEvent(entity->Id, type));
 		}
 	}
 }
\ No newline at end of file
@@ -1,5 +1,4 @@
 #include <Systems/EnemySpawnSystem.hpp>
-#include <Events/EnemySpawnEvent.hpp>
 #include <Components/EntityComponent.hpp>
 #include <Components/CollisionComponent.hpp>
 #include <Components/HealthComponent.hpp>
@@ -11,6 +10,27 @@
 namespace hur
 {
 
+	static hl::Prefab makeEnemyPrefab(const glm::vec2& size)
+	{
+		hl::Prefab prefab;
+		prefab
+			.addTag(HurricaneTags::Sprite)
+			.addTag(HurricaneTags::Entity)
+			.addTag(HurricaneTags::Collider)
+			.addTag(HurricaneTags::Enemy);
+		prefab.addComponent<hl::SpriteComponent>();
+		prefab.addComponent<HealthComponent>(10, 10);
+		prefab.addComponent<hl::KinematicComponent>().velocity = glm::vec3(0.0f, 128.0f, 0.0f);
+		auto& cc = prefab.addComponent<CollisionComponent>();
+		cc.layer = CollisionLayer::Enemy;
+		cc.mask = CollisionLayer::PlayerBullet | CollisionLayer::Player;
+		auto& sc = prefab.addComponent<EntityComponent>();
+		sc.SpriteName = "enemyBlack1";
+		sc.Size = size;
+		prefab.addComponent<hl::TransformComponent>();
+		return prefab;
+	}
+
 	EnemySpawnSystem::EnemySpawnSystem(
 		hl::EventBus& eventBus,
 		hl::Scene& scene,
@@ -18,13 +38,14 @@ namespace hur
 	) :
 		_eventBus(eventBus),
 		_scene(scene),
-		_resourceService(resourceService)
-	{
-		_eventBus.AddListener(this);
-	}
-	EnemySpawnSystem::~EnemySpawnSystem()
+		_resourceService(resourceService),
+		_enemies(scene.query<EntityComponent>(HurricaneTags::Enemy)),
+		_enemySize(resourceService.getSize("enemyBlack1")),
+		_enemyPool(scene.createPool(makeEnemyPrefab(_enemySize), HurricaneConstants::EnemyPoolSize))
 	{
-		_eventBus.RemoveListener(this);
+		// Spawning goes through the command buffer, so this can run alongside the update systems.
+		access().reads<EntityComponent>();
+		_enemySpawnSubscription = _eventBus.SubscribeScoped<&EnemySpawnSystem::OnEnemySpawn>(this);
 	}
 
 	void EnemySpawnSystem::update(float delta)
@@ -35,7 +56,7 @@ namespace hur
 		{
 			_elapsed -= 2.0f;
 
-			const auto enemyCount = _scene.getEntitiesByTag("ENEMY").size();
+			const auto enemyCount = _enemies.size();
 
 			if (enemyCount < 3)
 			{
@@ -44,36 +65,23 @@ namespace hur
 		}
 	}
 
-	void EnemySpawnSystem::OnEvent(const hl::Event& event)
+	void EnemySpawnSystem::OnEnemySpawn(const EnemySpawnEvent& /*event*/)
 	{
-		if (auto ede = dynamic_cast<const EnemySpawnEvent*>(&event))
-		{
-			spawnDefaultEnemy();
-		}
+		spawnDefaultEnemy();
 	}
 
 	void EnemySpawnSystem::spawnDefaultEnemy()
 	{
-		auto enemy = _scene.addEntity();
-		enemy->AddTag("SPRITE");
-		enemy->AddTag("ENTITY");
-		enemy->AddTag("COLLIDER");
-		enemy->AddTag("ENEMY");
-		enemy->AddComponent<hl::SpriteComponent>();
-		enemy->AddComponent< HealthComponent>(10, 10);
-		enemy->AddComponent<hl::KinematicComponent>()->velocity = glm::vec3(0.0f, 128.0f, 0.0f);
-		auto cc = enemy->AddComponent<CollisionComponent>();
-		cc->layer = CollisionLayer::Enemy;
-		cc->mask = CollisionLayer::PlayerBullet | CollisionLayer::Player;
-		auto sc = enemy->AddComponent<EntityComponent>();
-		sc->SpriteName = "enemyBlack1";
-		sc->Size = _resourceService.getSize(sc->SpriteName);
+		auto& commands = _scene.getCommandBuffer();
+
+		// Everything but where it starts comes from the prefab.
+		auto enemy = commands.spawn(_enemyPool);
 
-		const float x = sc->Size.x / 2.0f + static_cast<float>(rand() % 1000) / 1000.0f * (HurricaneConstants::Width - sc->Size.x);
+		const float x = _enemySize.x / 2.0f + _scene.getRandom().nextFloat() * (HurricaneConstants::Width - _enemySize.x);
 
-		enemy->AddComponent<hl::TransformComponent>()->SetPosition(glm::vec3(
+		commands.setComponent<hl::TransformComponent>(enemy).SetPosition(glm::vec3(
 			x,
-			sc->Size.y / 2.0f + 16.0f,
+			_enemySize.y / 2.0f + 16.0f,
 			0.0f));
 	}
 }
\ No newline at end of file
@@ -2,7 +2,6 @@
 #include <Components/EntityComponent.hpp>
 #include <HurricaneConstants.hpp>
 #include <helsinki/Engine/ECS/Components/TransformComponent.hpp>
-#include <helsinki/Engine/ECS/Components/KinematicComponent.hpp>
 
 namespace hur
 {
@@ -11,28 +10,25 @@ namespace hur
 		hl::Scene& scene
 	) :
 		_eventBus(eventBus),
-		_scene(scene)
+		_scene(scene),
+		_enemies(scene.query<hl::TransformComponent, EntityComponent>(HurricaneTags::Enemy))
 	{
-
+		access().reads<hl::TransformComponent, EntityComponent>();
 	}
 
-	void EnemyUpdateSystem::update(float delta)
+	void EnemyUpdateSystem::update(float /*delta*/)
 	{
-		for (auto e : _scene.getEntitiesByTag("ENEMY"))
-		{
-			auto tc = e->GetComponent<hl::TransformComponent>();
-			auto kc = e->GetComponent<hl::KinematicComponent>();
-			auto ec = e->GetComponent<EntityComponent>();
-
-			const auto newPosition = tc->GetPosition() + kc->velocity * delta;
-
-			tc->SetPosition(newPosition);
-
-			if (newPosition.y + ec->Size.y / 2.0f > HurricaneConstants::Height)
+		_enemies.each(
+			[&](hl::Entity& e, hl::TransformComponent& tc, EntityComponent& ec)
 			{
-				_scene.removeEntity(e->Id);
-				// TODO: ON EMENY REACHED END?>??
-			}
-		}
+				// Moved by the KinematicSystem.
+				const auto& position = tc.GetPosition();
+
+				if (position.y + ec.Size.y / 2.0f > HurricaneConstants::Height)
+				{
+					_scene.removeEntity(e.Id);
+					// TODO: ON EMENY REACHED END?>??
+				}
+			});
 	}
 }
\ No newline at end of file
@@ -1,7 +1,7 @@
 #include <Systems/EntityDeathSystem.hpp>
-#include <Events/EntityDeathEvent.hpp>
 #include <Events/PlayerLifeLostEvent.hpp>
 #include <Events/PlayerScoreEvent.hpp>
+#include <HurricaneConstants.hpp>
 
 namespace hur
 {
@@ -13,12 +13,7 @@ namespace hur
 		_eventBus(eventBus),
 		_scene(scene)
 	{
-		_eventBus.AddListener(this);
-	}
-
-	EntityDeathSystem::~EntityDeathSystem()
-	{
-		_eventBus.RemoveListener(this);
+		_entityDeathSubscription = _eventBus.SubscribeScoped<&EntityDeathSystem::OnEntityDeath>(this);
 	}
 
 	void EntityDeathSystem::update(float delta)
@@ -27,28 +22,25 @@ namespace hur
 	}
 
 	// TODO: Make systems that dont actually update services???
-	void EntityDeathSystem::OnEvent(const hl::Event& event)
+	void EntityDeathSystem::OnEntityDeath(const EntityDeathEvent& event)
 	{
 		// TODO: Should this just fire entity death events?
 
-		if (auto ede = dynamic_cast<const EntityDeathEvent*>(&event))
+		auto entity = _scene.getEntity(event.getId());
+
+		const auto deathType = event.getDeathType();
+
+		if (entity->HasTag(HurricaneTags::Player))
+		{
+			_eventBus.Publish(PlayerLifeLostEvent());
+		}
+		else
 		{
-			auto entity = _scene.getEntity(ede->getId());
-
-			const auto deathType = ede->getDeathType();
-
-			if (entity->HasTag("PLAYER")) // TODO: CONSTANT
-			{
-				_eventBus.PublishEvent(PlayerLifeLostEvent());
-			}
-			else
-			{
-				// TODO: Different for enemy and world/environment???
-				_eventBus.PublishEvent(PlayerScoreEvent(1));
-			}
-
-			// TODO: Other on death stuff, drops, decrease lives etc...
-			_scene.removeEntity(entity->Id);
+			// TODO: Different for enemy and world/environment???
+			_eventBus.Publish(PlayerScoreEvent(1));
 		}
+
+		// TODO: Other on death stuff, drops, decrease lives etc...
+		_scene.removeEntity(entity->Id);
 	}
 }
\ No newline at end of file
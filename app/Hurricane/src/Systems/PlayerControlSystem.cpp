@@ -40,7 +40,7 @@ namespace hur
 		if (_inputManager.isKeyReleased(GLFW_KEY_SPACE))
 		{
 			ShootEvent shootEvent(player->Id);
-			_eventBus.PublishEvent(shootEvent);
+			_eventBus.Publish(shootEvent);
 		}
 
 		if (_inputManager.isKeyDown(GLFW_KEY_A))
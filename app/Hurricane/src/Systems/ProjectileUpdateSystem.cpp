@@ -2,7 +2,6 @@
 #include <Components/EntityComponent.hpp>
 #include <HurricaneConstants.hpp>
 #include <helsinki/Engine/ECS/Components/TransformComponent.hpp>
-#include <helsinki/Engine/ECS/Components/KinematicComponent.hpp>
 
 namespace hur
 {
@@ -11,27 +10,24 @@ namespace hur
 		hl::Scene& scene
 	) :
 		_eventBus(eventBus),
-		_scene(scene)
+		_scene(scene),
+		_projectiles(scene.query<hl::TransformComponent, EntityComponent>(HurricaneTags::Projectile))
 	{
-
+		access().reads<hl::TransformComponent, EntityComponent>();
 	}
 
-	void ProjectileUpdateSystem::update(float delta)
+	void ProjectileUpdateSystem::update(float /*delta*/)
 	{
-		for (auto e : _scene.getEntitiesByTag("PROJECTILE"))
-		{
-			auto tc = e->GetComponent<hl::TransformComponent>();
-			auto kc = e->GetComponent<hl::KinematicComponent>();
-			auto ec = e->GetComponent<EntityComponent>();
-
-			const auto newPosition = tc->GetPosition() + kc->velocity * delta;
-
-			tc->SetPosition(newPosition);
-
-			if (newPosition.y < -ec->Size.y)
+		_projectiles.each(
+			[&](hl::Entity& e, hl::TransformComponent& tc, EntityComponent& ec)
 			{
-				_scene.removeEntity(e->Id);
-			}
-		}
+				// Moved by the KinematicSystem.
+				const auto& position = tc.GetPosition();
+
+				if (position.y < -ec.Size.y)
+				{
+					_scene.removeEntity(e.Id);
+				}
+			});
 	}
 }
\ No newline at end of file
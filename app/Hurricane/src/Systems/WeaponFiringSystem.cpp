@@ -1,27 +1,43 @@
 #include <Systems/WeaponFiringSystem.hpp>
-#include <Events/ShootEvent.hpp>
 #include <helsinki/Engine/ECS/Components/SpriteComponent.hpp>
 #include <helsinki/Engine/ECS/Components/TransformComponent.hpp>
 #include <helsinki/Engine/ECS/Components/KinematicComponent.hpp>
 #include <Components/EntityComponent.hpp>
 #include <Components/CollisionComponent.hpp>
+#include <HurricaneConstants.hpp>
 #include <iostream>
 
 namespace hur
 {
 
+	static hl::Prefab makeProjectilePrefab()
+	{
+		hl::Prefab prefab;
+		prefab
+			.addTag(HurricaneTags::Projectile)
+			.addTag(HurricaneTags::Collider)
+			.addTag(HurricaneTags::Sprite); // TODO: Maybe components can have tags that they auto add?
+		prefab.addComponent<hl::TransformComponent>();
+		prefab.addComponent<hl::KinematicComponent>().velocity = { 0.0f, -384.0f, 0.0f };
+		prefab.addComponent<hl::SpriteComponent>();
+		auto& cc = prefab.addComponent<CollisionComponent>();
+		cc.layer = CollisionLayer::PlayerBullet;
+		cc.mask = CollisionLayer::Enemy;
+		auto& sc = prefab.addComponent<EntityComponent>();
+		sc.SpriteName = "laserBlue01";
+		sc.Size = { 9,54 };// TODO: LOOKUP SERVICE _spriteToIndexAndSize[sc->SpriteName].second;
+		return prefab;
+	}
+
 	WeaponFiringSystem::WeaponFiringSystem(
 		hl::EventBus& eventBus,
 		hl::Scene& scene
 	) :
 		_eventBus(eventBus),
-		_scene(scene)
+		_scene(scene),
+		_projectilePool(scene.createPool(makeProjectilePrefab(), HurricaneConstants::ProjectilePoolSize))
 	{
-		_eventBus.AddListener(this);
-	}
-	WeaponFiringSystem::~WeaponFiringSystem()
-	{
-		_eventBus.RemoveListener(this);
+		_shootSubscription = _eventBus.SubscribeScoped<&WeaponFiringSystem::OnShoot>(this);
 	}
 
 	void WeaponFiringSystem::update(float delta)
@@ -29,29 +45,15 @@ namespace hur
 
 	}
 
-	void WeaponFiringSystem::OnEvent(const hl::Event& event)
+	void WeaponFiringSystem::OnShoot(const ShootEvent& event)
 	{
-		if (auto se = dynamic_cast<const ShootEvent*>(&event))
-		{
-			const std::string texture = "laserBlue01";
-
-			auto shooter = _scene.getEntity(se->getShooterId());
-			const auto shooterPosition = shooter->GetComponent<hl::TransformComponent>()->GetPosition();
-
-			auto projectile = _scene.addEntity();
-			projectile->AddTag("PROJECTILE");
-			projectile->AddTag("COLLIDER");
-			projectile->AddTag("SPRITE"); // TODO: Maybe components can have tags that they auto add?
-			projectile->AddComponent<hl::TransformComponent>()->SetPosition(shooterPosition - glm::vec3(0.0f, 64.0f, 0.0f));
-			projectile->AddComponent<hl::KinematicComponent>()->velocity = { 0.0f, -384.0f, 0.0f };
-			projectile->AddComponent<hl::SpriteComponent>();
-			auto cc = projectile->AddComponent<CollisionComponent>();
-			cc->layer = CollisionLayer::PlayerBullet;
-			cc->mask = CollisionLayer::Enemy;
-			auto sc = projectile->AddComponent<EntityComponent>();
-			sc->SpriteName = texture;
-			sc->Size = { 9,54 };// TODO: LOOKUP SERVICE _spriteToIndexAndSize[sc->SpriteName].second;
-		}
+		auto shooter = _scene.getEntity(event.getShooterId());
+		const auto shooterPosition = shooter->GetComponent<hl::TransformComponent>()->GetPosition();
+
+		// Everything else about a projectile comes from the prefab.
+		auto& commands = _scene.getCommandBuffer();
+		auto projectile = commands.spawn(_projectilePool);
+		commands.setComponent<hl::TransformComponent>(projectile).SetPosition(shooterPosition - glm::vec3(0.0f, 64.0f, 0.0f));
 	}
 
 }
\ No newline at end of file
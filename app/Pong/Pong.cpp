@@ -3,6 +3,10 @@
 #include <PongTitleEngineScene.hpp>
 #include <helsinki/Engine/Engine.hpp>
 #include <helsinki/System/Utils/ServiceProvider.hpp>
+#include <helsinki/System/Events/EventRecorder.hpp>
+#include <iostream>
+#include <optional>
+#include <string_view>
 #include <helsinki/Engine/Input/InputManager.hpp>
 
 static void registerServices(hl::ServiceProvider& services)
@@ -13,8 +17,32 @@ static void registerServices(hl::ServiceProvider& services)
 	services.registerService<hl::EngineConfiguration, hl::EngineConfiguration>(hl::ServiceLifetime::Singleton);
 }
 
-int main()
+int main(int argc, char** argv)
 {
+	// --record <path> saves the session's events, --replay <path> runs one
+	// back without drawing and reports how long it took. --seed <n> makes the
+	// game deterministic, so a session recorded and replayed with the same
+	// seed plays out identically.
+	std::string recordPath;
+	std::string replayPath;
+	std::optional<uint64_t> seed;
+	for (int i = 1; i + 1 < argc; ++i)
+	{
+		const std::string_view arg(argv[i]);
+		if (arg == "--record")
+		{
+			recordPath = argv[++i];
+		}
+		else if (arg == "--replay")
+		{
+			replayPath = argv[++i];
+		}
+		else if (arg == "--seed")
+		{
+			seed = std::stoull(argv[++i]);
+		}
+	}
+
 	hl::ServiceProvider serviceProvider;
 
 	registerServices(serviceProvider);
@@ -23,12 +51,35 @@ int main()
 	auto& engineConfig = serviceProvider.get<hl::EngineConfiguration>();
 
 	engineConfig.applyConfig("/data/config.json", std::string(pong::PongConfig::RootPath));
+	engineConfig.Headless = !replayPath.empty();
+	engineConfig.Seed = seed;
 
 	engine.init(engineConfig);
 	//engine.setScene(new pong::PongEngineScene(engine, engineConfig));
 	engine.setScene(new pong::PongTitleEngineScene(engine, engineConfig));
-	
+
+	if (!replayPath.empty())
+	{
+		const auto recording = hl::EventRecording::LoadFromFile(replayPath);
+		const auto result = engine.replay(recording);
+		std::cout << "Replayed " << result.frames << " frames, " << result.updates << " updates in "
+			<< result.totalMilliseconds << "ms, slowest frame " << result.slowestFrameMilliseconds << "ms" << std::endl;
+		return EXIT_SUCCESS;
+	}
+
+	hl::EventRecorder recorder;
+	if (!recordPath.empty())
+	{
+		engine.setRecorder(&recorder);
+	}
+
 	engine.run();
 
+	if (!recordPath.empty())
+	{
+		engine.setRecorder(nullptr);
+		recorder.GetRecording().SaveToFile(recordPath);
+	}
+
 	return EXIT_SUCCESS;
 }
\ No newline at end of file
@@ -0,0 +1,133 @@
+#include <PongGameplay.hpp>
+#include <Events/PointScoredEvent.hpp>
+#include <helsinki/Engine/HeadlessGame.hpp>
+#include <helsinki/Engine/ECS/Components/KinematicComponent.hpp>
+#include <helsinki/Engine/ECS/Components/TrackAxisComponent.hpp>
+#include <helsinki/System/Events/EventRecorder.hpp>
+#include <helsinki/System/Events/KeyEvents.hpp>
+#include <GLFW/glfw3.h>
+#include <string>
+#include <string_view>
+
+// Input for a player moving their paddle up and down the whole court.
+static hl::EventRecording scriptInput(uint64_t updates)
+{
+	constexpr uint64_t SweepUpdates = 90;
+
+	hl::EventRecorder recorder;
+	for (uint64_t update = 0; update < updates; ++update)
+	{
+		recorder.BeginUpdate(update);
+
+		if (update % SweepUpdates == 0)
+		{
+			const auto up = (update / SweepUpdates) % 2 == 0;
+			recorder.Record(hl::KeyReleaseEvent(up ? GLFW_KEY_S : GLFW_KEY_W));
+			recorder.Record(hl::KeyPressEvent(up ? GLFW_KEY_W : GLFW_KEY_S));
+		}
+
+		recorder.EndFrame();
+	}
+
+	return recorder.GetRecording();
+}
+
+class PointCounter : public hl::EventListener
+{
+public:
+	void OnEvent(const hl::Event& event) override
+	{
+		if (auto pse = dynamic_cast<const pong::PointScoredEvent*>(&event))
+		{
+			points[pse->GetPlayerNumber() == 1 ? 0 : 1]++;
+		}
+	}
+
+	int points[2]{};
+};
+
+// Computer paddles with nothing to hit, spread across the court and tracking
+// the ball like Paddle2 does, so the steering cost can be measured at scale.
+static void addAgents(hl::Scene& scene, int count)
+{
+	// A copy, adding entities can move Paddle2's components.
+	const auto paddle = *scene.getEntity("Paddle2")->GetComponent<hl::TrackAxisComponent>();
+	for (int i = 0; i < count; ++i)
+	{
+		auto agent = scene.addEntity();
+		auto [transform, tracker] = agent->AddComponents(hl::TransformComponent(), paddle);
+		transform->SetPosition(glm::vec3(
+			(float)(i % pong::PongConstants::GameBoundsWidth),
+			(float)(i % (pong::PongConstants::GameBoundsHeight - pong::PongConstants::PaddleHeight)),
+			0.0f));
+		tracker->ignoreReceding = i % 2 == 0;
+	}
+}
+
+class PongHeadless : public hl::HeadlessGame
+{
+protected:
+	int parseOption(std::string_view arg, const char* value) override
+	{
+		if (value != nullptr && arg == "--agents")
+		{
+			_agents = std::stoi(value);
+			return 2;
+		}
+		return 0;
+	}
+
+	std::string getOptionUsage() const override
+	{
+		return
+			"  --agents <n>        adds n computer paddles tracking the ball, which\n"
+			"                      the steering system moves every update\n";
+	}
+
+	void initialise(const hl::HeadlessOptions& /*options*/) override
+	{
+		pong::PongGameplay::addEntities(_scene);
+		addAgents(_scene, _agents);
+		pong::PongGameplay::addSystems(_scene, _eventBus, _inputManager);
+		pong::PongGameplay::resetRound(_scene);
+
+		_pointListener = _eventBus.AddScopedListener(&_counter);
+	}
+
+	hl::EventRecording scriptInput(uint64_t updates) override
+	{
+		return ::scriptInput(updates);
+	}
+
+	void update(uint64_t /*update*/, float /*delta*/) override
+	{
+		// The ball stops once someone scores, serve again straight away
+		// rather than waiting for enter like the game does.
+		if (_scene.getEntity("Ball")->GetComponent<hl::KinematicComponent>()->velocity == glm::vec3())
+		{
+			pong::PongGameplay::resetRound(_scene);
+		}
+	}
+
+	std::string getName() const override
+	{
+		return "Pong";
+	}
+
+	void report(std::ostream& stream) const override
+	{
+		stream << "Score " << _counter.points[0] << " - " << _counter.points[1] << std::endl;
+	}
+
+private:
+	int _agents{ 0 };
+	PointCounter _counter;
+	hl::EventSubscription _pointListener;
+};
+
+int main(int argc, char** argv)
+{
+	// Runs Pong's systems without a window or a device, --help lists the options.
+	PongHeadless game;
+	return game.run(argc, argv);
+}
@@ -15,6 +15,12 @@ namespace pong
 		glm::vec4 Color = glm::vec4(1.0, 0.0, 0.0, 1.0);
 		ControlledState ControlledState = ControlledState::NONE;
 		BrainType BrainType = BrainType::FOLLOW;
+
+		void checksum(hl::Checksum& checksum) const
+		{
+			checksum.add(ControlledState);
+			checksum.add(BrainType);
+		}
 	private:
 
 	};
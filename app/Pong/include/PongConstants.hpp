@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+
 namespace pong
 {
 
@@ -21,6 +23,15 @@ namespace pong
 		static constexpr const float PaddleMoveSpeedBase = 512.0f;
 	};
 
+	class PongCollisionLayers
+	{
+		PongCollisionLayers() = delete;
+	public:
+		static constexpr uint32_t Ball = 1 << 0;
+		static constexpr uint32_t Paddle = 1 << 1;
+		static constexpr uint32_t Wall = 1 << 2;
+	};
+
 	enum class ControlledState
 	{
 		NONE = 0,
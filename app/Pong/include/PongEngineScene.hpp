@@ -13,7 +13,6 @@ namespace pong
 		PongEngineScene(
 			hl::Engine& engine, 
 			const hl::EngineConfiguration& engineConfig);
-		~PongEngineScene();
 		void initialise(
 			const std::string& cameraMatrixResourceId,
 			hl::VulkanDevice& device,
@@ -36,6 +35,8 @@ namespace pong
 
 		int _player1Score{ 0 };
 		int _player2Score{ 0 };
+
+		hl::EventSubscription _eventListener;
 	};
 
 }
\ No newline at end of file
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <PongConstants.hpp>
+#include <helsinki/Engine/Scene/Scene.hpp>
+#include <helsinki/Engine/Input/InputManager.hpp>
+#include <helsinki/System/Events/EventBus.hpp>
+
+namespace pong
+{
+	// The parts of a game that need no window or device, shared by the game
+	// scene and the headless runner so both simulate the same game.
+	class PongGameplay
+	{
+		PongGameplay() = delete;
+	public:
+		// Adds the paddles, walls and ball.
+		static void addEntities(hl::Scene& scene);
+
+		// Has the paddle follow the ball the way the brain plays, through a
+		// TrackAxisComponent moved by the SteeringSystem.
+		static void setBrain(hl::Scene& scene, hl::Entity& paddle, BrainType brain);
+
+		// Centres the paddles and serves the ball from the middle.
+		static void resetRound(hl::Scene& scene);
+
+		// Adds the gameplay systems in the order they update.
+		static void addSystems(
+			hl::Scene& scene,
+			hl::EventBus& eventBus,
+			hl::InputManager& inputManager);
+	};
+}
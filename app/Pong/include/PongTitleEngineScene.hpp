@@ -13,7 +13,6 @@ namespace pong
 		PongTitleEngineScene(
 			hl::Engine& engine,
 			const hl::EngineConfiguration& engineConfig);
-		~PongTitleEngineScene();
 		void initialise(
 			const std::string& cameraMatrixResourceId,
 			hl::VulkanDevice& device,
@@ -32,7 +31,7 @@ namespace pong
 		void handleTextClicked(const std::string& name);
 	private:
 		const hl::EngineConfiguration& _engineConfig;
-
+		hl::EventSubscription _eventListener;
 	};
 
 }
\ No newline at end of file
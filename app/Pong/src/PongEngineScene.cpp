@@ -1,5 +1,6 @@
 #include "PongEngineScene.hpp"
 #include "PongTitleEngineScene.hpp"
+#include <PongGameplay.hpp>
 #include <helsinki/Renderer/Vulkan/VulkanVertex.hpp>
 #include <helsinki/Renderer/Vulkan/RenderGraph/MaterialPushConstantObject.hpp>
 #include <helsinki/Renderer/Resource/TextureResource.hpp>
@@ -17,13 +18,9 @@
 #include <EntityPushConstantObject.hpp>
 #include <helsinki/Renderer/Resource/VertexArrayResource.hpp>
 #include <Components/EntityComponent.hpp>
-#include <Systems/PaddlePlayerControlSystem.hpp>
-#include <Systems/PaddleComputerControlSystem.hpp>
-#include <Systems/BallMovementSystem.hpp>
 #include <Events/PointScoredEvent.hpp>
 #include <helsinki/System/glm.hpp>
 #include <GLFW/glfw3.h>
-#include <helsinki/Engine/ECS/Components/KinematicComponent.hpp>
 #include <helsinki/System/Events/KeyEvents.hpp>
 #include <helsinki/Renderer/Vulkan/RenderGraph/TextPushConstantObject.hpp>
 #include <helsinki/Engine/ECS/Components/TextComponent.hpp>
@@ -41,13 +38,7 @@ namespace pong
         _engineConfig(engineConfig)
     {
         _cameras.insert({ "Default", new hl::Camera2D() });
-        _engine.getEventBus().AddListener(this);
-    }
-
-
-    PongEngineScene::~PongEngineScene()
-    {
-        _engine.getEventBus().RemoveListener(this);
+        _eventListener = _engine.getEventBus().AddScopedListener(this);
     }
 
     void PongEngineScene::initialise(
@@ -208,55 +199,8 @@ namespace pong
                 { .pos = { 0.0f, (float)PongConstants::BallSize } },
             });
 
-        {
-            auto entity = _scene.addEntity("Paddle1");
-            entity->AddTag("ENTITY");
-            entity->AddTag("PADDLE");
-            entity->AddComponent<hl::TransformComponent>();
-            auto ec = entity->AddComponent<EntityComponent>();
-            ec->Color = glm::vec4(1.0f, 0.0f, 0.0f, 1.0f);
-            ec->VertexBufferResourceName = "paddle";
-            ec->ControlledState = ControlledState::PLAYER;
-        }
-        {
-            auto entity = _scene.addEntity("Paddle2");
-            entity->AddTag("ENTITY");
-            entity->AddTag("PADDLE");
-            entity->AddComponent<hl::TransformComponent>()->SetPosition(glm::vec3((float)(PongConstants::GameBoundsWidth - PongConstants::PaddleWidth), 0.0f, 0.0f));
-            auto ec = entity->AddComponent<EntityComponent>();
-            ec->Color = glm::vec4(0.0f, 1.0f, 0.0f, 1.0f);
-            ec->VertexBufferResourceName = "paddle";
-            ec->ControlledState = ControlledState::COMPUTER;
-            ec->BrainType = BrainType::LAZY;
-        }
-        {
-            auto entity = _scene.addEntity("WallTop");
-            entity->AddTag("ENTITY");
-            entity->AddTag("WALL");
-            entity->AddComponent<hl::TransformComponent>()->SetPosition(glm::vec3(0.0f, (float)(-PongConstants::GameBoundsWallWidth), 0.0f));
-            auto ec = entity->AddComponent<EntityComponent>();
-            ec->Color = glm::vec4(1.0f, 1.0f, 0.0f, 1.0f);
-            ec->VertexBufferResourceName = "wall";
-        }
-        {
-            auto entity = _scene.addEntity("WallBottom");
-            entity->AddTag("ENTITY");
-            entity->AddTag("WALL");
-            entity->AddComponent<hl::TransformComponent>()->SetPosition(glm::vec3(0.0f, (float)(PongConstants::GameBoundsHeight), 0.0f));
-            auto ec = entity->AddComponent<EntityComponent>();
-            ec->Color = glm::vec4(1.0f, 1.0f, 0.0f, 1.0f);
-            ec->VertexBufferResourceName = "wall";
-        }
-        {
-            auto entity = _scene.addEntity("Ball");
-            entity->AddTag("ENTITY");
-            entity->AddTag("BALL");
-            entity->AddComponent<hl::TransformComponent>();
-            entity->AddComponent<hl::KinematicComponent>();
-            auto ec = entity->AddComponent<EntityComponent>();
-            ec->Color = glm::vec4(0.0f, 0.0f, 1.0f, 1.0f);
-            ec->VertexBufferResourceName = "ball";
-        }
+        PongGameplay::addEntities(_scene);
+
         {
             auto entity = _scene.addEntity("score1");
             entity->AddTag("TEXT");
@@ -298,7 +242,7 @@ namespace pong
 
                     const auto& resource = _resourceManager->GetResource<hl::VertexArrayResource>(ec->VertexBufferResourceName);
 
-                    const auto& modelTransform = transform->GetTransformMatrix();
+                    const auto& modelTransform = pdd.scene->getWorldMatrix(*transform);
 
                     auto pc = EntityPushConstantObject
                     {
@@ -344,16 +288,10 @@ namespace pong
                 }
             });
 
-        _scene.addSystem(new BallMovementSystem(
-            _engine.getInputManager(), 
+        PongGameplay::addSystems(
+            _scene,
             _engine.getEventBus(),
-            this->_scene));
-        _scene.addSystem(new PaddlePlayerControlSystem(
-            _engine.getInputManager(),
-            this->_scene));
-        _scene.addSystem(new PaddleComputerControlSystem(
-            _engine.getInputManager(),
-            this->_scene));
+            _engine.getInputManager());
 
         _player1Score = 0;
         _player2Score = 0;
@@ -365,28 +303,7 @@ namespace pong
     {
         if (_state == GameState::INIT)
         {
-            auto paddle1 = _scene.getEntity("Paddle1");
-            auto paddle2 = _scene.getEntity("Paddle2");
-
-            auto tc1 = paddle1->GetComponent<hl::TransformComponent>();
-            tc1->SetPosition(glm::vec3(
-                tc1->GetPosition().x, 
-                (float)(PongConstants::GameBoundsHeight - PongConstants::PaddleHeight) / 2.0f, 
-                0.0f));
-
-            auto tc2 = paddle2->GetComponent<hl::TransformComponent>();
-            tc2->SetPosition(glm::vec3(
-                tc2->GetPosition().x, 
-                (float)(PongConstants::GameBoundsHeight - PongConstants::PaddleHeight) / 2.0f, 
-                0.0f));
-
-            auto ball = _scene.getEntity("Ball");
-            ball->GetComponent<hl::KinematicComponent>()->velocity = 4.0f * glm::vec3(64.0f, 64.0f, 0.0f);
-            auto btc = ball->GetComponent<hl::TransformComponent>();
-            btc->SetPosition(glm::vec3(
-                (float)(PongConstants::GameBoundsWidth - PongConstants::BallSize) / 2.0f,
-                (float)(PongConstants::GameBoundsHeight - PongConstants::BallSize) / 2.0f,
-                0.0f));
+            PongGameplay::resetRound(_scene);
 
             _state = GameState::PLAYING;
         }
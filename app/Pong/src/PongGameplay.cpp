@@ -0,0 +1,152 @@
+#include <PongGameplay.hpp>
+#include <PongConstants.hpp>
+#include <Components/EntityComponent.hpp>
+#include <Systems/PaddlePlayerControlSystem.hpp>
+#include <Systems/BallMovementSystem.hpp>
+#include <helsinki/Engine/ECS/Components/TransformComponent.hpp>
+#include <helsinki/Engine/ECS/Components/KinematicComponent.hpp>
+#include <helsinki/Engine/ECS/Components/ColliderComponent.hpp>
+#include <helsinki/Engine/Physics/PhysicsSystem.hpp>
+#include <helsinki/Engine/AI/SteeringSystem.hpp>
+#include <helsinki/System/glm.hpp>
+#include <limits>
+
+namespace pong
+{
+
+	void PongGameplay::addEntities(hl::Scene& scene)
+	{
+		{
+			auto entity = scene.addEntity("Paddle1");
+			entity->AddTag("ENTITY");
+			entity->AddTag("PADDLE");
+			auto [transform, ec, collider] = entity->AddComponents<hl::TransformComponent, EntityComponent, hl::ColliderComponent>();
+			ec->Color = glm::vec4(1.0f, 0.0f, 0.0f, 1.0f);
+			ec->VertexBufferResourceName = "paddle";
+			ec->ControlledState = ControlledState::PLAYER;
+			collider->size = glm::vec2((float)PongConstants::PaddleWidth, (float)PongConstants::PaddleHeight);
+			collider->layer = PongCollisionLayers::Paddle;
+			collider->mask = PongCollisionLayers::Ball;
+		}
+		{
+			auto entity = scene.addEntity("Paddle2");
+			entity->AddTag("ENTITY");
+			entity->AddTag("PADDLE");
+			auto [transform, ec, collider] = entity->AddComponents<hl::TransformComponent, EntityComponent, hl::ColliderComponent>();
+			transform->SetPosition(glm::vec3((float)(PongConstants::GameBoundsWidth - PongConstants::PaddleWidth), 0.0f, 0.0f));
+			ec->Color = glm::vec4(0.0f, 1.0f, 0.0f, 1.0f);
+			ec->VertexBufferResourceName = "paddle";
+			ec->ControlledState = ControlledState::COMPUTER;
+			collider->size = glm::vec2((float)PongConstants::PaddleWidth, (float)PongConstants::PaddleHeight);
+			collider->layer = PongCollisionLayers::Paddle;
+			collider->mask = PongCollisionLayers::Ball;
+		}
+		{
+			auto entity = scene.addEntity("WallTop");
+			entity->AddTag("ENTITY");
+			entity->AddTag("WALL");
+			auto [transform, ec, collider] = entity->AddComponents<hl::TransformComponent, EntityComponent, hl::ColliderComponent>();
+			transform->SetPosition(glm::vec3(0.0f, (float)(-PongConstants::GameBoundsWallWidth), 0.0f));
+			ec->Color = glm::vec4(1.0f, 1.0f, 0.0f, 1.0f);
+			ec->VertexBufferResourceName = "wall";
+			collider->size = glm::vec2((float)PongConstants::GameBoundsWidth, (float)PongConstants::GameBoundsWallWidth);
+			collider->layer = PongCollisionLayers::Wall;
+			collider->mask = PongCollisionLayers::Ball;
+		}
+		{
+			auto entity = scene.addEntity("WallBottom");
+			entity->AddTag("ENTITY");
+			entity->AddTag("WALL");
+			auto [transform, ec, collider] = entity->AddComponents<hl::TransformComponent, EntityComponent, hl::ColliderComponent>();
+			transform->SetPosition(glm::vec3(0.0f, (float)(PongConstants::GameBoundsHeight), 0.0f));
+			ec->Color = glm::vec4(1.0f, 1.0f, 0.0f, 1.0f);
+			ec->VertexBufferResourceName = "wall";
+			collider->size = glm::vec2((float)PongConstants::GameBoundsWidth, (float)PongConstants::GameBoundsWallWidth);
+			collider->layer = PongCollisionLayers::Wall;
+			collider->mask = PongCollisionLayers::Ball;
+		}
+		{
+			auto entity = scene.addEntity("Ball");
+			entity->AddTag("ENTITY");
+			entity->AddTag("BALL");
+			auto [transform, kinematic, ec, collider] = entity->AddComponents<hl::TransformComponent, hl::KinematicComponent, EntityComponent, hl::ColliderComponent>();
+			ec->Color = glm::vec4(0.0f, 0.0f, 1.0f, 1.0f);
+			ec->VertexBufferResourceName = "ball";
+			// Speeds up a little every time it bounces.
+			collider->size = glm::vec2((float)PongConstants::BallSize);
+			collider->layer = PongCollisionLayers::Ball;
+			collider->mask = PongCollisionLayers::Paddle | PongCollisionLayers::Wall;
+			collider->restitution = 1.1f;
+		}
+
+		setBrain(scene, *scene.getEntity("Paddle2"), BrainType::LAZY);
+	}
+
+	void PongGameplay::setBrain(hl::Scene& scene, hl::Entity& paddle, BrainType brain)
+	{
+		auto tracker = paddle.GetComponent<hl::TrackAxisComponent>();
+		if (tracker == nullptr)
+		{
+			tracker = paddle.AddComponent<hl::TrackAxisComponent>();
+		}
+
+		// Top edge to top edge, as the paddles have always lined up.
+		tracker->target = scene.getEntity("Ball")->Id;
+		tracker->axis = 1;
+		tracker->maxSpeed = PongConstants::PaddleMoveSpeedBase;
+		tracker->min = 0.0f;
+		tracker->max = (float)(PongConstants::GameBoundsHeight - PongConstants::PaddleHeight);
+		tracker->rest = PongConstants::GameBoundsHeight / 2.0f;
+
+		// Short sighted paddles cannot see a ball more than half the board away
+		// and head back to the middle, lazy ones wait for it to come back.
+		tracker->sightRange = brain == BrainType::SHORT_SIGHTED_CENTER
+			? PongConstants::GameBoundsWidth / 2.0f
+			: std::numeric_limits<float>::max();
+		tracker->ignoreReceding = brain == BrainType::LAZY;
+
+		paddle.GetComponent<EntityComponent>()->BrainType = brain;
+	}
+
+	void PongGameplay::resetRound(hl::Scene& scene)
+	{
+		auto paddle1 = scene.getEntity("Paddle1");
+		auto paddle2 = scene.getEntity("Paddle2");
+
+		auto tc1 = paddle1->GetComponent<hl::TransformComponent>();
+		tc1->SetPosition(glm::vec3(
+			tc1->GetPosition().x,
+			(float)(PongConstants::GameBoundsHeight - PongConstants::PaddleHeight) / 2.0f,
+			0.0f));
+
+		auto tc2 = paddle2->GetComponent<hl::TransformComponent>();
+		tc2->SetPosition(glm::vec3(
+			tc2->GetPosition().x,
+			(float)(PongConstants::GameBoundsHeight - PongConstants::PaddleHeight) / 2.0f,
+			0.0f));
+
+		auto ball = scene.getEntity("Ball");
+		ball->GetComponent<hl::KinematicComponent>()->velocity = 4.0f * glm::vec3(64.0f, 64.0f, 0.0f);
+		auto btc = ball->GetComponent<hl::TransformComponent>();
+		btc->SetPosition(glm::vec3(
+			(float)(PongConstants::GameBoundsWidth - PongConstants::BallSize) / 2.0f,
+			(float)(PongConstants::GameBoundsHeight - PongConstants::BallSize) / 2.0f,
+			0.0f));
+	}
+
+	void PongGameplay::addSystems(
+		hl::Scene& scene,
+		hl::EventBus& eventBus,
+		hl::InputManager& inputManager)
+	{
+		scene.addSystem(new hl::PhysicsSystem(scene));
+		scene.addSystem(new BallMovementSystem(
+			inputManager,
+			eventBus,
+			scene));
+		scene.addSystem(new PaddlePlayerControlSystem(
+			inputManager,
+			scene));
+		scene.addSystem(new hl::SteeringSystem(scene));
+	}
+}
@@ -24,12 +24,7 @@ namespace pong
 		_engineConfig(engineConfig)
 	{
         _cameras.insert({ "Default", new hl::Camera2D() });
-		_engine.getEventBus().AddListener(this);
-	}
-
-	PongTitleEngineScene::~PongTitleEngineScene()
-	{
-		_engine.getEventBus().RemoveListener(this);
+		_eventListener = _engine.getEventBus().AddScopedListener(this);
 	}
 
 	void PongTitleEngineScene::initialise(
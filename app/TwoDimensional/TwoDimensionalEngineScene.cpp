@@ -226,7 +226,7 @@ namespace td
                     const auto& transform = entity->GetComponent<hl::TransformComponent>();
                     const auto& sprite = entity->GetComponent<hl::SpriteComponent>();
 
-                    auto modelTransform = transform->GetTransformMatrix();
+                    auto modelTransform = pdd.scene->getWorldMatrix(*transform);
 
                     auto pc = hl::SpritePushConstantObject
                     {
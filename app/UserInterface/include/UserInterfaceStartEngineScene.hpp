@@ -13,7 +13,6 @@ namespace ui
 		UserInterfaceStartEngineScene(
 			hl::Engine& engine,
 			const hl::EngineConfiguration& engineConfig);
-		~UserInterfaceStartEngineScene();
 
 		void initialise(
 			const std::string& cameraMatrixResourceId,
@@ -36,6 +35,8 @@ namespace ui
 	private:
 		const hl::EngineConfiguration& _engineConfig;
 		hl::UiRoot _uiRoot;
+		// After _uiRoot so they are removed before it is destroyed.
+		std::vector<hl::EventSubscription> _eventSubscriptions;
 	};
 
 }
\ No newline at end of file
@@ -16,14 +16,8 @@ namespace ui
         _uiRoot(engine.getInputManager())
     {
         _cameras.insert({ "Default", new hl::Camera2D() });
-        _engine.getEventBus().AddListener(this);
-        _engine.getEventBus().AddListener(&_uiRoot);
-    }
-
-    UserInterfaceStartEngineScene::~UserInterfaceStartEngineScene()
-    {
-        _engine.getEventBus().RemoveListener(&_uiRoot);
-        _engine.getEventBus().RemoveListener(this);
+        _eventSubscriptions.push_back(_engine.getEventBus().AddScopedListener(this));
+        _eventSubscriptions.push_back(_engine.getEventBus().AddScopedListener(&_uiRoot));
     }
 
 
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <helsinki/Engine/ECS/System.hpp>
+#include <helsinki/Engine/ECS/Components/TransformComponent.hpp>
+#include <helsinki/Engine/ECS/Components/KinematicComponent.hpp>
+#include <helsinki/Engine/ECS/Components/PatrolComponent.hpp>
+#include <helsinki/Engine/ECS/Components/SeekComponent.hpp>
+#include <helsinki/Engine/ECS/Components/TrackAxisComponent.hpp>
+#include <helsinki/Engine/Scene/Scene.hpp>
+#include <vector>
+
+namespace hl
+{
+	// Moves every agent by the steering behaviour components it carries. Each
+	// behaviour is a pass over the packed chunks of the agents that have it,
+	// so what an agent does is decided by its components rather than by
+	// branching per agent, and adding agents costs a few loop iterations
+	// rather than a system or an entity lookup each.
+	//
+	// Agents' transforms are moved directly rather than through a
+	// KinematicComponent, so they can collide as static colliders the way a
+	// pong paddle does. Positions are used as they are, so agents are expected
+	// to have no parent. Targets are read as each pass reaches them, so one
+	// agent following another sees wherever it has got to so far this update.
+	class SteeringSystem : public System
+	{
+	public:
+		explicit SteeringSystem(Scene& scene);
+
+		void update(float delta) override;
+
+	private:
+		static constexpr uint32_t NoTarget = UINT32_MAX;
+
+		struct Target
+		{
+			int id{ EntityHandle::Invalid };
+			const TransformComponent* transform{ nullptr };
+			const KinematicComponent* kinematic{ nullptr };
+		};
+
+		// Each target is looked up through the scene once per pass, however the
+		// agents following it are ordered. The pointers are only kept for the
+		// pass, steering writes components but never adds, removes or moves
+		// entities, so the targets' rows stay where they are until it ends.
+		Target resolve(int id);
+		// Forgets the targets of the last pass, they may have moved or gone since.
+		void clearTargets();
+
+		void patrol(float delta);
+		void seek(float delta);
+		void trackAxis(float delta);
+
+	private:
+		Scene& _scene;
+		Query<TransformComponent, PatrolComponent> _patrollers;
+		Query<TransformComponent, SeekComponent> _seekers;
+		Query<TransformComponent, TrackAxisComponent> _trackers;
+		std::vector<Target> _targets;
+		// Index into _targets by the target's entity slot.
+		std::vector<uint32_t> _targetBySlot;
+	};
+}
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <helsinki/Engine/ECS/ComponentTypeInfo.hpp>
+#include <helsinki/Engine/ECS/TagRegistry.hpp>
+#include <helsinki/System/Utils/ObjectPool.hpp>
+#include <unordered_map>
+#include <array>
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+namespace hl
+{
+	class Entity;
+
+	// Fixed size block of memory holding a run of rows for one archetype.
+	// Layout is [Entity* x capacity][column 0 x capacity][column 1 x capacity]...
+	// The memory comes from, and is returned to, the owning ComponentStorage's
+	// chunk pool.
+	class ArchetypeChunk
+	{
+	public:
+		static constexpr size_t Size = 16 * 1024;
+		static constexpr size_t Alignment = 64;
+
+		explicit ArchetypeChunk(std::byte* data) : _data(data) {}
+
+		std::byte* getData() const { return _data; }
+		uint32_t getCount() const { return _count; }
+
+	private:
+		std::byte* _data;
+		uint32_t _count{ 0 };
+
+		friend class Archetype;
+	};
+
+	// All entities sharing exactly the same set of component types and tags.
+	// Each component type is packed contiguously per chunk, rows are kept dense
+	// across chunks so that every chunk except the last one is always full.
+	// Tags take no space in a row, they only split entities with the same
+	// components into separate archetypes so tagged queries match whole ones.
+	class Archetype
+	{
+	public:
+		Archetype(std::vector<const ComponentTypeInfo*> types, const TagMask& tags, PoolAllocator& chunkAllocator);
+		~Archetype();
+
+		Archetype(const Archetype&) = delete;
+		Archetype& operator=(const Archetype&) = delete;
+
+		const std::vector<size_t>& getSignature() const { return _signature; }
+		const std::vector<const ComponentTypeInfo*>& getTypes() const { return _types; }
+
+		const ComponentMask& getMask() const { return _mask; }
+		// Bit indices from the scene's TagRegistry.
+		const TagMask& getTags() const { return _tags; }
+		bool hasTag(uint32_t tagIndex) const { return _tags.test(tagIndex); }
+
+		// Both take the dense type index, see ComponentTypeIDSystem::GetTypeIndex.
+		bool hasComponent(uint32_t typeIndex) const { return _mask.test(typeIndex); }
+		int getColumnIndex(uint32_t typeIndex) const { return _columnsByTypeIndex[typeIndex]; }
+
+		uint32_t getEntityCount() const { return _count; }
+		uint32_t getChunkCapacity() const { return _chunkCapacity; }
+		size_t getChunkCount() const { return _chunks.size(); }
+		const ArchetypeChunk& getChunk(size_t index) const { return _chunks[index]; }
+
+		Entity** getEntities(const ArchetypeChunk& chunk) const
+		{
+			return reinterpret_cast<Entity**>(chunk.getData());
+		}
+		void* getColumn(const ArchetypeChunk& chunk, size_t column) const
+		{
+			return chunk.getData() + _columnOffsets[column];
+		}
+		template<typename T>
+		T* getColumn(const ArchetypeChunk& chunk, size_t column) const
+		{
+			return static_cast<T*>(getColumn(chunk, column));
+		}
+
+		Entity* getEntity(uint32_t row) const;
+		void* getComponent(uint32_t row, size_t column) const;
+
+		// Appends an uninitialised row, the caller must construct every column.
+		uint32_t allocateRow(Entity* entity);
+		// Destroys every component in the row and back fills it with the last row.
+		void destroyRow(uint32_t row);
+		// Back fills the row with the last row, the components in the row must
+		// already have been moved out or destroyed by the caller.
+		void releaseRow(uint32_t row);
+
+		std::unordered_map<size_t, Archetype*> addEdges;
+		std::unordered_map<size_t, Archetype*> removeEdges;
+		// As above for tags, keyed by their TagRegistry index.
+		std::unordered_map<uint32_t, Archetype*> addTagEdges;
+		std::unordered_map<uint32_t, Archetype*> removeTagEdges;
+
+	private:
+		const ArchetypeChunk& chunkForRow(uint32_t row) const { return _chunks[row / _chunkCapacity]; }
+
+	private:
+		std::vector<const ComponentTypeInfo*> _types;
+		std::vector<size_t> _signature;
+		ComponentMask _mask;
+		TagMask _tags;
+		std::array<int16_t, ComponentTypeIDSystem::MaxComponents> _columnsByTypeIndex;
+		std::vector<size_t> _columnOffsets;
+		PoolAllocator& _chunkAllocator;
+		std::vector<ArchetypeChunk> _chunks;
+		uint32_t _chunkCapacity{ 0 };
+		uint32_t _count{ 0 };
+	};
+}
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <helsinki/Engine/ECS/ComponentTypeInfo.hpp>
+#include <helsinki/Engine/ECS/EntityHandle.hpp>
+#include <helsinki/System/Utils/String.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace hl
+{
+	class Scene;
+	class EntityPool;
+
+	// Refers to either an existing entity or one created earlier in the same
+	// CommandBuffer, which only gets a real id when the buffer is played back.
+	struct DeferredEntity
+	{
+		static constexpr uint32_t NotCreated = UINT32_MAX;
+
+		DeferredEntity(int id) : id(id) {}
+
+		int id{ EntityHandle::Invalid };
+		uint32_t created{ NotCreated };
+
+	private:
+		DeferredEntity() = default;
+		friend class CommandBuffer;
+	};
+
+	// Records structural changes to a Scene so they can be made later in one pass
+	// from Scene::update(), rather than in the middle of iterating the scene.
+	// Systems get their own buffer while they update, see Scene::getCommandBuffer,
+	// so recording needs no locking. Pending components live in a block arena that
+	// is kept between frames, so steady state recording does not allocate.
+	class CommandBuffer
+	{
+	public:
+		CommandBuffer() = default;
+		~CommandBuffer();
+
+		CommandBuffer(const CommandBuffer&) = delete;
+		CommandBuffer& operator=(const CommandBuffer&) = delete;
+
+		DeferredEntity createEntity();
+		DeferredEntity createEntity(const std::string& name);
+		// Spawns an entity from the pool, see Scene::spawn.
+		DeferredEntity spawn(EntityPool& pool);
+		void destroyEntity(DeferredEntity entity);
+
+		// The returned component can be filled in until the buffer is played back.
+		// Adding a component the entity already has by then is ignored.
+		template<typename T, typename... Args>
+		T& addComponent(DeferredEntity entity, Args&&... args)
+		{
+			static_assert(std::is_base_of<Component, T>::value, "T must derive from Component");
+
+			const auto& type = ComponentTypeInfo::Get<T>();
+			auto component = new (allocate(type.size, type.alignment)) T(std::forward<Args>(args)...);
+			record(CommandType::AddComponent, entity, &type, component);
+			return *component;
+		}
+		// As addComponent, but replaces the value of a component the entity
+		// already has, e.g. to place an entity spawned from a pool.
+		template<typename T, typename... Args>
+		T& setComponent(DeferredEntity entity, Args&&... args)
+		{
+			static_assert(std::is_base_of<Component, T>::value, "T must derive from Component");
+
+			const auto& type = ComponentTypeInfo::Get<T>();
+			auto component = new (allocate(type.size, type.alignment)) T(std::forward<Args>(args)...);
+			record(CommandType::SetComponent, entity, &type, component);
+			return *component;
+		}
+		template<typename T>
+		void removeComponent(DeferredEntity entity)
+		{
+			record(CommandType::RemoveComponent, entity, &ComponentTypeInfo::Get<T>(), nullptr);
+		}
+
+		void addTag(DeferredEntity entity, const std::string& tag) { addTag(entity, String::fnv1a_32(tag)); }
+		void addTag(DeferredEntity entity, uint32_t tagHash);
+		void clearTag(DeferredEntity entity, const std::string& tag) { clearTag(entity, String::fnv1a_32(tag)); }
+		void clearTag(DeferredEntity entity, uint32_t tagHash);
+
+		bool empty() const { return _commands.empty(); }
+		size_t size() const { return _commands.size(); }
+
+		// Applies every command in the order it was recorded and clears the buffer.
+		// Commands for entities that no longer exist are dropped.
+		void playback(Scene& scene);
+		// Drops every command without applying it.
+		void clear();
+
+	private:
+		enum class CommandType : uint8_t
+		{
+			CreateEntity,
+			SpawnEntity,
+			DestroyEntity,
+			AddComponent,
+			SetComponent,
+			RemoveComponent,
+			AddTag,
+			ClearTag
+		};
+
+		struct Command
+		{
+			CommandType type;
+			DeferredEntity entity;
+			const ComponentTypeInfo* component;
+			void* data;
+			uint32_t value;
+		};
+
+		struct Block
+		{
+			std::byte* data;
+			size_t size;
+		};
+
+		void record(CommandType type, DeferredEntity entity, const ComponentTypeInfo* component, void* data, uint32_t value = 0);
+		void* allocate(size_t size, size_t alignment);
+		void destroyPending();
+
+	private:
+		static constexpr size_t BlockSize = 16 * 1024;
+		static constexpr size_t BlockAlignment = 64;
+
+		std::vector<Command> _commands;
+		std::vector<std::string> _names;
+		uint32_t _createdCount{ 0 };
+		std::vector<int> _createdIds;
+
+		std::vector<Block> _blocks;
+		size_t _block{ 0 };
+		size_t _offset{ 0 };
+	};
+}
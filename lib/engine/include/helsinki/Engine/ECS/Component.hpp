@@ -1,6 +1,7 @@
 #pragma once
 
 #include <helsinki/Engine/ECS/ComponentTypeIDSystem.hpp>
+#include <helsinki/System/Utils/Checksum.hpp>
 
 namespace hl
 {
@@ -22,6 +23,13 @@ namespace hl
         Entity* owner = nullptr;
 
     public:
+        Component() = default;
+        // Components are relocated by value when their entity changes archetype
+        Component(const Component&) = default;
+        Component(Component&&) noexcept = default;
+        Component& operator=(const Component&) = default;
+        Component& operator=(Component&&) noexcept = default;
+
         virtual ~Component()
         {
             if (state != State::Destroyed)
@@ -57,7 +65,7 @@ namespace hl
         Entity* GetOwner() const { return owner; }
 
         template<typename T>
-        static size_t GetTypeID()
+        static constexpr size_t GetTypeID()
         {
             return ComponentTypeIDSystem::GetTypeID<T>();
         }
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <helsinki/Engine/ECS/Archetype.hpp>
+#include <helsinki/Engine/ECS/Query.hpp>
+#include <initializer_list>
+#include <utility>
+
+namespace hl
+{
+	class Entity;
+
+	// Archetype based component storage owned by a Scene.
+	// Entities live in exactly one archetype at a time, adding or removing a
+	// component or a tag migrates the entity's row to the neighbouring archetype
+	// through a cached edge so the transition is O(1) after the first time it is
+	// seen.
+	class ComponentStorage
+	{
+	public:
+		ComponentStorage();
+		~ComponentStorage();
+
+		ComponentStorage(const ComponentStorage&) = delete;
+		ComponentStorage& operator=(const ComponentStorage&) = delete;
+
+		void createEntity(Entity& entity);
+		// Places the entity straight into the archetype with every component
+		// default constructed, rather than migrating it one component at a time.
+		void createEntity(Entity& entity, Archetype& archetype);
+		// As above with every component copied from the prototype for its
+		// column, prototypes must be in the archetype's column order.
+		void createEntity(Entity& entity, Archetype& archetype, const std::vector<const void*>& prototypes);
+		void destroyEntity(Entity& entity);
+		// Moves the source entity's row to an archetype with exactly the same
+		// components and hands it to the destination, which may be the source.
+		void moveEntity(Entity& source, Entity& destination, Archetype& target);
+
+		// Migrates the entity to the archetype including the given type and returns
+		// the uninitialised slot that the new component must be constructed in.
+		void* addComponent(Entity& entity, const ComponentTypeInfo& type);
+		// Migrates the entity once to the archetype including every given type,
+		// move constructing each one it lacks from the matching component. Types
+		// it already has keep their current component.
+		void addComponents(Entity& entity, std::initializer_list<const ComponentTypeInfo*> types, std::initializer_list<void*> components);
+		bool removeComponent(Entity& entity, const ComponentTypeInfo& type);
+		// Migrates the entity to the archetype with the same components that has,
+		// or does not have, the tag with the given TagRegistry index.
+		void setTag(Entity& entity, uint32_t tagIndex, bool value);
+
+		const std::vector<std::unique_ptr<Archetype>>& getArchetypes() const { return _archetypes; }
+		Archetype* getArchetype(std::vector<const ComponentTypeInfo*> types, const TagMask& tags = {}) { return getOrCreateArchetype(std::move(types), tags); }
+		// A twin of the archetype that no query ever matches and getArchetypes
+		// leaves out, where an EntityPool keeps the entities it has not spawned.
+		Archetype* getPoolArchetype(Archetype& archetype);
+		// Chunk memory is shared between all archetypes of the storage.
+		const PoolStats& getChunkStats() const { return _chunkAllocator.getStats(); }
+
+		// Returns the query for the given components, registering it the first time
+		// it is asked for. The returned handle stays valid for the storage lifetime.
+		template<typename... Ts>
+		Query<Ts...> query()
+		{
+			return Query<Ts...>(getOrCreateQuery({ ComponentTypeIDSystem::GetTypeIndex<Ts>()... }, false, 0));
+		}
+		// As above but only matching the archetypes of entities that also have the
+		// tag with the given TagRegistry index.
+		template<typename... Ts>
+		Query<Ts...> query(uint32_t tagIndex)
+		{
+			return Query<Ts...>(getOrCreateQuery({ ComponentTypeIDSystem::GetTypeIndex<Ts>()... }, true, tagIndex));
+		}
+
+		// Walks every entity that has all of the given components, handing the
+		// callback references straight into the packed chunk arrays.
+		// Structural changes (adding/removing components or entities) must not be
+		// made from inside the callback, use Scene::removeEntity to defer removal.
+		template<typename... Ts, typename F>
+		void forEach(F&& fn)
+		{
+			query<Ts...>().each(std::forward<F>(fn));
+		}
+
+	private:
+		Archetype* getOrCreateArchetype(std::vector<const ComponentTypeInfo*> types, const TagMask& tags);
+		Archetype* getAddTarget(Archetype* source, const ComponentTypeInfo& type);
+		Archetype* getRemoveTarget(Archetype* source, size_t typeId);
+		Archetype* getTagTarget(Archetype* source, uint32_t tagIndex, bool value);
+		const QueryState* getOrCreateQuery(std::vector<uint32_t> required, bool hasTag, uint32_t tag);
+
+	private:
+		struct SignatureHash
+		{
+			size_t operator()(const std::vector<size_t>& signature) const;
+		};
+
+		static constexpr size_t ChunksPerBlock = 8;
+
+		PoolAllocator _chunkAllocator{ ArchetypeChunk::Size, ArchetypeChunk::Alignment, ChunksPerBlock };
+		std::vector<std::unique_ptr<Archetype>> _archetypes;
+		std::unordered_map<std::vector<size_t>, Archetype*, SignatureHash> _archetypesBySignature;
+		std::unordered_map<const Archetype*, std::unique_ptr<Archetype>> _poolArchetypes;
+		std::vector<std::unique_ptr<QueryState>> _queries;
+		Archetype* _root{ nullptr };
+	};
+}
@@ -1,18 +1,59 @@
 #pragma once
 
+#include <helsinki/System/Utils/TypeId.hpp>
+#include <string_view>
+#include <cstddef>
+#include <cstdint>
+#include <bitset>
+
 namespace hl
 {
     class ComponentTypeIDSystem
     {
-    private:
-        static size_t nextTypeID;
-
     public:
+        // Upper bound on the number of distinct component types, keeps a
+        // component signature in a single machine word.
+        static constexpr size_t MaxComponents = 64;
+
+        // Stable id derived from the type name, see TypeId.
+        template<typename T>
+        static constexpr size_t GetTypeID()
+        {
+            return static_cast<size_t>(TypeId::Get<T>());
+        }
+
+        // Dense index used as the component's bit in a ComponentMask, handed out
+        // the first time a type is seen. Only meaningful within a process, use
+        // GetTypeID for anything that is persisted.
         template<typename T>
-        static size_t GetTypeID()
+        static uint32_t GetTypeIndex()
         {
-            static size_t typeID = nextTypeID++;
-            return typeID;
+            static const uint32_t index = RegisterType(GetTypeID<T>(), TypeId::Name<T>());
+            return index;
         }
+
+        static size_t GetRegisteredTypeCount();
+
+    private:
+        static uint32_t RegisterType(size_t typeId, std::string_view name);
     };
-}
\ No newline at end of file
+
+    using ComponentMask = std::bitset<ComponentTypeIDSystem::MaxComponents>;
+
+    template<typename... Ts>
+    const ComponentMask& GetComponentMask()
+    {
+        static const ComponentMask mask = []()
+            {
+                ComponentMask m;
+                (m.set(ComponentTypeIDSystem::GetTypeIndex<Ts>()), ...);
+                return m;
+            }();
+        return mask;
+    }
+
+    inline bool MaskContains(const ComponentMask& mask, const ComponentMask& required)
+    {
+        return (mask & required) == required;
+    }
+}
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <helsinki/Engine/ECS/Component.hpp>
+#include <helsinki/Engine/ECS/ComponentTypeIDSystem.hpp>
+#include <helsinki/System/Utils/Checksum.hpp>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace hl
+{
+	// Components with a
+	//
+	//  void checksum(Checksum& checksum) const;
+	//
+	// add the fields that make up their simulation state to Scene::checksum.
+	// Anything derived from other state, or only used for drawing, can be left out.
+	template<typename T>
+	concept ChecksummedComponent = requires(const T& component, Checksum& checksum)
+	{
+		component.checksum(checksum);
+	};
+
+	// Type erased description of a component type so archetypes can
+	// relocate and destroy packed component data without knowing T.
+	struct ComponentTypeInfo
+	{
+		size_t id;
+		uint32_t index;
+		size_t size;
+		size_t alignment;
+		// nullptr for components that are not default constructible.
+		void (*defaultConstruct)(void* destination);
+		void (*moveConstruct)(void* destination, void* source);
+		// nullptr for components that are not copyable, only needed by Prefab.
+		void (*copyConstruct)(void* destination, const void* source);
+		void (*copyAssign)(void* destination, const void* source);
+		void (*destruct)(void* component);
+		void (*setOwner)(void* component, Entity* owner);
+		// nullptr for components that do not add their state to scene checksums,
+		// see ChecksummedComponent.
+		void (*checksum)(const void* component, Checksum& checksum);
+
+		template<typename T>
+		static const ComponentTypeInfo& Get()
+		{
+			static const ComponentTypeInfo info
+			{
+				.id = ComponentTypeIDSystem::GetTypeID<T>(),
+				.index = ComponentTypeIDSystem::GetTypeIndex<T>(),
+				.size = sizeof(T),
+				.alignment = alignof(T),
+				.defaultConstruct = DefaultConstruct<T>(),
+				.moveConstruct = [](void* destination, void* source)
+				{
+					new (destination) T(std::move(*static_cast<T*>(source)));
+				},
+				.copyConstruct = CopyConstruct<T>(),
+				.copyAssign = CopyAssign<T>(),
+				.destruct = [](void* component)
+				{
+					static_cast<T*>(component)->~T();
+				},
+				.setOwner = [](void* component, Entity* owner)
+				{
+					static_cast<T*>(component)->SetOwner(owner);
+				},
+				.checksum = ChecksumOf<T>()
+			};
+
+			return info;
+		}
+
+	private:
+		template<typename T>
+		static constexpr void (*DefaultConstruct())(void*)
+		{
+			if constexpr (std::is_default_constructible_v<T>)
+			{
+				return [](void* destination) { new (destination) T(); };
+			}
+			else
+			{
+				return nullptr;
+			}
+		}
+
+		template<typename T>
+		static constexpr void (*CopyConstruct())(void*, const void*)
+		{
+			if constexpr (std::is_copy_constructible_v<T>)
+			{
+				return [](void* destination, const void* source) { new (destination) T(*static_cast<const T*>(source)); };
+			}
+			else
+			{
+				return nullptr;
+			}
+		}
+
+		template<typename T>
+		static constexpr void (*ChecksumOf())(const void*, Checksum&)
+		{
+			if constexpr (ChecksummedComponent<T>)
+			{
+				return [](const void* component, Checksum& checksum) { static_cast<const T*>(component)->checksum(checksum); };
+			}
+			else
+			{
+				return nullptr;
+			}
+		}
+
+		template<typename T>
+		static constexpr void (*CopyAssign())(void*, const void*)
+		{
+			if constexpr (std::is_copy_assignable_v<T>)
+			{
+				return [](void* destination, const void* source) { *static_cast<T*>(destination) = *static_cast<const T*>(source); };
+			}
+			else
+			{
+				return nullptr;
+			}
+		}
+	};
+}
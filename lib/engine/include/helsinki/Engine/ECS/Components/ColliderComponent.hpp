@@ -0,0 +1,48 @@
+#pragma once
+
+#include <helsinki/Engine/ECS/Component.hpp>
+#include <helsinki/Engine/Physics/Aabb.hpp>
+#include <helsinki/Engine/Physics/CollisionFilter.hpp>
+#include <helsinki/System/glm.hpp>
+#include <cstdint>
+
+namespace hl
+{
+	// A box the PhysicsSystem collides, placed relative to the entity's
+	// TransformComponent. Entities that also have a KinematicComponent move and
+	// bounce off the rest, which stay where they are put.
+	class ColliderComponent : public Component
+	{
+	public:
+		glm::vec2 size = glm::vec2(0.0f);
+		// From the transform's position to the box's min corner, use -size / 2
+		// for boxes centred on the entity.
+		glm::vec2 offset = glm::vec2(0.0f);
+
+		uint32_t layer = 1;
+		uint32_t mask = UINT32_MAX;
+
+		// Scales the velocity into a surface when bouncing off it, 0 stops the
+		// body dead and 1 keeps its speed.
+		float restitution = 1.0f;
+
+		Aabb getBounds(const glm::vec3& position) const
+		{
+			return Aabb::fromCorner(glm::vec2(position.x + offset.x, position.y + offset.y), size);
+		}
+
+		CollisionFilter getFilter() const
+		{
+			return CollisionFilter{ .layer = layer, .mask = mask };
+		}
+
+		void checksum(Checksum& checksum) const
+		{
+			checksum.add(size);
+			checksum.add(offset);
+			checksum.add(layer);
+			checksum.add(mask);
+			checksum.add(restitution);
+		}
+	};
+}
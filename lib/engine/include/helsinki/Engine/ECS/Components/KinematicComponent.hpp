@@ -10,5 +10,11 @@ namespace hl
 	public:
 		glm::vec3 velocity = glm::vec3();
 		glm::vec3 acceleration = glm::vec3();
+
+		void checksum(Checksum& checksum) const
+		{
+			checksum.add(velocity);
+			checksum.add(acceleration);
+		}
 	};
 }
\ No newline at end of file
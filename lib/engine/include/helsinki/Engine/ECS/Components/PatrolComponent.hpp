@@ -0,0 +1,27 @@
+#pragma once
+
+#include <helsinki/Engine/ECS/Component.hpp>
+#include <helsinki/System/glm.hpp>
+
+namespace hl
+{
+	// Walks back and forth between two points at speed, turning around as it
+	// reaches each end. Moved by the SteeringSystem.
+	class PatrolComponent : public Component
+	{
+	public:
+		glm::vec3 from = glm::vec3(0.0f);
+		glm::vec3 to = glm::vec3(0.0f);
+		float speed = 0.0f;
+		// Heading back towards from.
+		bool returning = false;
+
+		void checksum(Checksum& checksum) const
+		{
+			checksum.add(from);
+			checksum.add(to);
+			checksum.add(speed);
+			checksum.add(returning);
+		}
+	};
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <helsinki/Engine/ECS/Component.hpp>
+#include <helsinki/Engine/ECS/EntityHandle.hpp>
+#include <helsinki/System/glm.hpp>
+
+namespace hl
+{
+	// Heads straight for a point, or for another entity while target is set
+	// and still alive, at up to maxSpeed. Moved by the SteeringSystem.
+	class SeekComponent : public Component
+	{
+	public:
+		int target = EntityHandle::Invalid;
+		glm::vec3 point = glm::vec3(0.0f);
+		float maxSpeed = 0.0f;
+		// Slows down in proportion to the distance left once this close, so it
+		// eases in rather than arriving at full speed. 0 never slows.
+		float slowingRadius = 0.0f;
+
+		void checksum(Checksum& checksum) const
+		{
+			checksum.add(target);
+			checksum.add(point);
+			checksum.add(maxSpeed);
+			checksum.add(slowingRadius);
+		}
+	};
+}
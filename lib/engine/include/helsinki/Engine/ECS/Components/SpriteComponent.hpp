@@ -12,6 +12,8 @@ namespace hl
 		void setFrameDataIndex(int index) { _frameDataIndex = index; }
 		int getFrameDataIndex() const { return _frameDataIndex; }
 
+		void checksum(Checksum& checksum) const { checksum.add(_frameDataIndex); }
+
 	private:
 		int _frameDataIndex{ 0 };
 	};
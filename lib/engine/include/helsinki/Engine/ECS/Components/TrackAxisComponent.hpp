@@ -0,0 +1,47 @@
+#pragma once
+
+#include <helsinki/Engine/ECS/Component.hpp>
+#include <helsinki/Engine/ECS/EntityHandle.hpp>
+#include <cstdint>
+#include <limits>
+
+namespace hl
+{
+	// Follows another entity along one axis at up to maxSpeed, landing on its
+	// coordinate rather than overshooting it, the way a pong paddle tracks the
+	// ball. Moved by the SteeringSystem.
+	class TrackAxisComponent : public Component
+	{
+	public:
+		int target = EntityHandle::Invalid;
+		// 0, 1 or 2 for x, y or z.
+		uint32_t axis = 1;
+		float maxSpeed = 0.0f;
+		// Added to the target's coordinate, e.g. to line up centres.
+		float offset = 0.0f;
+		// Where the agent may go along the axis.
+		float min = std::numeric_limits<float>::lowest();
+		float max = std::numeric_limits<float>::max();
+
+		// A target further away than this, measured across the axis, is out of
+		// sight and the agent heads back to rest instead.
+		float sightRange = std::numeric_limits<float>::max();
+		float rest = 0.0f;
+		// Holds still while the target heads away across the axis, which needs
+		// the target to have a KinematicComponent.
+		bool ignoreReceding = false;
+
+		void checksum(Checksum& checksum) const
+		{
+			checksum.add(target);
+			checksum.add(axis);
+			checksum.add(maxSpeed);
+			checksum.add(offset);
+			checksum.add(min);
+			checksum.add(max);
+			checksum.add(sightRange);
+			checksum.add(rest);
+			checksum.add(ignoreReceding);
+		}
+	};
+}
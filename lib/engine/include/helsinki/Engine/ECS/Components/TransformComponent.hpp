@@ -1,33 +1,64 @@
 #pragma once
 
 #include <helsinki/Engine/ECS/Component.hpp>
+#include <helsinki/Engine/ECS/EntityHandle.hpp>
 #include <helsinki/System/glm.hpp>
 
 namespace hl
 {
+    // Position, rotation and scale are relative to the parent, if there is one.
+    // World matrices are computed for every transform in a scene by its
+    // TransformHierarchy, see Scene::getWorldMatrix.
 	class TransformComponent : public Component
     {
     public:
-        void SetPosition(const glm::vec3& pos);
+        static constexpr uint32_t NoWorldIndex = UINT32_MAX;
+
+        // Inline as integration sets the position of every moving entity.
+        void SetPosition(const glm::vec3& pos)
+        {
+            position = pos;
+            transformDirty = true;
+        }
 
         void SetRotation(const glm::vec3& rot);
 
         void SetScale(const glm::vec3& s);
 
+        // Parents are entity ids, the parent needs a TransformComponent of its own
+        // to have any effect. Pass EntityHandle::Invalid to detach.
+        void SetParent(int parentId);
+
         const glm::vec3& GetPosition() const { return position; }
         const glm::vec3& GetRotation() const { return rotation; }
         const glm::vec3& GetScale() const { return scale; }
+        int GetParent() const { return parent; }
 
+        // The local matrix, relative to the parent.
         glm::mat4 GetTransformMatrix() const;
 
+        // Position of this transform's matrix in the hierarchy's packed arrays,
+        // NoWorldIndex until the scene has been updated once.
+        uint32_t GetWorldIndex() const { return worldIndex; }
+
+        void checksum(Checksum& checksum) const
+        {
+            checksum.add(position);
+            checksum.add(rotation);
+            checksum.add(scale);
+            checksum.add(parent);
+        }
+
     private:
         glm::vec3 position = glm::vec3(0.0f);
         glm::vec3 rotation = glm::vec3(0.0f);
         glm::vec3 scale = glm::vec3(1.0f);
+        int parent = EntityHandle::Invalid;
 
-        // Cached transformation matrix
-        mutable glm::mat4 transformMatrix = glm::mat4(1.0f);
-        mutable bool transformDirty = true;
+        uint32_t worldIndex = NoWorldIndex;
+        bool transformDirty = true;
+        bool parentDirty = false;
 
+        friend class TransformHierarchy;
     };
-}
\ No newline at end of file
+}
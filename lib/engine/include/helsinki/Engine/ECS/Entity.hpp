@@ -1,102 +1,159 @@
 #pragma once
 
 #include <helsinki/Engine/ECS/Component.hpp>
-#include <unordered_map>
-#include <unordered_set>
+#include <helsinki/Engine/ECS/ComponentStorage.hpp>
+#include <helsinki/Engine/ECS/TagRegistry.hpp>
 #include <vector>
 #include <memory>
 #include <string>
+#include <tuple>
+#include <type_traits>
+#include <cstdint>
 
 namespace hl
 {
+    class EntityPool;
+
+    struct EntityLocation
+    {
+        Archetype* archetype{ nullptr };
+        uint32_t row{ 0 };
+    };
+
+    // Components are stored by value in the scene's archetype chunks, so a
+    // pointer returned from AddComponent/GetComponent is only valid until the
+    // next structural change (component added/removed) to this entity, or until
+    // entities are removed from the scene. Tags are part of the entity's
+    // archetype, so adding or clearing one is a structural change too. Use
+    // AddComponents to build an entity up and keep hold of every component it
+    // was given.
     class Entity
     {
     public:
-        Entity(int id) : Id(id) {}
+        Entity(int id, ComponentStorage& storage, TagRegistry& tagRegistry) : Id(id), _storage(storage), _tagRegistry(tagRegistry) {}
+
+        Entity(const Entity&) = delete;
+        Entity& operator=(const Entity&) = delete;
 
+        // Generational handle assigned by the owning Scene, see EntityHandle.
         const int Id;
 
-        void setName(const std::string& name) { _name = name; }
         const std::string& getName() const { return _name; }
 
+        // Tags can be given by name or by their precomputed hash, "PLAYER"_hash
+        // is the same tag as "PLAYER" without hashing the string at runtime.
         void AddTag(const std::string& tag);
+        void AddTag(uint32_t tagHash);
         void ClearTag(const std::string& tag);
+        void ClearTag(uint32_t tagHash);
         bool HasTag(const std::string& tag) const;
+        bool HasTag(uint32_t tagHash) const;
+        // Tag bit index from the scene's TagRegistry.
+        bool HasTagIndex(uint32_t tagIndex) const { return _tags.test(tagIndex); }
+        const TagMask& getTags() const { return _tags; }
 
         template<typename T, typename... Args>
         T* AddComponent(Args&&... args)
         {
             static_assert(std::is_base_of<Component, T>::value, "T must derive from Component");
 
-            size_t typeID = Component::GetTypeID<T>();
-
             // Check if component of this type already exists
-            auto it = _componentMap.find(typeID);
-            if (it != _componentMap.end())
+            if (auto existing = GetComponent<T>(); existing != nullptr)
             {
-                return static_cast<T*>(it->second);
+                return existing;
             }
 
-            // Create new component
-            auto component = std::make_unique<T>(std::forward<Args>(args)...);
-            T* componentPtr = component.get();
-            _componentMap[typeID] = componentPtr;
-            _components.push_back(std::move(component));
-            return componentPtr;
+            // Construct before migrating so a throwing constructor leaves the entity untouched
+            T component(std::forward<Args>(args)...);
+            component.SetOwner(this);
+
+            void* slot = _storage.addComponent(*this, ComponentTypeInfo::Get<T>());
+            return new (slot) T(std::move(component));
+        }
+
+        // Adds several components with a single move to the archetype that has
+        // them all, so unlike a run of AddComponent calls the returned pointers
+        // are valid together. As with AddComponent, a component the entity
+        // already has is kept and the one given for it discarded.
+        //     auto [transform, sprite] = entity->AddComponents(TransformComponent(), SpriteComponent());
+        template<typename... Ts>
+        std::tuple<Ts*...> AddComponents(Ts... components)
+        {
+            static_assert((std::is_base_of<Component, Ts>::value && ...), "Ts must derive from Component");
+
+            // The components are already constructed, so nothing can throw part way through the move.
+            _storage.addComponents(*this, { &ComponentTypeInfo::Get<Ts>()... }, { static_cast<void*>(&components)... });
+            return { GetComponent<Ts>()... };
+        }
+
+        // As above with every component default constructed.
+        template<typename... Ts>
+            requires (sizeof...(Ts) > 0) && (std::is_default_constructible_v<Ts> && ...)
+        std::tuple<Ts*...> AddComponents()
+        {
+            return AddComponents<Ts...>(Ts()...);
         }
 
         template<typename T>
         T* GetComponent() const
         {
-            size_t typeID = Component::GetTypeID<T>();
-            auto it = _componentMap.find(typeID);
-            if (it != _componentMap.end())
+            const int column = _location.archetype->getColumnIndex(ComponentTypeIDSystem::GetTypeIndex<T>());
+            if (column < 0)
             {
-                return static_cast<T*>(it->second);
+                return nullptr;
             }
 
-            return nullptr;
+            return static_cast<T*>(_location.archetype->getComponent(_location.row, (size_t)column));
         }
 
 
+        // A single test of the entity's archetype signature against the mask of Args.
         template<typename... Args>
         bool HasComponents() const
         {
-            return (HasComponent<Args>() && ...);
+            return MaskContains(_location.archetype->getMask(), GetComponentMask<Args...>());
         }
 
         template<typename T>
         bool HasComponent() const
         {
-            return GetComponent<T>() != nullptr;
+            return _location.archetype->hasComponent(ComponentTypeIDSystem::GetTypeIndex<T>());
         }
 
         template<typename T>
         bool RemoveComponent()
         {
-            size_t typeID = Component::GetTypeID<T>();
-            auto it = _componentMap.find(typeID);
-            if (it != _componentMap.end())
-            {
-                Component* componentPtr = it->second;
-                _componentMap.erase(it);
-
-                for (auto compIt = _components.begin(); compIt != _components.end(); ++compIt)
-                {
-                    if (compIt->get() == componentPtr)
-                    {
-                        _components.erase(compIt);
-                        return true;
-                    }
-                }
-            }
-            return false;
+            return _storage.removeComponent(*this, ComponentTypeInfo::Get<T>());
         }
 
+        const EntityLocation& getLocation() const { return _location; }
+
+    private:
+        // Names are indexed by the owning Scene, so they are only set through Scene::addEntity.
+        void setName(const std::string& name) { _name = name; }
+        // Tag bit index from the scene's TagRegistry.
+        void addTagIndex(uint32_t tagIndex);
+
+        // Type erased add/remove used when playing back a CommandBuffer, the
+        // component is moved out of the given memory which is then left destroyed.
+        void adoptComponent(const ComponentTypeInfo& type, void* component);
+        // As adoptComponent, but moves over the component the entity already has.
+        void replaceComponent(const ComponentTypeInfo& type, void* component);
+        bool removeComponent(const ComponentTypeInfo& type);
+
     private:
         std::string _name;
-        std::vector<std::unique_ptr<Component>> _components;
-        std::unordered_map<size_t, Component*> _componentMap;
-        std::unordered_set<uint32_t> tags;
+        ComponentStorage& _storage;
+        TagRegistry& _tagRegistry;
+        EntityLocation _location;
+        TagMask _tags;
+        // Set for entities spawned from a pool, which removal returns them to.
+        EntityPool* _pool{ nullptr };
+
+        friend class Archetype;
+        friend class ComponentStorage;
+        friend class Scene;
+        friend class CommandBuffer;
+        friend class SceneSerializer;
     };
-}
\ No newline at end of file
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdint>
+
+namespace hl
+{
+	// Entity ids are 32 bit handles packing a slot index with the generation of
+	// that slot. Reusing a slot bumps its generation, so an id held on to after
+	// its entity was removed no longer resolves instead of aliasing a new entity.
+	struct EntityHandle
+	{
+		static constexpr uint32_t IndexBits = 20;
+		static constexpr uint32_t GenerationBits = 32 - IndexBits;
+		static constexpr uint32_t IndexMask = (1u << IndexBits) - 1;
+		static constexpr uint32_t GenerationMask = (1u << GenerationBits) - 1;
+		static constexpr uint32_t MaxEntities = IndexMask + 1;
+
+		static constexpr int Invalid = 0;
+
+		static constexpr int make(uint32_t index, uint32_t generation)
+		{
+			return static_cast<int>(((generation & GenerationMask) << IndexBits) | (index & IndexMask));
+		}
+		static constexpr uint32_t index(int handle)
+		{
+			return static_cast<uint32_t>(handle) & IndexMask;
+		}
+		static constexpr uint32_t generation(int handle)
+		{
+			return (static_cast<uint32_t>(handle) >> IndexBits) & GenerationMask;
+		}
+		// Generation 0 is never handed out so that no valid handle equals Invalid.
+		static constexpr uint32_t nextGeneration(uint32_t generation)
+		{
+			const auto next = (generation + 1) & GenerationMask;
+			return next == 0 ? 1 : next;
+		}
+	};
+}
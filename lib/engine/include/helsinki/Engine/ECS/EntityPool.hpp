@@ -0,0 +1,52 @@
+#pragma once
+
+#include <helsinki/Engine/ECS/Entity.hpp>
+#include <helsinki/Engine/ECS/Prefab.hpp>
+#include <helsinki/System/Utils/ObjectPool.hpp>
+#include <helsinki/System/Utils/NonCopyable.hpp>
+#include <vector>
+
+namespace hl
+{
+	struct EntityPoolStats
+	{
+		// Entities the pool holds, whether spawned or waiting to be.
+		size_t capacity{ 0 };
+		size_t active{ 0 };
+		size_t peak{ 0 };
+		size_t spawns{ 0 };
+		// Entities created because every one the pool had was already spawned.
+		// Once this stops growing spawning no longer builds entities at all.
+		size_t grows{ 0 };
+	};
+
+	// Entities built from a Prefab ahead of time and kept by a Scene, see
+	// Scene::createPool. Waiting entities sit in an archetype of their own that
+	// no query matches, spawning one moves its row into the prefab's archetype,
+	// copies the prototypes over its components and gives it the prefab's tags
+	// by their registry index. Removing a spawned entity with Scene::removeEntity
+	// returns it to the pool rather than destroying it.
+	class EntityPool : NonCopyable
+	{
+	public:
+		const Prefab& getPrefab() const { return _prefab; }
+		const EntityPoolStats& getStats() const { return _stats; }
+		size_t getAvailable() const { return _waiting.size(); }
+
+	private:
+		explicit EntityPool(Prefab prefab) : _prefab(std::move(prefab)) {}
+
+	private:
+		Prefab _prefab;
+		Archetype* _archetype{ nullptr };
+		Archetype* _waitingArchetype{ nullptr };
+		// In the archetype's column order.
+		std::vector<const void*> _prototypes;
+		// TagRegistry indices of the prefab's tags.
+		std::vector<uint32_t> _tags;
+		std::vector<ObjectPool<Entity>::Pointer> _waiting;
+		EntityPoolStats _stats;
+
+		friend class Scene;
+	};
+}
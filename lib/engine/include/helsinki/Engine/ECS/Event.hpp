@@ -1,9 +0,0 @@
-#pragma once
-
-namespace hl
-{
-	class Event
-	{
-		public virtual ~Event() = default;
-	};
-}
\ No newline at end of file
@@ -1,11 +0,0 @@
-#pragma once
-
-namespace hl
-{
-    class EventListener
-    {
-    public:
-        virtual ~EventListener() = default;
-        virtual void OnEvent(const Event& event) = 0;
-    };
-}
\ No newline at end of file
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <helsinki/Engine/ECS/ComponentTypeInfo.hpp>
+#include <helsinki/System/Utils/String.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace hl
+{
+	// Template for entities spawned from an EntityPool, the tags they carry and
+	// the value every one of their components starts with. Components must be
+	// copyable, each spawn copies the prototypes into the pooled entity.
+	class Prefab
+	{
+	public:
+		Prefab() = default;
+
+		Prefab(Prefab&&) noexcept = default;
+		Prefab& operator=(Prefab&&) noexcept = default;
+		Prefab(const Prefab&) = delete;
+		Prefab& operator=(const Prefab&) = delete;
+
+		Prefab& addTag(const std::string& tag) { return addTag(String::fnv1a_32(tag)); }
+		Prefab& addTag(uint32_t tagHash);
+
+		// The returned prototype can be filled in until the prefab is given to
+		// Scene::createPool. Adding a component the prefab already has returns
+		// the existing prototype, as Entity::AddComponent does.
+		template<typename T, typename... Args>
+		T& addComponent(Args&&... args)
+		{
+			static_assert(std::is_base_of<Component, T>::value, "T must derive from Component");
+			static_assert(std::is_copy_constructible_v<T> && std::is_copy_assignable_v<T>, "Prefab components must be copyable");
+
+			const auto& type = ComponentTypeInfo::Get<T>();
+			if (auto existing = find(type); existing != nullptr)
+			{
+				return *static_cast<T*>(existing);
+			}
+
+			auto memory = ::operator new(sizeof(T), std::align_val_t{ alignof(T) });
+			try
+			{
+				new (memory) T(std::forward<Args>(args)...);
+			}
+			catch (...)
+			{
+				::operator delete(memory, std::align_val_t{ alignof(T) });
+				throw;
+			}
+
+			auto& component = _components.emplace_back(memory, PrototypeDeleter{ &type });
+			return *static_cast<T*>(component.get());
+		}
+
+		const std::vector<uint32_t>& getTags() const { return _tags; }
+
+		std::vector<const ComponentTypeInfo*> getTypes() const;
+		// nullptr when the prefab does not have the component.
+		const void* getPrototype(const ComponentTypeInfo& type) const { return find(type); }
+
+	private:
+		struct PrototypeDeleter
+		{
+			const ComponentTypeInfo* type;
+
+			void operator()(void* component) const
+			{
+				type->destruct(component);
+				::operator delete(component, std::align_val_t{ type->alignment });
+			}
+		};
+
+		void* find(const ComponentTypeInfo& type) const;
+
+	private:
+		std::vector<uint32_t> _tags;
+		std::vector<std::unique_ptr<void, PrototypeDeleter>> _components;
+	};
+}
@@ -0,0 +1,224 @@
+#pragma once
+
+#include <helsinki/Engine/ECS/Archetype.hpp>
+#include <helsinki/Engine/ECS/ComponentTypeIDSystem.hpp>
+#include <array>
+#include <tuple>
+#include <utility>
+#include <iterator>
+
+namespace hl
+{
+	class Entity;
+
+	// Shared state of a registered query, owned by the ComponentStorage.
+	// The storage appends every archetype that is created after registration and
+	// matches the required components and tag, so the list never needs to be
+	// rebuilt. Tags are part of an archetype, so every row of a matched archetype
+	// is a match.
+	struct QueryState
+	{
+		// Dense type indices of the required components, in the order they were asked for.
+		std::vector<uint32_t> required;
+		ComponentMask requiredMask;
+		// Bit index in the scene's TagRegistry.
+		uint32_t tag{ 0 };
+		bool hasTag{ false };
+
+		std::vector<Archetype*> archetypes;
+		// Column index of each required component, required.size() entries per archetype.
+		std::vector<uint32_t> columns;
+
+		bool matches(const Archetype& archetype) const
+		{
+			return MaskContains(archetype.getMask(), requiredMask) && (!hasTag || archetype.hasTag(tag));
+		}
+
+		void add(Archetype* archetype)
+		{
+			archetypes.push_back(archetype);
+			for (const auto index : required)
+			{
+				columns.push_back((uint32_t)archetype->getColumnIndex(index));
+			}
+		}
+	};
+
+	// Non allocating forward range over the entities matched by a query.
+	class QueryView
+	{
+	public:
+		class Iterator
+		{
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using value_type = Entity*;
+			using difference_type = std::ptrdiff_t;
+			using pointer = Entity* const*;
+			using reference = Entity*;
+
+			Iterator() = default;
+			Iterator(const QueryState* state, size_t archetype) :
+				_state(state),
+				_archetype(archetype)
+			{
+				skipToMatch();
+			}
+
+			Entity* operator*() const
+			{
+				return _state->archetypes[_archetype]->getEntity(_row);
+			}
+
+			Iterator& operator++()
+			{
+				_row++;
+				skipToMatch();
+				return *this;
+			}
+			Iterator operator++(int)
+			{
+				auto copy = *this;
+				++(*this);
+				return copy;
+			}
+
+			bool operator==(const Iterator& other) const
+			{
+				return _archetype == other._archetype && _row == other._row;
+			}
+
+		private:
+			void skipToMatch()
+			{
+				while (_archetype < _state->archetypes.size())
+				{
+					if (_row < _state->archetypes[_archetype]->getEntityCount())
+					{
+						return;
+					}
+
+					_archetype++;
+					_row = 0;
+				}
+			}
+
+		private:
+			const QueryState* _state{ nullptr };
+			size_t _archetype{ 0 };
+			uint32_t _row{ 0 };
+		};
+
+		explicit QueryView(const QueryState* state) : _state(state) {}
+
+		Iterator begin() const { return Iterator(_state, 0); }
+		Iterator end() const { return Iterator(_state, _state->archetypes.size()); }
+
+		bool empty() const { return begin() == end(); }
+
+	private:
+		const QueryState* _state;
+	};
+
+	// Cheap handle to a query registered with a Scene, keep it around (e.g. as a
+	// system member) and iterate it every frame. Iteration only visits archetypes
+	// that contain every component in Ts..., and the tag if it has one, so the
+	// cost follows the number of matches rather than the number of entities in
+	// the scene.
+	template<typename... Ts>
+	class Query
+	{
+	public:
+		Query() = default;
+		explicit Query(const QueryState* state) : _state(state) {}
+
+		QueryView entities() const { return QueryView(_state); }
+		QueryView::Iterator begin() const { return entities().begin(); }
+		QueryView::Iterator end() const { return entities().end(); }
+
+		// One addition per matched archetype.
+		size_t size() const
+		{
+			size_t count = 0;
+			for (const auto archetype : _state->archetypes)
+			{
+				count += archetype->getEntityCount();
+			}
+			return count;
+		}
+
+		bool empty() const { return begin() == end(); }
+
+		// Calls fn(Entity&, Ts&...) for every match with references straight into
+		// the packed chunk arrays. Structural changes must not be made from inside
+		// the callback, use Scene::removeEntity to defer removal.
+		template<typename F>
+		void each(F&& fn) const
+		{
+			eachImpl(fn, std::index_sequence_for<Ts...>{});
+		}
+
+		// Calls fn(Entity**, Ts*..., uint32_t count) once per chunk with the packed
+		// arrays themselves, for systems that want a tight loop over every row.
+		template<typename F>
+		void eachChunk(F&& fn) const
+		{
+			eachChunkImpl(fn, std::index_sequence_for<Ts...>{});
+		}
+
+	private:
+		template<typename F, size_t... I>
+		void eachChunkImpl(F& fn, std::index_sequence<I...>) const
+		{
+			const auto& archetypes = _state->archetypes;
+			for (size_t a = 0; a < archetypes.size(); ++a)
+			{
+				const auto archetype = archetypes[a];
+				[[maybe_unused]] const uint32_t* columns = _state->columns.data() + a * sizeof...(Ts);
+
+				for (size_t c = 0; c < archetype->getChunkCount(); ++c)
+				{
+					const auto& chunk = archetype->getChunk(c);
+					if (chunk.getCount() == 0)
+					{
+						continue;
+					}
+
+					fn(archetype->getEntities(chunk), archetype->template getColumn<Ts>(chunk, columns[I])..., chunk.getCount());
+				}
+			}
+		}
+
+		template<typename F, size_t... I>
+		void eachImpl(F& fn, std::index_sequence<I...>) const
+		{
+			const auto& archetypes = _state->archetypes;
+			for (size_t a = 0; a < archetypes.size(); ++a)
+			{
+				const auto archetype = archetypes[a];
+				if (archetype->getEntityCount() == 0)
+				{
+					continue;
+				}
+
+				[[maybe_unused]] const uint32_t* columns = _state->columns.data() + a * sizeof...(Ts);
+
+				for (size_t c = 0; c < archetype->getChunkCount(); ++c)
+				{
+					const auto& chunk = archetype->getChunk(c);
+					const auto count = chunk.getCount();
+					Entity** entities = archetype->getEntities(chunk);
+					std::tuple<Ts*...> arrays{ archetype->template getColumn<Ts>(chunk, columns[I])... };
+
+					for (uint32_t row = 0; row < count; ++row)
+					{
+						fn(*entities[row], std::get<I>(arrays)[row]...);
+					}
+				}
+			}
+		}
+
+	private:
+		const QueryState* _state{ nullptr };
+	};
+}
@@ -4,14 +4,94 @@
 
 namespace hl
 {
+	// The components a system touches, used by the SystemScheduler to decide
+	// which systems may run at the same time. Two accesses to the same component
+	// overlap when either of them writes it. Access is per component and not per
+	// tag, an entity can carry any number of tags so systems querying different
+	// tags can still reach the same rows.
+	class SystemAccess
+	{
+	public:
+		struct Entry
+		{
+			size_t typeId;
+			bool write;
+		};
+
+		template<typename... Ts>
+		SystemAccess& reads()
+		{
+			(add(ComponentTypeIDSystem::GetTypeID<Ts>(), false), ...);
+			return *this;
+		}
+		template<typename... Ts>
+		SystemAccess& writes()
+		{
+			(add(ComponentTypeIDSystem::GetTypeID<Ts>(), true), ...);
+			return *this;
+		}
+
+		// Systems are exclusive until they declare their access, exclusive systems
+		// run on the updating thread with no other system running alongside them.
+		bool isExclusive() const { return _exclusive; }
+		const std::vector<Entry>& getEntries() const { return _entries; }
+
+		bool conflictsWith(const SystemAccess& other) const
+		{
+			if (_exclusive || other._exclusive)
+			{
+				return true;
+			}
+
+			for (const auto& lhs : _entries)
+			{
+				for (const auto& rhs : other._entries)
+				{
+					if (lhs.typeId == rhs.typeId && (lhs.write || rhs.write))
+					{
+						return true;
+					}
+				}
+			}
+
+			return false;
+		}
+
+	private:
+		void add(size_t typeId, bool write)
+		{
+			_exclusive = false;
+			_entries.push_back(Entry
+				{
+					.typeId = typeId,
+					.write = write
+				});
+		}
+
+	private:
+		bool _exclusive{ true };
+		std::vector<Entry> _entries;
+	};
 
 	class System
 	{
 	public:
+		virtual ~System() = default;
+
 		virtual void update(float delta) = 0;
 
-	private:
+		const SystemAccess& getAccess() const { return _access; }
 
+	protected:
+		// Declare the components the system reads and writes, typically from the
+		// constructor. Systems that declare access may be updated off the main
+		// thread concurrently with systems they do not conflict with, so they must
+		// record structural changes through Scene::getCommandBuffer() rather than
+		// make them directly (Scene::removeEntity is safe).
+		SystemAccess& access() { return _access; }
+
+	private:
+		SystemAccess _access;
 	};
 
-}
\ No newline at end of file
+}
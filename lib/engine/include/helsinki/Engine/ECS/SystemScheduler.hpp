@@ -0,0 +1,82 @@
+#pragma once
+
+#include <helsinki/Engine/ECS/System.hpp>
+#include <helsinki/Engine/ECS/CommandBuffer.hpp>
+#include <helsinki/System/Utils/ThreadPool.hpp>
+#include <condition_variable>
+#include <exception>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+#include <mutex>
+
+namespace hl
+{
+	struct SystemTiming
+	{
+		std::string name;
+		double milliseconds{ 0.0 };
+	};
+
+	// Updates systems in registration order, except that consecutive systems that
+	// declare non conflicting access are run concurrently on a thread pool.
+	// A system always runs after every earlier system it conflicts with, so the
+	// outcome matches a serial update. Exclusive systems run on the calling thread.
+	class SystemScheduler
+	{
+	public:
+		void update(const std::vector<std::unique_ptr<System>>& systems, float delta);
+
+		// Defaults to ThreadPool::getShared(), nullptr restores the default.
+		void setThreadPool(ThreadPool* pool) { _pool = pool; }
+		void setParallel(bool parallel) { _parallel = parallel; }
+
+		// Timings of the last update, indexed in registration order.
+		const std::vector<SystemTiming>& getTimings() const { return _timings; }
+		// Wall time of the last update, compare against the sum of the system
+		// timings to see how much running systems concurrently saved.
+		double getLastUpdateMilliseconds() const { return _lastUpdateMilliseconds; }
+
+		// Every system records into its own command buffer while it updates, these
+		// are in registration order so playing them back in turn is deterministic.
+		const std::vector<std::unique_ptr<CommandBuffer>>& getCommandBuffers() const { return _commandBuffers; }
+		// The buffer of the system being updated on the calling thread, if any.
+		static CommandBuffer* getCurrentCommandBuffer();
+
+	private:
+		struct Batch
+		{
+			size_t first;
+			size_t last;
+		};
+
+		struct BatchState
+		{
+			std::atomic<size_t> outstanding{ 0 };
+			std::mutex mutex;
+			std::condition_variable done;
+			std::exception_ptr exception;
+		};
+
+		void rebuild(const std::vector<std::unique_ptr<System>>& systems);
+		void runBatch(const std::vector<std::unique_ptr<System>>& systems, const Batch& batch, float delta);
+		void runSystem(const std::vector<std::unique_ptr<System>>& systems, size_t index, float delta);
+		void runScheduled(const std::vector<std::unique_ptr<System>>& systems, size_t index, float delta, BatchState& state);
+
+	private:
+		ThreadPool* _pool{ nullptr };
+		bool _parallel{ true };
+
+		size_t _builtFor{ 0 };
+		std::vector<Batch> _batches;
+		// Later systems in the same batch that must wait for each system.
+		std::vector<std::vector<size_t>> _dependents;
+		std::vector<uint32_t> _dependencyCount;
+		std::unique_ptr<std::atomic<uint32_t>[]> _remaining;
+		std::vector<std::unique_ptr<CommandBuffer>> _commandBuffers;
+
+		std::vector<SystemTiming> _timings;
+		double _lastUpdateMilliseconds{ 0.0 };
+	};
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <unordered_map>
+#include <cstdint>
+#include <vector>
+#include <bitset>
+
+namespace hl
+{
+	class Entity;
+
+	// Scene wide mapping from tag name hashes (String::fnv1a_32 / ""_hash) to a
+	// bit in every entity's TagMask, along with the list of entities that
+	// currently have each tag so they can be found without scanning the scene.
+	class TagRegistry
+	{
+	public:
+		static constexpr size_t MaxTags = 64;
+		static constexpr uint32_t InvalidIndex = UINT32_MAX;
+
+		uint32_t getOrCreateIndex(uint32_t tagHash);
+		// InvalidIndex when no entity has ever been given the tag.
+		uint32_t findIndex(uint32_t tagHash) const
+		{
+			auto it = _indices.find(tagHash);
+			return it == _indices.end() ? InvalidIndex : it->second;
+		}
+
+		void add(uint32_t index, Entity& entity);
+		void remove(uint32_t index, Entity& entity);
+
+		// Entities are in no particular order, removal swaps the last entity into the gap.
+		const std::vector<Entity*>& getEntities(uint32_t index) const;
+
+		size_t getTagCount() const { return _tags.size(); }
+		uint32_t getHash(uint32_t index) const { return _tags[index].hash; }
+
+	private:
+		struct TagEntities
+		{
+			uint32_t hash{ 0 };
+			std::vector<Entity*> entities;
+			// Position in entities, indexed by the entity's handle slot.
+			std::vector<uint32_t> positions;
+		};
+
+		std::unordered_map<uint32_t, uint32_t> _indices;
+		std::vector<TagEntities> _tags;
+	};
+
+	using TagMask = std::bitset<TagRegistry::MaxTags>;
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <helsinki/Engine/ECS/Components/TransformComponent.hpp>
+#include <helsinki/Engine/ECS/Query.hpp>
+#include <vector>
+
+namespace hl
+{
+	class Scene;
+	class Entity;
+
+	// Computes the world matrix of every TransformComponent in a scene, run from
+	// Scene::update(). Local and world matrices live in packed arrays ordered so
+	// that parents always come before their children, which lets dirtiness be
+	// propagated and world matrices be recomputed in one linear pass.
+	// New transforms are appended and removed ones taken out in place, so pooled
+	// spawns and despawns are cheap. The order is only rebuilt when a transform
+	// is reparented, loses its parent or is added ahead of its parent.
+	class TransformHierarchy
+	{
+	public:
+		static constexpr uint32_t NoParent = UINT32_MAX;
+
+		void update(Scene& scene);
+
+		// Indexed by TransformComponent::GetWorldIndex(), valid until the next update.
+		const std::vector<glm::mat4>& getWorldMatrices() const { return _world; }
+		// Transforms added since the last update fall back to their local matrix.
+		glm::mat4 getWorldMatrix(const TransformComponent& transform) const;
+
+		// How many world matrices the last update had to recompute.
+		size_t getLastUpdatedCount() const { return _lastUpdatedCount; }
+
+	private:
+		// Takes out the transforms that were not seen and appends the added ones,
+		// false if the order has to be rebuilt instead.
+		bool patch(Scene& scene);
+		void rebuild(Scene& scene);
+		uint32_t depthOf(Scene& scene, Entity& entity);
+		Entity* parentOf(Scene& scene, const Entity& entity) const;
+
+	private:
+		static constexpr uint32_t UnknownDepth = UINT32_MAX;
+
+		Query<TransformComponent> _transforms;
+		bool _registered{ false };
+
+		std::vector<Entity*> _entities;
+		std::vector<uint32_t> _parents;
+		std::vector<uint8_t> _dirty;
+		std::vector<glm::mat4> _local;
+		std::vector<glm::mat4> _world;
+		size_t _lastUpdatedCount{ 0 };
+		// Transforms whose parent id has no transform (yet), adding any transform
+		// rebuilds while there are some in case it is the missing parent.
+		size_t _unresolvedParents{ 0 };
+
+		// Scratch space for rebuilding the order, kept to avoid reallocating.
+		std::vector<Entity*> _sorted;
+		std::vector<Entity*> _path;
+		std::vector<uint32_t> _depths;
+		std::vector<uint32_t> _depthOffsets;
+		std::vector<uint8_t> _seen;
+		std::vector<Entity*> _added;
+		std::vector<uint32_t> _remap;
+	};
+}
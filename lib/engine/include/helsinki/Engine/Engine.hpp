@@ -3,6 +3,7 @@
 #include <helsinki/Engine/EngineConfiguration.hpp>
 #include <helsinki/Engine/EngineScene.hpp>
 #include <helsinki/System/Events/EventBus.hpp>
+#include <helsinki/System/Events/EventRecorder.hpp>
 #include <helsinki/System/Utils/NonCopyable.hpp>
 #include <helsinki/Renderer/Resource/TextSystem.hpp>
 #include <helsinki/Renderer/Resource/MaterialSystem.hpp>
@@ -17,6 +18,14 @@ struct GLFWwindow;
 namespace hl
 {
 
+	struct ReplayResult
+	{
+		uint32_t frames{ 0 };
+		uint64_t updates{ 0 };
+		double totalMilliseconds{ 0.0 };
+		double slowestFrameMilliseconds{ 0.0 };
+	};
+
 	class Engine : NonCopyable
 	{
 	public:
@@ -25,9 +34,27 @@ namespace hl
 
 		void init(EngineConfiguration config);
 		void run();
+		// Runs the scene through the recorded session instead of run, feeding
+		// the recorded input back in update by update with the same updates in
+		// each frame, as fast as possible and without drawing.
+		ReplayResult replay(const EventRecording& recording);
 		void notifyFramebufferResized(int width, int height);
 		void sendEvent(const Event& event);
 
+		// Input from the window, which is ignored while replaying.
+		template<typename T>
+		void sendInputEvent(const T& event)
+		{
+			if (!_replaying)
+			{
+				_eventBus.PublishEvent(event);
+			}
+		}
+
+		// Records the events published while running, stamped with the fixed
+		// update they were published in. Null stops recording.
+		void setRecorder(EventRecorder* recorder);
+
 		void setScene(EngineScene* scene);
 		void stop();
 
@@ -42,6 +69,7 @@ namespace hl
 		void cleanup();
 		void update(float delta);
 		void draw();
+		void recordMouseState();
 
 		void initWindow(uint32_t width, uint32_t height, const char* title);
 		void initVulkan(const char* title);
@@ -72,6 +100,11 @@ namespace hl
 		uint32_t _currentFrame = 0;
 		bool _framebufferResized = false;
 		bool _running = false;
+		bool _replaying = false;
+
+		EventRecorder* _recorder{ nullptr };
+		uint64_t _updateCount{ 0 };
+		MouseStateEvent _lastMouseState{};
 
 		std::unique_ptr<EngineScene> _currentEngineScene;
 		EngineScene* _nextEngineScene{nullptr};
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <optional>
 #include <string>
 #include <format>
 #include <helsinki/System/Utils/Json.hpp>
@@ -8,6 +9,10 @@
 
 namespace hl
 {
+	// Each fixed update steps the simulation by this long, however often
+	// frames are drawn.
+	constexpr float FixedDelta = 1.0f / 60.0f;
+
 	struct EngineConfiguration
 	{
 		bool EnableVsync{ false };
@@ -17,6 +22,11 @@ namespace hl
 		uint32_t Width{ 800 };
 		uint32_t Height{ 600 };
 		uint32_t MaxMaterials{ 64 };
+		// Keeps the window hidden, for replays.
+		bool Headless{ false };
+		// Runs every scene deterministically from this seed, see
+		// Scene::setDeterministic.
+		std::optional<uint64_t> Seed;
 
 		void applyConfig(const std::string& filename, const std::string& rootPath)
 		{
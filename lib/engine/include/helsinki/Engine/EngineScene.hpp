@@ -53,6 +53,8 @@ namespace hl
 
 		std::size_t getCameraIndex(const std::string& cameraName) const;
 
+		Scene& getScene() { return _scene; }
+
 	private:
 		void updateCameraUniformBuffer(VulkanUniformBuffer& uniformBuffer);
 
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <helsinki/Engine/Input/InputManager.hpp>
+#include <helsinki/Engine/Scene/Scene.hpp>
+#include <helsinki/System/Events/EventBus.hpp>
+#include <helsinki/System/Events/EventRecording.hpp>
+#include <helsinki/System/Utils/NonCopyable.hpp>
+#include <cstdint>
+#include <iostream>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+namespace hl
+{
+	// The options every headless executable takes, see HeadlessGame::getUsage.
+	struct HeadlessOptions
+	{
+		uint64_t updates{ 3600 };
+		std::string replayPath;
+		uint64_t replayFrom{ 0 };
+		bool serial{ false };
+		std::optional<uint64_t> seed;
+		std::string checksumsPath;
+		std::string verifyPath;
+		double minUpdatesPerSecond{ 0.0 };
+		bool help{ false };
+	};
+
+	// A game run by a HeadlessRunner from the command line, much as an
+	// EngineScene is run by the Engine. The game adds its entities and systems
+	// to the scene and scripts the input, the shared options, the run and the
+	// report are handled here so each headless executable only supplies its
+	// gameplay. The scene, event bus and input manager outlive anything the
+	// derived game holds on to.
+	class HeadlessGame : NonCopyable
+	{
+	public:
+		virtual ~HeadlessGame() = default;
+
+		// Parses the options, runs the game and reports how fast it updated.
+		// Returns the process exit code, failing when the checksums differ from
+		// --verify or the game updates slower than --min-ups.
+		int run(int argc, char** argv, std::ostream& stream = std::cout);
+
+		// Shared options first, then any the game recognises through parseOption.
+		HeadlessOptions parseOptions(int argc, char** argv);
+		std::string getUsage() const;
+
+	protected:
+		// Called for each argument the shared options do not recognise, with
+		// the argument after it or nullptr if it is the last. Returns how many
+		// of the two were used, 0 if the game does not recognise it either.
+		virtual int parseOption(std::string_view /*arg*/, const char* /*value*/) { return 0; }
+		// One line per option, in the same layout as the shared ones.
+		virtual std::string getOptionUsage() const { return {}; }
+
+		// After the options have been applied to the scene.
+		virtual void initialise(const HeadlessOptions& options) = 0;
+		// Input for when the run is not replaying a recording.
+		virtual EventRecording scriptInput(uint64_t updates) = 0;
+		// Called before the scene's systems each update.
+		virtual void update(uint64_t /*update*/, float /*delta*/) {}
+
+		// First line of the report, ahead of the timings.
+		virtual std::string getName() const = 0;
+		// Anything else the game reports, after the timings.
+		virtual void report(std::ostream& /*stream*/) const {}
+
+	protected:
+		EventBus _eventBus;
+		InputManager _inputManager;
+		Scene _scene;
+	};
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <helsinki/Engine/EngineConfiguration.hpp>
+#include <helsinki/Engine/Input/InputManager.hpp>
+#include <helsinki/Engine/Scene/Scene.hpp>
+#include <helsinki/System/Events/EventBus.hpp>
+#include <helsinki/System/Events/EventRecording.hpp>
+#include <helsinki/System/Utils/NonCopyable.hpp>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hl
+{
+	struct HeadlessSystemResult
+	{
+		std::string name;
+		double totalMilliseconds{ 0.0 };
+		double slowestMilliseconds{ 0.0 };
+	};
+
+	struct HeadlessResult
+	{
+		uint64_t updates{ 0 };
+		double totalMilliseconds{ 0.0 };
+		double slowestUpdateMilliseconds{ 0.0 };
+		// In registration order.
+		std::vector<HeadlessSystemResult> systems;
+		// Scene::checksum after each update, when the runner records them. The
+		// last update of a frame is taken after the frame's event phases, so
+		// it includes what their events changed.
+		std::vector<uint64_t> checksums;
+
+		double getUpdatesPerSecond() const;
+		// Updates per second, then the mean and slowest update of each system.
+		void print(std::ostream& stream) const;
+
+		// The first update whose checksum differs from the expected ones, or
+		// nullopt if they match for as many updates as both have.
+		std::optional<uint64_t> findDivergence(const std::vector<uint64_t>& expected) const;
+
+		// One checksum a line in hex, so two runs' files can also be diffed.
+		void saveChecksums(const std::string& path) const;
+		static std::vector<uint64_t> loadChecksums(const std::string& path);
+	};
+
+	// Runs a scene the way the engine's main loop does, fixed update after
+	// fixed update with the event phases processed around them, but without a
+	// window or a device and as fast as it will go. Gameplay can then be timed
+	// on machines without a GPU.
+	//
+	// Input comes from a recording, either a session saved with an
+	// EventRecorder or one scripted with it, and reaches the systems through
+	// the InputManager the same way it does when the engine replays. Updates
+	// are grouped into the recorded frames as Engine::replay does, with the
+	// event phases processed once a frame.
+	class HeadlessRunner : NonCopyable
+	{
+	public:
+		using UpdateCallback = std::function<void(uint64_t update, float delta)>;
+
+		HeadlessRunner(EventBus& eventBus, InputManager& inputManager, Scene& scene);
+
+		// Called before the scene's systems each update, for whatever the
+		// EngineScene does around them, such as moving between game states.
+		void setUpdateCallback(UpdateCallback callback) { _updateCallback = std::move(callback); }
+
+		// Records Scene::checksum after every update, which costs a pass over
+		// every entity, so leave it off when only timing.
+		void setRecordChecksums(bool record) { _recordChecksums = record; }
+
+		// One update per frame.
+		HeadlessResult run(uint64_t updateCount);
+		// With the input recorded for each update, starting at firstUpdate of
+		// the recording. Recorded update numbers count from when the engine
+		// started, so a session recorded from the game's title screen starts
+		// at the update its gameplay did. The callback and checksums still
+		// count from 0.
+		HeadlessResult run(uint64_t updateCount, const EventRecording& input, uint64_t firstUpdate = 0);
+
+	private:
+		EventBus& _eventBus;
+		InputManager& _inputManager;
+		Scene& _scene;
+		UpdateCallback _updateCallback;
+		bool _recordChecksums{ false };
+	};
+}
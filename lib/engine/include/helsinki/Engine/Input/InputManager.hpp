@@ -1,6 +1,8 @@
 #pragma once
 
 #include <helsinki/System/glm.hpp>
+#include <helsinki/System/Events/EventListener.hpp>
+#include <helsinki/Engine/Input/MouseStateEvent.hpp>
 #include <unordered_map>
 
 struct GLFWwindow;
@@ -8,7 +10,7 @@ struct GLFWwindow;
 namespace hl
 {
 
-	class InputManager
+	class InputManager : public EventListener
 	{
 	public:
 
@@ -24,11 +26,23 @@ namespace hl
 		void setWindow(GLFWwindow* _window);
 
 		void updateEndOfFrame();
+
+		// While set, keys are down between the KeyPressEvent and KeyReleaseEvent
+		// sent to OnEvent, and the mouse is wherever the last MouseStateEvent
+		// put it, rather than going by the window, so that replayed events
+		// drive the input.
+		void setUseRecordedInput(bool useRecordedInput);
+		void OnEvent(const Event& event) override;
+		void onMouseState(const MouseStateEvent& event);
+
 	private:
 		GLFWwindow* m_Window;
 		mutable std::unordered_map<int, bool> _wasKeyDown;
 		mutable std::unordered_map<int, bool> _wasButtonDown;
 		mutable glm::vec2 _lastMousePosition;
+		std::unordered_map<int, bool> _recordedKeyDown;
+		MouseStateEvent _recordedMouse{};
+		bool _useRecordedInput{ false };
 	};
 
 }
\ No newline at end of file
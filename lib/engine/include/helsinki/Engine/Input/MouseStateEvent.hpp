@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstdint>
+
+namespace hl
+{
+	// Published by the engine whenever the mouse changes while a session is
+	// being recorded, the window only reports the mouse when asked, so replays
+	// need this to drive the InputManager.
+	struct MouseStateEvent
+	{
+		float x;
+		float y;
+		// Bit per GLFW mouse button.
+		uint32_t buttons;
+
+		bool operator==(const MouseStateEvent&) const = default;
+	};
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <helsinki/System/glm.hpp>
+
+namespace hl
+{
+	// Axis aligned box in the xy plane.
+	struct Aabb
+	{
+		glm::vec2 min{ 0.0f };
+		glm::vec2 max{ 0.0f };
+
+		static Aabb fromCentre(const glm::vec2& centre, const glm::vec2& size)
+		{
+			const auto half = size * 0.5f;
+			return Aabb{ centre - half, centre + half };
+		}
+
+		static Aabb fromCorner(const glm::vec2& corner, const glm::vec2& size)
+		{
+			return Aabb{ corner, corner + size };
+		}
+
+		// Boxes that only touch along an edge count as overlapping.
+		bool overlaps(const Aabb& other) const
+		{
+			return
+				min.x <= other.max.x && other.min.x <= max.x &&
+				min.y <= other.max.y && other.min.y <= max.y;
+		}
+
+		bool operator==(const Aabb& other) const = default;
+	};
+}
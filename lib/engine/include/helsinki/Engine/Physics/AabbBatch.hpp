@@ -0,0 +1,52 @@
+#pragma once
+
+#include <helsinki/Engine/Physics/Aabb.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace hl
+{
+	// Instruction sets the overlap kernels can use, best last.
+	enum class SimdLevel
+	{
+		Scalar,
+		Sse,
+		Avx2
+	};
+
+	// The best level this cpu supports, checked once.
+	SimdLevel detectSimdLevel();
+
+	// Boxes packed as separate min/max arrays so one box can be tested against
+	// 4 (SSE) or 8 (AVX2) others per instruction. Overlap means the same as
+	// Aabb::overlaps, touching included, and every level finds exactly the
+	// same boxes in the same order.
+	class AabbBatch
+	{
+	public:
+		void clear();
+		void reserve(size_t count);
+		uint32_t add(const Aabb& bounds);
+
+		size_t size() const { return _count; }
+		Aabb get(uint32_t index) const;
+
+		// Appends the index of every box from first on that overlaps bounds.
+		void findOverlaps(const Aabb& bounds, std::vector<uint32_t>& hits, uint32_t first = 0) const;
+		void findOverlaps(const Aabb& bounds, std::vector<uint32_t>& hits, uint32_t first, SimdLevel level) const;
+
+		// As findOverlaps, for boxes added in order of min.x. Stops at the
+		// first box starting past bounds.max.x, as a sweep would.
+		void findSortedOverlaps(const Aabb& bounds, std::vector<uint32_t>& hits, uint32_t first = 0) const;
+		void findSortedOverlaps(const Aabb& bounds, std::vector<uint32_t>& hits, uint32_t first, SimdLevel level) const;
+
+	private:
+		// Padded to a multiple of 8 with NaN boxes, which overlap nothing, so
+		// the kernels never need a scalar tail.
+		std::vector<float> _minX;
+		std::vector<float> _minY;
+		std::vector<float> _maxX;
+		std::vector<float> _maxY;
+		size_t _count{ 0 };
+	};
+}
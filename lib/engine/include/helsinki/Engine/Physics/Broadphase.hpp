@@ -0,0 +1,92 @@
+#pragma once
+
+#include <helsinki/Engine/Physics/Aabb.hpp>
+#include <helsinki/Engine/Physics/CollisionFilter.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace hl
+{
+	struct BroadphasePair
+	{
+		// The lower of the two entity ids.
+		int entityA;
+		int entityB;
+
+		bool operator==(const BroadphasePair& other) const = default;
+		auto operator<=>(const BroadphasePair& other) const = default;
+	};
+
+	// Finds the colliders whose boxes overlap and whose filters accept each
+	// other, without testing every pair. Colliders are keyed by entity id and
+	// kept between frames, so each frame only has to pass on what moved:
+	//
+	//  broadphase.beginUpdate();
+	//  for each collider: broadphase.update(entity->Id, bounds, filter);
+	//  broadphase.endUpdate();
+	//  broadphase.findPairs(pairs);
+	//
+	// Colliders not updated between beginUpdate and endUpdate are removed, so
+	// entities that were destroyed or lost their collider drop out on their
+	// own. Updating with unchanged bounds costs a comparison.
+	//
+	// Pairs are only candidates, overlapping boxes, for a narrow phase to
+	// confirm. Both implementations give the same pairs in the same order.
+	class Broadphase
+	{
+	public:
+		virtual ~Broadphase() = default;
+
+		void beginUpdate();
+		// Adds the entity's collider or moves it, see the class comment.
+		void update(int entityId, const Aabb& bounds, CollisionFilter filter);
+		void endUpdate();
+
+		void remove(int entityId);
+		void clear();
+
+		// Replaces the contents of pairs with every candidate pair, sorted.
+		void findPairs(std::vector<BroadphasePair>& pairs);
+
+		size_t getColliderCount() const { return _colliderCount; }
+
+	protected:
+		static constexpr uint32_t NoProxy = UINT32_MAX;
+
+		struct Proxy
+		{
+			Aabb bounds;
+			CollisionFilter filter;
+			// EntityHandle::Invalid while the proxy is free.
+			int entityId;
+			uint32_t round;
+		};
+
+		// Called once the proxy's bounds are set, previous holds what they
+		// were before a move.
+		virtual void onAdded(uint32_t proxy) = 0;
+		virtual void onMoved(uint32_t proxy, const Aabb& previous) = 0;
+		// Called before the proxy is freed, its id may then be reused.
+		virtual void onRemoved(uint32_t proxy) = 0;
+		virtual void onCleared() = 0;
+		// Appends each candidate pair once, in any order and either way round.
+		virtual void collectPairs(std::vector<BroadphasePair>& pairs) = 0;
+
+		bool isCandidate(const Proxy& a, const Proxy& b) const
+		{
+			return a.filter.accepts(b.filter) && a.bounds.overlaps(b.bounds);
+		}
+
+		std::vector<Proxy> _proxies;
+
+	private:
+		void removeProxy(uint32_t proxy);
+
+	private:
+		// Proxy of each entity by EntityHandle::index of its id.
+		std::vector<uint32_t> _proxyBySlot;
+		std::vector<uint32_t> _freeProxies;
+		size_t _colliderCount{ 0 };
+		uint32_t _round{ 0 };
+	};
+}
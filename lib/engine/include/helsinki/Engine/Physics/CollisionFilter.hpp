@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstdint>
+
+namespace hl
+{
+	// Which layers a collider is on and which layers it collides with, as bit
+	// masks whose meaning is up to the game. Two colliders only collide when
+	// each one's mask includes a layer of the other.
+	struct CollisionFilter
+	{
+		uint32_t layer{ 0 };
+		uint32_t mask{ 0 };
+
+		bool accepts(const CollisionFilter& other) const
+		{
+			return (mask & other.layer) != 0 && (other.mask & layer) != 0;
+		}
+
+		bool operator==(const CollisionFilter& other) const = default;
+	};
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <helsinki/Engine/Physics/Broadphase.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace hl
+{
+	// Remembers which pairs of entities were touching last update so contacts
+	// can be handled as they start and end rather than every update they last:
+	//
+	//  contacts.beginUpdate();
+	//  for each touching pair: contacts.add(entityA, entityB);
+	//  contacts.endUpdate();
+	//  contacts.getEntered(), contacts.getExited()
+	//
+	// Pairs not added between beginUpdate and endUpdate have ended, so pairs
+	// with an entity that was removed end on their own.
+	//
+	// Pairs live in a flat open addressed table that keeps its memory between
+	// updates, so a steady set of contacts costs a probe per pair and
+	// allocates nothing. Everything is reported in the order pairs were added,
+	// so the same pairs always give the same events in the same order.
+	class ContactCache
+	{
+	public:
+		void beginUpdate();
+		// Either way round, adding a pair again in the same update does nothing.
+		void add(int entityA, int entityB);
+		void endUpdate();
+
+		// A whole update with each of the pairs.
+		void update(const std::vector<BroadphasePair>& pairs);
+
+		// Forgets every pair without reporting them as exited.
+		void clear();
+
+		// Stays are only collected when asked for, most callers only care about
+		// contacts starting and ending.
+		void setReportStays(bool reportStays) { _reportStays = reportStays; }
+		bool getReportStays() const { return _reportStays; }
+
+		// Pairs that started touching in the last update.
+		const std::vector<BroadphasePair>& getEntered() const { return _entered; }
+		// Pairs that were already touching, empty unless stays are reported.
+		const std::vector<BroadphasePair>& getStayed() const { return _stayed; }
+		// Pairs that stopped touching in the last update.
+		const std::vector<BroadphasePair>& getExited() const { return _exited; }
+
+		bool contains(int entityA, int entityB) const;
+		size_t getContactCount() const { return _contacts.size(); }
+
+	private:
+		static constexpr uint32_t NoSlot = UINT32_MAX;
+		// No pair has both ids EntityHandle::Invalid, so a zero key is free.
+		static constexpr uint64_t EmptyKey = 0;
+		static constexpr uint32_t MinCapacity = 64;
+
+		struct Slot
+		{
+			uint64_t key;
+			// The update the pair was last added in.
+			uint32_t round;
+		};
+
+		static BroadphasePair makePair(int entityA, int entityB);
+		static uint64_t makeKey(const BroadphasePair& pair);
+
+		uint32_t home(uint64_t key) const;
+		uint32_t find(uint64_t key) const;
+		void erase(uint32_t slot);
+		void rehash(uint32_t capacity);
+
+	private:
+		// Power of two sized, kept at most half full.
+		std::vector<Slot> _slots;
+		uint32_t _shift{ 64 };
+		uint32_t _size{ 0 };
+		uint32_t _round{ 0 };
+		bool _reportStays{ false };
+
+		// Pairs touching as of the last update, and those added so far in this one.
+		std::vector<BroadphasePair> _contacts;
+		std::vector<BroadphasePair> _current;
+
+		std::vector<BroadphasePair> _entered;
+		std::vector<BroadphasePair> _stayed;
+		std::vector<BroadphasePair> _exited;
+	};
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <helsinki/System/glm.hpp>
+#include <type_traits>
+
+namespace hl
+{
+	enum class IntegrationScheme
+	{
+		// Moves by the velocity at the start of the step, then speeds up.
+		// Cheapest, but gains energy, so orbits and springs drift apart.
+		ExplicitEuler,
+		// Speeds up, then moves by the new velocity. Stable for games and the
+		// default.
+		SemiImplicitEuler,
+		// Velocity Verlet with acceleration held for the step, so constant
+		// acceleration such as gravity lands exactly where it should.
+		Verlet
+	};
+
+	// Advances velocity by acceleration over delta and returns how far the body
+	// moves. The scheme is a template argument so callers can pick it once and
+	// keep their per-body loop free of branches.
+	template<IntegrationScheme Scheme>
+	glm::vec3 integrateKinematic(glm::vec3& velocity, const glm::vec3& acceleration, float delta)
+	{
+		if constexpr (Scheme == IntegrationScheme::ExplicitEuler)
+		{
+			const auto displacement = velocity * delta;
+			velocity += acceleration * delta;
+			return displacement;
+		}
+		else if constexpr (Scheme == IntegrationScheme::SemiImplicitEuler)
+		{
+			velocity += acceleration * delta;
+			return velocity * delta;
+		}
+		else
+		{
+			const auto displacement = (velocity + acceleration * (0.5f * delta)) * delta;
+			velocity += acceleration * delta;
+			return displacement;
+		}
+	}
+
+	// Calls fn with a std::integral_constant of the scheme, e.g.
+	// withIntegrationScheme(scheme, [&](auto s) { integrateKinematic<decltype(s)::value>(...); }).
+	template<typename F>
+	void withIntegrationScheme(IntegrationScheme scheme, F&& fn)
+	{
+		switch (scheme)
+		{
+		case IntegrationScheme::ExplicitEuler:
+			fn(std::integral_constant<IntegrationScheme, IntegrationScheme::ExplicitEuler>{});
+			break;
+		case IntegrationScheme::Verlet:
+			fn(std::integral_constant<IntegrationScheme, IntegrationScheme::Verlet>{});
+			break;
+		default:
+			fn(std::integral_constant<IntegrationScheme, IntegrationScheme::SemiImplicitEuler>{});
+			break;
+		}
+	}
+}
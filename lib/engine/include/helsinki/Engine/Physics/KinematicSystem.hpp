@@ -0,0 +1,29 @@
+#pragma once
+
+#include <helsinki/Engine/ECS/System.hpp>
+#include <helsinki/Engine/ECS/Components/TransformComponent.hpp>
+#include <helsinki/Engine/ECS/Components/KinematicComponent.hpp>
+#include <helsinki/Engine/Physics/KinematicIntegration.hpp>
+#include <helsinki/Engine/Scene/Scene.hpp>
+
+namespace hl
+{
+	// Moves every entity with a TransformComponent and a KinematicComponent by
+	// its velocity and acceleration, walking the packed component arrays a
+	// chunk at a time. For scenes that need movement without collision, the
+	// PhysicsSystem integrates the same entities, so use one or the other.
+	class KinematicSystem : public System
+	{
+	public:
+		explicit KinematicSystem(Scene& scene, IntegrationScheme scheme = IntegrationScheme::SemiImplicitEuler);
+
+		void update(float delta) override;
+
+		void setIntegrationScheme(IntegrationScheme scheme) { _scheme = scheme; }
+		IntegrationScheme getIntegrationScheme() const { return _scheme; }
+
+	private:
+		Query<TransformComponent, KinematicComponent> _bodies;
+		IntegrationScheme _scheme;
+	};
+}
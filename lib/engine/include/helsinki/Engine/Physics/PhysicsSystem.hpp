@@ -0,0 +1,109 @@
+#pragma once
+
+#include <helsinki/Engine/ECS/System.hpp>
+#include <helsinki/Engine/ECS/Components/TransformComponent.hpp>
+#include <helsinki/Engine/ECS/Components/KinematicComponent.hpp>
+#include <helsinki/Engine/ECS/Components/ColliderComponent.hpp>
+#include <helsinki/Engine/Physics/KinematicIntegration.hpp>
+#include <helsinki/Engine/Physics/SweepAndPruneBroadphase.hpp>
+#include <helsinki/Engine/Scene/Scene.hpp>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace hl
+{
+	struct PhysicsContact
+	{
+		// The moving body, or the lower id when both move.
+		int entityA;
+		int entityB;
+		// Points from B towards A along the axis they met on, zero when they
+		// were already overlapping.
+		glm::vec2 normal;
+		// Fraction of the step at which they met.
+		float time;
+	};
+
+	// Moves every entity with a TransformComponent and a KinematicComponent in
+	// the xy plane, z just follows its velocity. Integration is semi-implicit
+	// Euler unless another scheme is set.
+	//
+	// Moving bodies with a ColliderComponent are swept against colliders that do
+	// not move and bounce off the first one in their way, up to MaxBounces times
+	// a step, so however fast they go they do not pass through. Moving bodies
+	// are not pushed apart from each other, but pairs that meet during the step
+	// are reported in the contacts along with the bounces.
+	//
+	// Positions are used as they are, so bodies are expected to have no parent.
+	// Bodies are visited in query order and pairs in entity id order, so the
+	// same scene stepped with the same delta always ends up in the same place
+	// with the same contacts in the same order.
+	class PhysicsSystem : public System
+	{
+	public:
+		static constexpr int MaxBounces = 4;
+
+		explicit PhysicsSystem(Scene& scene, IntegrationScheme scheme = IntegrationScheme::SemiImplicitEuler);
+
+		void update(float delta) override;
+
+		void setIntegrationScheme(IntegrationScheme scheme) { _scheme = scheme; }
+		IntegrationScheme getIntegrationScheme() const { return _scheme; }
+
+		// Everything that collided in the last update.
+		const std::vector<PhysicsContact>& getContacts() const { return _contacts; }
+
+	private:
+		void gatherBodies();
+		void integrate(float delta);
+		void findCandidates();
+		void moveBodies();
+		void findBodyContacts();
+
+	private:
+		static constexpr uint32_t StaticBit = 0x80000000u;
+		static constexpr uint32_t NoCollider = UINT32_MAX;
+
+		Query<TransformComponent, KinematicComponent> _bodies;
+		Query<TransformComponent, ColliderComponent> _colliders;
+		IntegrationScheme _scheme;
+
+		// Moving bodies, packed in query order each step.
+		std::vector<TransformComponent*> _bodyTransforms;
+		std::vector<KinematicComponent*> _bodyKinematics;
+		std::vector<glm::vec3> _positions;
+		std::vector<glm::vec3> _velocities;
+		std::vector<glm::vec3> _accelerations;
+		std::vector<glm::vec2> _motions;
+		// Index into the moving collider arrays below, NoCollider for bodies
+		// without a collider.
+		std::vector<uint32_t> _bodyColliders;
+
+		std::vector<uint32_t> _colliderBodies;
+		std::vector<int> _colliderEntities;
+		std::vector<const ColliderComponent*> _colliderComponents;
+		std::vector<Aabb> _startBounds;
+		std::vector<Aabb> _endBounds;
+
+		std::vector<int> _staticEntities;
+		std::vector<Aabb> _staticBounds;
+
+		// Moving collider or static (with StaticBit) index by entity slot.
+		std::vector<uint32_t> _indexBySlot;
+
+		SweepAndPruneBroadphase _broadphase;
+		std::vector<BroadphasePair> _pairs;
+		// Static candidates of each moving collider, _candidateStarts[i] to
+		// _candidateStarts[i + 1] in _candidates.
+		std::vector<uint32_t> _candidateStarts;
+		std::vector<uint32_t> _candidates;
+		// Next free entry of each collider's candidates while filling them,
+		// kept so steady state steps do not allocate.
+		std::vector<uint32_t> _candidateCursors;
+		// Pairs of moving colliders.
+		std::vector<std::pair<uint32_t, uint32_t>> _bodyPairs;
+
+		std::vector<PhysicsContact> _contacts;
+	};
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <helsinki/Engine/Physics/Broadphase.hpp>
+#include <helsinki/Engine/Physics/AabbBatch.hpp>
+
+namespace hl
+{
+	// Keeps colliders sorted by the left edge of their box and sweeps along x,
+	// only testing colliders whose x extents overlap. The order is kept from
+	// one frame to the next and repaired with an insertion sort, which is
+	// close to linear while colliders move a little each frame. Needs no
+	// tuning, but slows down when many colliders share the same x range.
+	class SweepAndPruneBroadphase : public Broadphase
+	{
+	protected:
+		void onAdded(uint32_t proxy) override;
+		void onMoved(uint32_t proxy, const Aabb& previous) override;
+		void onRemoved(uint32_t proxy) override;
+		void onCleared() override;
+		void collectPairs(std::vector<BroadphasePair>& pairs) override;
+
+	private:
+		void sortOrder();
+
+	private:
+		// Proxies sorted by bounds.min.x as of the last sweep.
+		std::vector<uint32_t> _order;
+		// Boxes in sweep order, rebuilt from the proxies before each sweep
+		// so each one is tested against the boxes after it a batch at a time.
+		AabbBatch _sweepBounds;
+		std::vector<CollisionFilter> _sweepFilters;
+		std::vector<int> _sweepEntities;
+		std::vector<uint32_t> _hits;
+		// Removed proxies still in _order, dropped at the next sweep.
+		std::vector<uint8_t> _stale;
+		size_t _staleCount{ 0 };
+		// Proxies added since the last sweep, past a point sorting from
+		// scratch beats inserting them one at a time.
+		size_t _addedCount{ 0 };
+	};
+}
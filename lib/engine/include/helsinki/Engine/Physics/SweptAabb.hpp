@@ -0,0 +1,85 @@
+#pragma once
+
+#include <helsinki/Engine/Physics/Aabb.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace hl
+{
+	struct SweepHit
+	{
+		// Fraction of the motion travelled before the boxes meet.
+		float time{ 0.0f };
+		// Unit axis pointing out of the target towards the moving box.
+		glm::vec2 normal{ 0.0f };
+	};
+
+	// Boxes overlapping by less than this at the start of a sweep still hit at
+	// time 0. Moving a box back from a position rounds its edges, and without
+	// this a box stopped against a surface could sink into it a step at a time.
+	constexpr float SweepSkin = 1.0e-3f;
+
+	// Finds when a box moving by motion first runs into target. Boxes that only
+	// touch, or slide along each other, do not hit, so a box resting against a
+	// surface can always move away from it. Boxes already overlapping by more
+	// than SweepSkin are ignored rather than pushed apart.
+	inline bool sweepAabb(const Aabb& moving, const glm::vec2& motion, const Aabb& target, SweepHit& hit)
+	{
+		constexpr auto Infinity = std::numeric_limits<float>::infinity();
+
+		const auto axisTimes = [](float movingMin, float movingMax, float targetMin, float targetMax, float motion, float& entry, float& exit)
+			{
+				if (motion > 0.0f)
+				{
+					entry = (targetMin - movingMax) / motion;
+					exit = (targetMax - movingMin) / motion;
+				}
+				else if (motion < 0.0f)
+				{
+					entry = (targetMax - movingMin) / motion;
+					exit = (targetMin - movingMax) / motion;
+				}
+				else if (movingMax <= targetMin || targetMax <= movingMin)
+				{
+					return false;
+				}
+				else
+				{
+					entry = -Infinity;
+					exit = Infinity;
+				}
+				return true;
+			};
+
+		float entryX, exitX, entryY, exitY;
+		if (!axisTimes(moving.min.x, moving.max.x, target.min.x, target.max.x, motion.x, entryX, exitX) ||
+			!axisTimes(moving.min.y, moving.max.y, target.min.y, target.max.y, motion.y, entryY, exitY))
+		{
+			return false;
+		}
+
+		const auto entry = std::max(entryX, entryY);
+		const auto exit = std::min(exitX, exitY);
+		if (!(entry < exit) || exit <= 0.0f || entry > 1.0f || entry == -Infinity)
+		{
+			return false;
+		}
+
+		if (entry < 0.0f)
+		{
+			const auto depth = -entry * std::abs(entryX >= entryY ? motion.x : motion.y);
+			if (depth > SweepSkin)
+			{
+				return false;
+			}
+		}
+
+		hit.time = std::max(entry, 0.0f);
+		// Hitting a corner exactly counts as hitting the side.
+		hit.normal = entryX >= entryY
+			? glm::vec2(motion.x > 0.0f ? -1.0f : 1.0f, 0.0f)
+			: glm::vec2(0.0f, motion.y > 0.0f ? -1.0f : 1.0f);
+		return true;
+	}
+}
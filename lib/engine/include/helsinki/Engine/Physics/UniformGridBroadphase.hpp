@@ -0,0 +1,57 @@
+#pragma once
+
+#include <helsinki/Engine/Physics/Broadphase.hpp>
+#include <unordered_map>
+
+namespace hl
+{
+	// Hashes colliders into every square cell of the given size they cover and
+	// only tests colliders sharing a cell. A collider is only moved between
+	// cells when the range it covers changes, so small moves are close to
+	// free. Suits many colliders of a similar size, pick a cell size a little
+	// larger than the typical collider; colliders spanning many cells, such
+	// as level bounds, are better left out.
+	class UniformGridBroadphase : public Broadphase
+	{
+	public:
+		explicit UniformGridBroadphase(float cellSize);
+
+		float getCellSize() const { return _cellSize; }
+		size_t getOccupiedCellCount() const { return _cells.size(); }
+
+	protected:
+		void onAdded(uint32_t proxy) override;
+		void onMoved(uint32_t proxy, const Aabb& previous) override;
+		void onRemoved(uint32_t proxy) override;
+		void onCleared() override;
+		void collectPairs(std::vector<BroadphasePair>& pairs) override;
+
+	private:
+		struct CellRange
+		{
+			int32_t minX;
+			int32_t minY;
+			int32_t maxX;
+			int32_t maxY;
+
+			bool operator==(const CellRange& other) const = default;
+		};
+
+		CellRange cellRangeOf(const Aabb& bounds) const;
+		void insertInto(uint32_t proxy, const CellRange& range);
+		void removeFrom(uint32_t proxy, const CellRange& range);
+
+		static uint64_t cellKey(int32_t x, int32_t y)
+		{
+			return (uint64_t)(uint32_t)x << 32 | (uint32_t)y;
+		}
+
+	private:
+		float _cellSize;
+		float _inverseCellSize;
+		// Proxies in each occupied cell, cells are dropped once empty.
+		std::unordered_map<uint64_t, std::vector<uint32_t>> _cells;
+		// Cells each proxy covers, by proxy.
+		std::vector<CellRange> _ranges;
+	};
+}
@@ -1,87 +1,189 @@
 #pragma once
 
 #include <helsinki/Engine/ECS/Entity.hpp>
+#include <helsinki/Engine/ECS/EntityHandle.hpp>
+#include <helsinki/Engine/ECS/EntityPool.hpp>
+#include <helsinki/Engine/ECS/ComponentStorage.hpp>
 #include <helsinki/Engine/ECS/System.hpp>
+#include <helsinki/Engine/ECS/SystemScheduler.hpp>
+#include <helsinki/Engine/ECS/TransformHierarchy.hpp>
+#include <helsinki/System/Utils/ObjectPool.hpp>
+#include <helsinki/System/Utils/Random.hpp>
+#include <helsinki/System/Utils/String.hpp>
 #include <algorithm>
 #include <iterator>
-#include <unordered_set>
+#include <unordered_map>
+#include <mutex>
 
 namespace hl
 {
+	struct SceneAllocationStats
+	{
+		PoolStats entities;
+		PoolStats chunks;
+		// Every EntityPool the scene created, added together.
+		EntityPoolStats prefabPools;
+	};
 
 	class Scene
 	{
-	private:
-
-		template <class InputIt, class OutputIt, class Pred, class Fct>
-		static inline void transform_if(InputIt first, InputIt last, OutputIt dest, Pred pred, Fct transform)
-		{
-			while (first != last)
-			{
-				if (pred(*first))
-				{
-					*dest++ = transform(*first);
-				}
-
-				++first;
-			}
-		}
-
 	public:
+		using EntityPointer = ObjectPool<Entity>::Pointer;
+
 		Entity* addEntity();
 		Entity* addEntity(const std::string& name);
 
+		// O(1) lookups, returns nullptr for unknown names and for ids of entities
+		// that have already been removed, even if their slot has been reused.
 		Entity* getEntity(const std::string& name);
 		Entity* getEntity(int id);
+		bool isValid(int id) const;
 
+		// Removal is deferred until update(), both are safe to call from systems
+		// running concurrently.
 		void removeEntity(const std::string& name);
 		void removeEntity(int id);
-
+		// True between removeEntity and the update() that removes it, so
+		// systems can ignore entities that are already on their way out.
+		bool isPendingRemoval(int id) const;
+
+		// Builds count entities from the prefab up front so that spawning them
+		// later creates nothing. The pool lives as long as the scene.
+		EntityPool& createPool(Prefab prefab, size_t count);
+		// Spawns one of the pool's waiting entities, building another first if
+		// they are all in use. Like addEntity this must not be called from
+		// systems running concurrently, record CommandBuffer::spawn instead.
+		Entity* spawn(EntityPool& pool);
+
+		// Plays back the command buffers recorded since the last call, systems'
+		// buffers first in registration order followed by the scene's own, then
+		// removes the entities queued for removal and updates world matrices.
 		void update();
 
+		// The command buffer to record deferred structural changes into. Inside a
+		// system update this is the system's own buffer, otherwise the scene's.
+		CommandBuffer& getCommandBuffer();
+
 		void addSystem(System* system);
 
-		const std::vector<std::unique_ptr<Entity>>& getEntities() const;
-		std::vector<std::unique_ptr<Entity>>& getEntities();
+		const std::vector<EntityPointer>& getEntities() const;
+		std::vector<EntityPointer>& getEntities();
+
+		// Pre-allocates room for the given number of live entities so spawning up
+		// to that many does not have to grow anything.
+		void reserve(size_t entityCount);
+		// Entities and component chunks are pooled and recycled as entities are
+		// removed, once a scene has warmed up these should stop allocating blocks.
+		SceneAllocationStats getAllocationStats() const;
+
+		// World matrices as of the last update(), packed with parents ahead of
+		// their children and indexed by TransformComponent::GetWorldIndex().
+		const std::vector<glm::mat4>& getWorldMatrices() const { return _transformHierarchy.getWorldMatrices(); }
+		glm::mat4 getWorldMatrix(const TransformComponent& transform) const { return _transformHierarchy.getWorldMatrix(transform); }
+		const TransformHierarchy& getTransformHierarchy() const { return _transformHierarchy; }
 
-		std::vector<Entity*> getEntitiesByTag(const std::string& tag) const;
+		// Direct lookup of the entities currently carrying the tag, kept up to date
+		// as tags are added and removed. Order is unspecified.
+		const std::vector<Entity*>& getEntitiesByTag(const std::string& tag) const;
+		const std::vector<Entity*>& getEntitiesByTag(uint32_t tagHash) const;
 
 		template<typename... Args>
 		std::vector<Entity*> getEntitiesWithComponents()const
 		{
-			std::vector<Entity*> entities;
-
-			transform_if(
-				std::cbegin(_entities),
-				std::cend(_entities),
-				std::back_inserter(entities),
-				[&](const std::unique_ptr<Entity>& o) { return o->HasComponents<Args...>(); },
-				[](const std::unique_ptr<Entity>& o) { return o.get(); });
-
-			return entities;
+			const auto view = query<Args...>().entities();
+			return std::vector<Entity*>(view.begin(), view.end());
 		}
 		template<typename... Args>
 		std::vector<Entity*> getEntitiesWithComponents(const std::string& tag)const
 		{
-			std::vector<Entity*> entities;
+			const auto view = query<Args...>(tag).entities();
+			return std::vector<Entity*>(view.begin(), view.end());
+		}
 
-			transform_if(
-				std::cbegin(_entities),
-				std::cend(_entities),
-				std::back_inserter(entities),
-				[&](const std::unique_ptr<Entity>& o) { return o->HasTag(tag) && o->HasComponents<Args...>(); },
-				[](const std::unique_ptr<Entity>& o) { return o.get(); });
+		// Persistent query over every entity with all of the given components,
+		// the matching archetypes are tracked as they are created so holding on to
+		// the returned query and iterating it each frame does not allocate.
+		template<typename... Args>
+		Query<Args...> query() const
+		{
+			return _storage.query<Args...>();
+		}
+		template<typename... Args>
+		Query<Args...> query(const std::string& tag) const
+		{
+			return query<Args...>(String::fnv1a_32(tag));
+		}
+		template<typename... Args>
+		Query<Args...> query(uint32_t tagHash) const
+		{
+			return _storage.query<Args...>(_tagRegistry.getOrCreateIndex(tagHash));
+		}
 
-			return entities;
+		// Iterates the packed component arrays of every entity with all of the given
+		// components, see ComponentStorage::forEach for what may be done in the callback.
+		template<typename... Args, typename F>
+		void forEach(F&& fn)
+		{
+			_storage.forEach<Args...>(std::forward<F>(fn));
 		}
 
+		const ComponentStorage& getStorage() const { return _storage; }
+
 		void update(float delta);
 
+		// Gameplay randomness should come from here rather than rand(), so a
+		// seeded scene makes the same choices every run.
+		Random& getRandom() { return _random; }
+
+		// Reseeds getRandom() and updates systems one at a time in registration
+		// order, so the same input produces the same state update for update.
+		// Compare checksum() between runs to find the first update they differ.
+		void setDeterministic(uint64_t seed);
+		bool isDeterministic() const { return _deterministic; }
+
+		// Hash of every live entity's id, tags and checksummed components, see
+		// ChecksummedComponent, along with the random state. Call between
+		// updates, it reads the storage without locking.
+		uint64_t checksum() const;
+
+		SystemScheduler& getScheduler() { return _scheduler; }
+		const std::vector<SystemTiming>& getSystemTimings() const { return _scheduler.getTimings(); }
+
 	private:
-		int _nextId = 1;
-		std::vector<std::unique_ptr<Entity>> _entities;
+		// Creates the entity straight into the archetype when one is given.
+		Entity* createEntity(Archetype* archetype);
+		uint32_t allocateSlot();
+		void addToPool(EntityPool& pool);
+
+		struct EntitySlot
+		{
+			static constexpr uint32_t Free = UINT32_MAX;
+
+			uint32_t generation{ 1 };
+			// Position of the entity in _entities, Free when the slot is unused.
+			uint32_t dense{ Free };
+			bool pendingRemoval{ false };
+		};
+
+		mutable ComponentStorage _storage;
+		mutable TagRegistry _tagRegistry;
+		ObjectPool<Entity> _entityPool;
+		std::vector<EntityPointer> _entities;
+		// After _entities and _entityPool, the waiting entities go back to the pool first.
+		std::vector<std::unique_ptr<EntityPool>> _pools;
+		std::vector<EntitySlot> _slots;
+		std::vector<uint32_t> _freeSlots;
+		std::unordered_map<std::string, int> _entitiesByName;
 		std::vector<std::unique_ptr<System>> _systems;
-		std::unordered_set<int> _entitiesToRemove;
+		SystemScheduler _scheduler;
+		Random _random;
+		bool _deterministic{ false };
+		CommandBuffer _commands;
+		TransformHierarchy _transformHierarchy;
+		mutable std::mutex _entitiesToRemoveMutex;
+		std::vector<int> _entitiesToRemove;
+
+		friend class SceneSerializer;
 	};
 
 }
\ No newline at end of file
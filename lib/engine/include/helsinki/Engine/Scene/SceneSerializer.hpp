@@ -0,0 +1,336 @@
+#pragma once
+
+#include <helsinki/Engine/Scene/Scene.hpp>
+#include <helsinki/System/glm.hpp>
+#include <cstring>
+#include <format>
+#include <memory>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace hl
+{
+	enum class SerializedFieldType : uint32_t
+	{
+		Int32,
+		UInt32,
+		Float,
+		Bool,
+		Vec2,
+		Vec3,
+		Vec4,
+		String,
+		Entity
+	};
+
+	struct SceneWriteContext
+	{
+		// Every string in the file, fields store an offset and length into it.
+		// Repeated strings are only stored once.
+		std::string strings;
+		std::unordered_map<std::string, uint32_t> stringOffsets;
+		// Position of each saved entity in the file, indexed by its handle slot.
+		std::vector<uint32_t> entityIndices;
+		const Scene* scene{ nullptr };
+
+		uint32_t addString(const std::string& value);
+		// UINT32_MAX for ids that are invalid or not part of the file.
+		uint32_t getEntityIndex(int id) const;
+	};
+
+	struct SceneReadContext
+	{
+		std::span<const std::byte> strings;
+		// Handle given to each loaded entity, by its position in the file.
+		std::vector<int> entities;
+
+		std::string getString(uint32_t offset, uint32_t length) const;
+		int getEntity(uint32_t index) const;
+	};
+
+	// How a C++ type is packed into the binary format and shown in the JSON export.
+	template<typename V>
+	struct SerializedFieldTraits;
+
+	template<typename V>
+	struct SerializedScalarTraits
+	{
+		static constexpr uint32_t Size = 4;
+
+		static void write(const V& value, std::byte* out, SceneWriteContext&) { std::memcpy(out, &value, Size); }
+		static void read(V& value, const std::byte* in, const SceneReadContext&) { std::memcpy(&value, in, Size); }
+		static std::string toString(const V& value) { return std::format("{}", value); }
+	};
+
+	template<> struct SerializedFieldTraits<int32_t> : SerializedScalarTraits<int32_t> { static constexpr auto Type = SerializedFieldType::Int32; };
+	template<> struct SerializedFieldTraits<uint32_t> : SerializedScalarTraits<uint32_t> { static constexpr auto Type = SerializedFieldType::UInt32; };
+	template<> struct SerializedFieldTraits<float> : SerializedScalarTraits<float> { static constexpr auto Type = SerializedFieldType::Float; };
+
+	template<>
+	struct SerializedFieldTraits<bool>
+	{
+		static constexpr auto Type = SerializedFieldType::Bool;
+		static constexpr uint32_t Size = 4;
+
+		static void write(const bool& value, std::byte* out, SceneWriteContext&)
+		{
+			const uint32_t packed = value ? 1 : 0;
+			std::memcpy(out, &packed, Size);
+		}
+		static void read(bool& value, const std::byte* in, const SceneReadContext&)
+		{
+			uint32_t packed;
+			std::memcpy(&packed, in, Size);
+			value = packed != 0;
+		}
+		static std::string toString(const bool& value) { return value ? "true" : "false"; }
+	};
+
+	// glm vectors are packed as their floats, whatever the alignment glm is using.
+	template<typename V, uint32_t N>
+	struct SerializedVectorTraits
+	{
+		static constexpr uint32_t Size = N * sizeof(float);
+
+		static void write(const V& value, std::byte* out, SceneWriteContext&)
+		{
+			float packed[N];
+			for (uint32_t i = 0; i < N; ++i)
+			{
+				packed[i] = value[i];
+			}
+			std::memcpy(out, packed, Size);
+		}
+		static void read(V& value, const std::byte* in, const SceneReadContext&)
+		{
+			float packed[N];
+			std::memcpy(packed, in, Size);
+			for (uint32_t i = 0; i < N; ++i)
+			{
+				value[i] = packed[i];
+			}
+		}
+		static std::string toString(const V& value)
+		{
+			std::string result;
+			for (uint32_t i = 0; i < N; ++i)
+			{
+				if (i > 0)
+				{
+					result += ", ";
+				}
+				result += std::format("{}", value[i]);
+			}
+			return result;
+		}
+	};
+
+	template<> struct SerializedFieldTraits<glm::vec2> : SerializedVectorTraits<glm::vec2, 2> { static constexpr auto Type = SerializedFieldType::Vec2; };
+	template<> struct SerializedFieldTraits<glm::vec3> : SerializedVectorTraits<glm::vec3, 3> { static constexpr auto Type = SerializedFieldType::Vec3; };
+	template<> struct SerializedFieldTraits<glm::vec4> : SerializedVectorTraits<glm::vec4, 4> { static constexpr auto Type = SerializedFieldType::Vec4; };
+
+	template<>
+	struct SerializedFieldTraits<std::string>
+	{
+		static constexpr auto Type = SerializedFieldType::String;
+		static constexpr uint32_t Size = 8;
+
+		static void write(const std::string& value, std::byte* out, SceneWriteContext& context)
+		{
+			const uint32_t packed[2] = { context.addString(value), (uint32_t)value.size() };
+			std::memcpy(out, packed, Size);
+		}
+		static void read(std::string& value, const std::byte* in, const SceneReadContext& context)
+		{
+			uint32_t packed[2];
+			std::memcpy(packed, in, Size);
+			value = context.getString(packed[0], packed[1]);
+		}
+		static std::string toString(const std::string& value) { return value; }
+	};
+
+	// Entity ids are stored as positions in the file and given the new ids on load.
+	struct SerializedEntityTraits
+	{
+		static constexpr auto Type = SerializedFieldType::Entity;
+		static constexpr uint32_t Size = 4;
+
+		static void write(const int& value, std::byte* out, SceneWriteContext& context)
+		{
+			const auto index = context.getEntityIndex(value);
+			std::memcpy(out, &index, Size);
+		}
+		static void read(int& value, const std::byte* in, const SceneReadContext& context)
+		{
+			uint32_t index;
+			std::memcpy(&index, in, Size);
+			value = context.getEntity(index);
+		}
+		static std::string toString(const int& value) { return std::format("{}", value); }
+	};
+
+	struct SerializedField
+	{
+		std::string name;
+		SerializedFieldType type;
+		uint32_t size;
+		void (*write)(const void* component, std::byte* out, SceneWriteContext& context);
+		void (*read)(void* component, const std::byte* in, const SceneReadContext& context);
+		std::string (*toString)(const void* component);
+	};
+
+	struct SerializedComponent
+	{
+		std::string name;
+		const ComponentTypeInfo* type;
+		std::vector<SerializedField> fields;
+	};
+
+	// Describes the fields of a component registered with a SceneSerializer.
+	template<typename T>
+	class SerializedComponentFields
+	{
+	public:
+		explicit SerializedComponentFields(SerializedComponent& component) : _component(component) {}
+
+		// A public data member, e.g. field<&KinematicComponent::velocity>("velocity").
+		template<auto Member>
+		SerializedComponentFields& field(const std::string& name)
+		{
+			using Value = std::remove_cvref_t<decltype(std::declval<T&>().*Member)>;
+			using Traits = SerializedFieldTraits<Value>;
+
+			return add(SerializedField
+				{
+					.name = name,
+					.type = Traits::Type,
+					.size = Traits::Size,
+					.write = [](const void* component, std::byte* out, SceneWriteContext& context)
+					{
+						Traits::write(static_cast<const T*>(component)->*Member, out, context);
+					},
+					.read = [](void* component, const std::byte* in, const SceneReadContext& context)
+					{
+						Traits::read(static_cast<T*>(component)->*Member, in, context);
+					},
+					.toString = [](const void* component)
+					{
+						return Traits::toString(static_cast<const T*>(component)->*Member);
+					}
+				});
+		}
+
+		// A getter/setter pair, e.g. field<&TransformComponent::GetPosition, &TransformComponent::SetPosition>("position").
+		template<auto Getter, auto Setter>
+		SerializedComponentFields& field(const std::string& name)
+		{
+			using Value = std::remove_cvref_t<decltype((std::declval<const T&>().*Getter)())>;
+			return accessor<Getter, Setter, SerializedFieldTraits<Value>>(name);
+		}
+
+		// A getter/setter pair for an entity id, which is remapped when loading.
+		template<auto Getter, auto Setter>
+		SerializedComponentFields& entityField(const std::string& name)
+		{
+			return accessor<Getter, Setter, SerializedEntityTraits>(name);
+		}
+
+	private:
+		template<auto Getter, auto Setter, typename Traits>
+		SerializedComponentFields& accessor(const std::string& name)
+		{
+			return add(SerializedField
+				{
+					.name = name,
+					.type = Traits::Type,
+					.size = Traits::Size,
+					.write = [](const void* component, std::byte* out, SceneWriteContext& context)
+					{
+						Traits::write((static_cast<const T*>(component)->*Getter)(), out, context);
+					},
+					.read = [](void* component, const std::byte* in, const SceneReadContext& context)
+					{
+						std::remove_cvref_t<decltype((std::declval<const T&>().*Getter)())> value{};
+						Traits::read(value, in, context);
+						(static_cast<T*>(component)->*Setter)(value);
+					},
+					.toString = [](const void* component)
+					{
+						return Traits::toString((static_cast<const T*>(component)->*Getter)());
+					}
+				});
+		}
+
+		SerializedComponentFields& add(SerializedField field)
+		{
+			_component.fields.push_back(std::move(field));
+			return *this;
+		}
+
+	private:
+		SerializedComponent& _component;
+	};
+
+	// Saves and loads scenes in a compact, versioned binary format.
+	// Only components registered with the serializer are saved, fields are
+	// matched by name on load so components can gain and lose fields between
+	// versions, unknown components and fields in the data are skipped.
+	//
+	// Entities are stored grouped by archetype, and within each group every
+	// field is a packed array, so loading creates each entity straight into its
+	// final archetype and copies fields in column order. Layout, all values in
+	// host byte order:
+	//
+	//   Header      "HLSC", version, component, tag, block and entity counts,
+	//               offset and size of the string table
+	//   Components  name and field descriptions (name, type) of each component
+	//   Tags        the hash of each tag, entity tag masks index into these
+	//   Blocks      entity count, component indices, then per entity its name
+	//               and tag mask, then one packed array per component field
+	//   Strings     every name and string field value
+	class SceneSerializer
+	{
+	public:
+		static constexpr uint32_t Version = 1;
+
+		// The name is what identifies the component in saved data.
+		template<typename T>
+		SerializedComponentFields<T> registerComponent(const std::string& name)
+		{
+			static_assert(std::is_base_of<Component, T>::value, "T must derive from Component");
+			static_assert(std::is_default_constructible_v<T>, "Serialized components are default constructed on load");
+
+			auto& component = *_components.emplace_back(std::make_unique<SerializedComponent>(SerializedComponent
+				{
+					.name = name,
+					.type = &ComponentTypeInfo::Get<T>(),
+					.fields = {}
+				}));
+
+			return SerializedComponentFields<T>(component);
+		}
+
+		// Transform, kinematic, sprite and model components.
+		void registerEngineComponents();
+
+		std::vector<std::byte> save(const Scene& scene) const;
+		void saveToFile(const Scene& scene, const std::string& path) const;
+
+		// Adds the saved entities to the scene. The data is only read from, so it
+		// can point straight at a memory mapped file.
+		void load(Scene& scene, std::span<const std::byte> data) const;
+		void loadFromFile(Scene& scene, const std::string& path) const;
+
+		// Human readable dump of the registered components of every entity.
+		std::string toJson(const Scene& scene) const;
+
+	private:
+		const SerializedComponent* findComponent(const std::string& name) const;
+
+	private:
+		std::vector<std::unique_ptr<SerializedComponent>> _components;
+	};
+}
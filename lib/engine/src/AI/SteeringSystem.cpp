@@ -0,0 +1,175 @@
+#include <helsinki/Engine/AI/SteeringSystem.hpp>
+#include <helsinki/System/HelsinkiTracy.hpp>
+#include <algorithm>
+#include <cassert>
+
+namespace hl
+{
+	// Moves up to step towards goal, landing on it rather than overshooting.
+	// Returns true once there.
+	static bool moveTowards(glm::vec3& position, const glm::vec3& goal, float step)
+	{
+		const auto offset = goal - position;
+		const auto distance = glm::length(offset);
+		if (distance <= step)
+		{
+			position = goal;
+			return true;
+		}
+
+		position += offset * (step / distance);
+		return false;
+	}
+
+	// Agents that stay put are left alone so their transforms stay clean.
+	static void setPosition(TransformComponent& transform, const glm::vec3& position)
+	{
+		if (position != transform.GetPosition())
+		{
+			transform.SetPosition(position);
+		}
+	}
+
+	SteeringSystem::SteeringSystem(Scene& scene) :
+		_scene(scene),
+		_patrollers(scene.query<TransformComponent, PatrolComponent>()),
+		_seekers(scene.query<TransformComponent, SeekComponent>()),
+		_trackers(scene.query<TransformComponent, TrackAxisComponent>())
+	{
+		access()
+			.writes<TransformComponent, PatrolComponent>()
+			.reads<SeekComponent, TrackAxisComponent, KinematicComponent>();
+	}
+
+	void SteeringSystem::update(float delta)
+	{
+		ZoneScopedN("SteeringSystem::update");
+
+		patrol(delta);
+		seek(delta);
+		trackAxis(delta);
+	}
+
+	SteeringSystem::Target SteeringSystem::resolve(int id)
+	{
+		const auto slot = EntityHandle::index(id);
+		if (slot < _targetBySlot.size())
+		{
+			const auto index = _targetBySlot[slot];
+			if (index < _targets.size() && _targets[index].id == id)
+			{
+				// Nothing the passes do may move the target's components.
+				assert(_targets[index].transform == nullptr ||
+					_targets[index].transform == _scene.getEntity(id)->GetComponent<TransformComponent>());
+				return _targets[index];
+			}
+		}
+		else
+		{
+			_targetBySlot.resize(slot + 1, NoTarget);
+		}
+
+		auto& target = _targets.emplace_back(Target{ .id = id });
+		if (auto entity = _scene.getEntity(id); entity != nullptr)
+		{
+			target.transform = entity->GetComponent<TransformComponent>();
+			target.kinematic = entity->GetComponent<KinematicComponent>();
+		}
+		_targetBySlot[slot] = (uint32_t)(_targets.size() - 1);
+		return target;
+	}
+
+	void SteeringSystem::clearTargets()
+	{
+		for (const auto& target : _targets)
+		{
+			_targetBySlot[EntityHandle::index(target.id)] = NoTarget;
+		}
+		_targets.clear();
+	}
+
+	void SteeringSystem::patrol(float delta)
+	{
+		_patrollers.eachChunk([&](Entity**, TransformComponent* transforms, PatrolComponent* patrols, uint32_t count)
+			{
+				for (uint32_t i = 0; i < count; ++i)
+				{
+					auto& patrol = patrols[i];
+					auto position = transforms[i].GetPosition();
+					if (moveTowards(position, patrol.returning ? patrol.from : patrol.to, patrol.speed * delta))
+					{
+						patrol.returning = !patrol.returning;
+					}
+					setPosition(transforms[i], position);
+				}
+			});
+	}
+
+	void SteeringSystem::seek(float delta)
+	{
+		clearTargets();
+		_seekers.eachChunk([&](Entity**, TransformComponent* transforms, SeekComponent* seekers, uint32_t count)
+			{
+				for (uint32_t i = 0; i < count; ++i)
+				{
+					const auto& seeker = seekers[i];
+					const auto target = resolve(seeker.target);
+					const auto goal = target.transform != nullptr ? target.transform->GetPosition() : seeker.point;
+
+					auto position = transforms[i].GetPosition();
+					auto speed = seeker.maxSpeed;
+					if (seeker.slowingRadius > 0.0f)
+					{
+						speed *= std::min(glm::length(goal - position) / seeker.slowingRadius, 1.0f);
+					}
+
+					moveTowards(position, goal, speed * delta);
+					setPosition(transforms[i], position);
+				}
+			});
+	}
+
+	void SteeringSystem::trackAxis(float delta)
+	{
+		clearTargets();
+		_trackers.eachChunk([&](Entity**, TransformComponent* transforms, TrackAxisComponent* trackers, uint32_t count)
+			{
+				for (uint32_t i = 0; i < count; ++i)
+				{
+					const auto& tracker = trackers[i];
+					const auto target = resolve(tracker.target);
+					if (target.transform == nullptr)
+					{
+						continue;
+					}
+
+					auto position = transforms[i].GetPosition();
+					const auto& targetPosition = target.transform->GetPosition();
+
+					// From the target to the agent with the tracked axis left out.
+					auto across = position - targetPosition;
+					across[tracker.axis] = 0.0f;
+
+					auto goal = targetPosition[tracker.axis] + tracker.offset;
+					if (glm::dot(across, across) > tracker.sightRange * tracker.sightRange)
+					{
+						goal = tracker.rest;
+					}
+					else if (tracker.ignoreReceding && target.kinematic != nullptr)
+					{
+						auto velocity = target.kinematic->velocity;
+						velocity[tracker.axis] = 0.0f;
+						if (glm::dot(velocity, across) < 0.0f)
+						{
+							continue;
+						}
+					}
+
+					const auto step = tracker.maxSpeed * delta;
+					const auto coordinate = position[tracker.axis];
+					position[tracker.axis] = std::clamp(std::clamp(goal, tracker.min, tracker.max), coordinate - step, coordinate + step);
+					setPosition(transforms[i], position);
+				}
+			});
+	}
+}
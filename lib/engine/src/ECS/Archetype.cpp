@@ -0,0 +1,145 @@
+#include <helsinki/Engine/ECS/Archetype.hpp>
+#include <helsinki/Engine/ECS/Entity.hpp>
+#include <algorithm>
+#include <stdexcept>
+
+namespace hl
+{
+	static size_t alignUp(size_t value, size_t alignment)
+	{
+		return (value + alignment - 1) & ~(alignment - 1);
+	}
+
+	Archetype::Archetype(
+		std::vector<const ComponentTypeInfo*> types,
+		const TagMask& tags,
+		PoolAllocator& chunkAllocator
+	) :
+		_types(std::move(types)),
+		_tags(tags),
+		_chunkAllocator(chunkAllocator)
+	{
+		std::sort(_types.begin(), _types.end(), [](const ComponentTypeInfo* lhs, const ComponentTypeInfo* rhs)
+			{
+				return lhs->id < rhs->id;
+			});
+
+		_columnsByTypeIndex.fill(-1);
+		for (size_t i = 0; i < _types.size(); ++i)
+		{
+			_signature.push_back(_types[i]->id);
+			_mask.set(_types[i]->index);
+			_columnsByTypeIndex[_types[i]->index] = (int16_t)i;
+		}
+
+		const auto layoutFor = [&](uint32_t capacity) -> size_t
+			{
+				_columnOffsets.clear();
+
+				size_t offset = sizeof(Entity*) * capacity;
+				for (const auto type : _types)
+				{
+					offset = alignUp(offset, type->alignment);
+					_columnOffsets.push_back(offset);
+					offset += type->size * capacity;
+				}
+
+				return offset;
+			};
+
+		size_t rowSize = sizeof(Entity*);
+		for (const auto type : _types)
+		{
+			rowSize += type->size;
+		}
+
+		// Start from the unpadded estimate and back off until the padding fits too.
+		_chunkCapacity = (uint32_t)std::max<size_t>(1, ArchetypeChunk::Size / rowSize);
+		while (_chunkCapacity > 1 && layoutFor(_chunkCapacity) > ArchetypeChunk::Size)
+		{
+			_chunkCapacity--;
+		}
+
+		if (layoutFor(_chunkCapacity) > ArchetypeChunk::Size)
+		{
+			throw std::runtime_error("Component set is too large to fit in a single archetype chunk");
+		}
+	}
+	Archetype::~Archetype()
+	{
+		while (_count > 0)
+		{
+			destroyRow(_count - 1);
+		}
+
+		for (const auto& chunk : _chunks)
+		{
+			_chunkAllocator.deallocate(chunk._data);
+		}
+	}
+
+	Entity* Archetype::getEntity(uint32_t row) const
+	{
+		return getEntities(chunkForRow(row))[row % _chunkCapacity];
+	}
+
+	void* Archetype::getComponent(uint32_t row, size_t column) const
+	{
+		return static_cast<std::byte*>(getColumn(chunkForRow(row), column)) + _types[column]->size * (row % _chunkCapacity);
+	}
+
+	uint32_t Archetype::allocateRow(Entity* entity)
+	{
+		if (_count == _chunks.size() * _chunkCapacity)
+		{
+			_chunks.emplace_back(static_cast<std::byte*>(_chunkAllocator.allocate()));
+		}
+
+		const auto row = _count++;
+		auto& chunk = _chunks[row / _chunkCapacity];
+		getEntities(chunk)[row % _chunkCapacity] = entity;
+		chunk._count++;
+
+		return row;
+	}
+
+	void Archetype::destroyRow(uint32_t row)
+	{
+		for (size_t column = 0; column < _types.size(); ++column)
+		{
+			_types[column]->destruct(getComponent(row, column));
+		}
+
+		releaseRow(row);
+	}
+
+	void Archetype::releaseRow(uint32_t row)
+	{
+		const auto last = _count - 1;
+
+		if (row != last)
+		{
+			for (size_t column = 0; column < _types.size(); ++column)
+			{
+				auto source = getComponent(last, column);
+				_types[column]->moveConstruct(getComponent(row, column), source);
+				_types[column]->destruct(source);
+			}
+
+			auto moved = getEntity(last);
+			getEntities(chunkForRow(row))[row % _chunkCapacity] = moved;
+			moved->_location.row = row;
+		}
+
+		_count--;
+		_chunks[last / _chunkCapacity]._count--;
+
+		// Hand a trailing chunk back to the pool once a second one is empty, the
+		// spare stops an archetype that hovers around a chunk boundary churning.
+		if ((_chunks.size() - 1) * _chunkCapacity >= (size_t)_count + _chunkCapacity)
+		{
+			_chunkAllocator.deallocate(_chunks.back()._data);
+			_chunks.pop_back();
+		}
+	}
+}
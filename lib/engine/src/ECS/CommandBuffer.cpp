@@ -0,0 +1,208 @@
+#include <helsinki/Engine/ECS/CommandBuffer.hpp>
+#include <helsinki/Engine/Scene/Scene.hpp>
+#include <algorithm>
+
+namespace hl
+{
+	CommandBuffer::~CommandBuffer()
+	{
+		destroyPending();
+
+		for (const auto& block : _blocks)
+		{
+			::operator delete(block.data, std::align_val_t{ BlockAlignment });
+		}
+	}
+
+	DeferredEntity CommandBuffer::createEntity()
+	{
+		DeferredEntity entity;
+		entity.created = _createdCount++;
+		record(CommandType::CreateEntity, entity, nullptr, nullptr);
+		return entity;
+	}
+	DeferredEntity CommandBuffer::createEntity(const std::string& name)
+	{
+		DeferredEntity entity;
+		entity.created = _createdCount++;
+		_names.push_back(name);
+		// Names are stored one based so that 0 means unnamed.
+		record(CommandType::CreateEntity, entity, nullptr, nullptr, (uint32_t)_names.size());
+		return entity;
+	}
+	DeferredEntity CommandBuffer::spawn(EntityPool& pool)
+	{
+		DeferredEntity entity;
+		entity.created = _createdCount++;
+		record(CommandType::SpawnEntity, entity, nullptr, &pool);
+		return entity;
+	}
+	void CommandBuffer::destroyEntity(DeferredEntity entity)
+	{
+		record(CommandType::DestroyEntity, entity, nullptr, nullptr);
+	}
+
+	void CommandBuffer::addTag(DeferredEntity entity, uint32_t tagHash)
+	{
+		record(CommandType::AddTag, entity, nullptr, nullptr, tagHash);
+	}
+	void CommandBuffer::clearTag(DeferredEntity entity, uint32_t tagHash)
+	{
+		record(CommandType::ClearTag, entity, nullptr, nullptr, tagHash);
+	}
+
+	void CommandBuffer::playback(Scene& scene)
+	{
+		if (_commands.empty())
+		{
+			return;
+		}
+
+		_createdIds.assign(_createdCount, EntityHandle::Invalid);
+
+		try
+		{
+			for (auto& command : _commands)
+			{
+				if (command.type == CommandType::CreateEntity)
+				{
+					const auto e = command.value == 0
+						? scene.addEntity()
+						: scene.addEntity(_names[command.value - 1]);
+					_createdIds[command.entity.created] = e->Id;
+					continue;
+				}
+				if (command.type == CommandType::SpawnEntity)
+				{
+					_createdIds[command.entity.created] = scene.spawn(*static_cast<EntityPool*>(command.data))->Id;
+					continue;
+				}
+
+				const auto id = command.entity.created == DeferredEntity::NotCreated
+					? command.entity.id
+					: _createdIds[command.entity.created];
+				const auto entity = scene.getEntity(id);
+
+				switch (command.type)
+				{
+				case CommandType::DestroyEntity:
+					scene.removeEntity(id);
+					break;
+				case CommandType::AddComponent:
+					if (entity != nullptr)
+					{
+						entity->adoptComponent(*command.component, command.data);
+					}
+					else
+					{
+						command.component->destruct(command.data);
+					}
+					command.data = nullptr;
+					break;
+				case CommandType::SetComponent:
+					if (entity != nullptr)
+					{
+						entity->replaceComponent(*command.component, command.data);
+					}
+					else
+					{
+						command.component->destruct(command.data);
+					}
+					command.data = nullptr;
+					break;
+				case CommandType::RemoveComponent:
+					if (entity != nullptr)
+					{
+						entity->removeComponent(*command.component);
+					}
+					break;
+				case CommandType::AddTag:
+					if (entity != nullptr)
+					{
+						entity->AddTag(command.value);
+					}
+					break;
+				case CommandType::ClearTag:
+					if (entity != nullptr)
+					{
+						entity->ClearTag(command.value);
+					}
+					break;
+				case CommandType::CreateEntity:
+				case CommandType::SpawnEntity:
+					break;
+				}
+			}
+		}
+		catch (...)
+		{
+			clear();
+			throw;
+		}
+
+		clear();
+	}
+
+	void CommandBuffer::clear()
+	{
+		destroyPending();
+
+		_commands.clear();
+		_names.clear();
+		_createdCount = 0;
+		_block = 0;
+		_offset = 0;
+	}
+
+	void CommandBuffer::record(CommandType type, DeferredEntity entity, const ComponentTypeInfo* component, void* data, uint32_t value)
+	{
+		_commands.push_back(Command
+			{
+				.type = type,
+				.entity = entity,
+				.component = component,
+				.data = data,
+				.value = value
+			});
+	}
+
+	void* CommandBuffer::allocate(size_t size, size_t alignment)
+	{
+		while (_block < _blocks.size())
+		{
+			auto& block = _blocks[_block];
+			const auto offset = (_offset + alignment - 1) & ~(alignment - 1);
+			if (offset + size <= block.size)
+			{
+				_offset = offset + size;
+				return block.data + offset;
+			}
+
+			_block++;
+			_offset = 0;
+		}
+
+		const auto blockSize = std::max(BlockSize, size + alignment);
+		_blocks.push_back(Block
+			{
+				.data = static_cast<std::byte*>(::operator new(blockSize, std::align_val_t{ BlockAlignment })),
+				.size = blockSize
+			});
+
+		_block = _blocks.size() - 1;
+		_offset = size;
+		return _blocks.back().data;
+	}
+
+	void CommandBuffer::destroyPending()
+	{
+		for (auto& command : _commands)
+		{
+			if ((command.type == CommandType::AddComponent || command.type == CommandType::SetComponent) && command.data != nullptr)
+			{
+				command.component->destruct(command.data);
+				command.data = nullptr;
+			}
+		}
+	}
+}
@@ -0,0 +1,420 @@
+#include <helsinki/Engine/ECS/ComponentStorage.hpp>
+#include <helsinki/Engine/ECS/Entity.hpp>
+#include <algorithm>
+#include <stdexcept>
+
+namespace hl
+{
+	size_t ComponentStorage::SignatureHash::operator()(const std::vector<size_t>& signature) const
+	{
+		size_t hash = signature.size();
+		for (const auto id : signature)
+		{
+			hash ^= id + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2);
+		}
+		return hash;
+	}
+
+	ComponentStorage::ComponentStorage()
+	{
+		_root = getOrCreateArchetype({}, {});
+	}
+	ComponentStorage::~ComponentStorage()
+	{
+
+	}
+
+	void ComponentStorage::createEntity(Entity& entity)
+	{
+		entity._location = EntityLocation
+		{
+			.archetype = _root,
+			.row = _root->allocateRow(&entity)
+		};
+	}
+
+	// Constructs every column of a new row with construct(type, column, component),
+	// unwinding what was constructed if one of them throws.
+	template<typename F>
+	static uint32_t constructRow(Entity& entity, Archetype& archetype, F&& construct)
+	{
+		const auto row = archetype.allocateRow(&entity);
+		const auto& types = archetype.getTypes();
+
+		size_t constructed = 0;
+		try
+		{
+			for (; constructed < types.size(); ++constructed)
+			{
+				auto component = archetype.getComponent(row, constructed);
+				construct(*types[constructed], constructed, component);
+				types[constructed]->setOwner(component, &entity);
+			}
+		}
+		catch (...)
+		{
+			while (constructed > 0)
+			{
+				constructed--;
+				types[constructed]->destruct(archetype.getComponent(row, constructed));
+			}
+			archetype.releaseRow(row);
+			throw;
+		}
+
+		return row;
+	}
+
+	void ComponentStorage::createEntity(Entity& entity, Archetype& archetype)
+	{
+		const auto row = constructRow(entity, archetype, [](const ComponentTypeInfo& type, size_t, void* component)
+			{
+				if (type.defaultConstruct == nullptr)
+				{
+					throw std::runtime_error("Component is not default constructible");
+				}
+
+				type.defaultConstruct(component);
+			});
+
+		entity._location = EntityLocation
+		{
+			.archetype = &archetype,
+			.row = row
+		};
+	}
+
+	void ComponentStorage::createEntity(Entity& entity, Archetype& archetype, const std::vector<const void*>& prototypes)
+	{
+		if (prototypes.size() != archetype.getTypes().size())
+		{
+			throw std::runtime_error("Every component of the archetype needs a prototype");
+		}
+
+		const auto row = constructRow(entity, archetype, [&](const ComponentTypeInfo& type, size_t column, void* component)
+			{
+				if (type.copyConstruct == nullptr)
+				{
+					throw std::runtime_error("Component is not copy constructible");
+				}
+
+				type.copyConstruct(component, prototypes[column]);
+			});
+
+		entity._location = EntityLocation
+		{
+			.archetype = &archetype,
+			.row = row
+		};
+	}
+
+	void ComponentStorage::moveEntity(Entity& source, Entity& destination, Archetype& target)
+	{
+		auto from = source._location.archetype;
+		const auto fromRow = source._location.row;
+		if (from->getMask() != target.getMask())
+		{
+			throw std::runtime_error("Entities can only be moved between archetypes with the same components");
+		}
+
+		const auto row = target.allocateRow(&destination);
+
+		// Both archetypes sort their columns the same way.
+		const auto& types = from->getTypes();
+		for (size_t column = 0; column < types.size(); ++column)
+		{
+			auto component = from->getComponent(fromRow, column);
+			auto moved = target.getComponent(row, column);
+			types[column]->moveConstruct(moved, component);
+			types[column]->destruct(component);
+			types[column]->setOwner(moved, &destination);
+		}
+
+		from->releaseRow(fromRow);
+		if (&source != &destination)
+		{
+			source._location = {};
+		}
+		destination._location = EntityLocation
+		{
+			.archetype = &target,
+			.row = row
+		};
+	}
+
+	void ComponentStorage::destroyEntity(Entity& entity)
+	{
+		auto& location = entity._location;
+		if (location.archetype == nullptr)
+		{
+			return;
+		}
+
+		location.archetype->destroyRow(location.row);
+		location = {};
+	}
+
+	void* ComponentStorage::addComponent(Entity& entity, const ComponentTypeInfo& type)
+	{
+		auto source = entity._location.archetype;
+		const auto sourceRow = entity._location.row;
+		auto target = getAddTarget(source, type);
+
+		const auto targetRow = target->allocateRow(&entity);
+
+		const auto& sourceTypes = source->getTypes();
+		for (size_t column = 0; column < sourceTypes.size(); ++column)
+		{
+			auto component = source->getComponent(sourceRow, column);
+			sourceTypes[column]->moveConstruct(
+				target->getComponent(targetRow, (size_t)target->getColumnIndex(sourceTypes[column]->index)),
+				component);
+			sourceTypes[column]->destruct(component);
+		}
+
+		source->releaseRow(sourceRow);
+		entity._location = EntityLocation
+		{
+			.archetype = target,
+			.row = targetRow
+		};
+
+		return target->getComponent(targetRow, (size_t)target->getColumnIndex(type.index));
+	}
+
+	void ComponentStorage::addComponents(Entity& entity, std::initializer_list<const ComponentTypeInfo*> types, std::initializer_list<void*> components)
+	{
+		auto source = entity._location.archetype;
+		auto target = source;
+		for (const auto type : types)
+		{
+			if (!target->hasComponent(type->index))
+			{
+				target = getAddTarget(target, *type);
+			}
+		}
+
+		if (target == source)
+		{
+			return;
+		}
+
+		const auto sourceRow = entity._location.row;
+		const auto targetRow = target->allocateRow(&entity);
+
+		const auto& sourceTypes = source->getTypes();
+		for (size_t column = 0; column < sourceTypes.size(); ++column)
+		{
+			auto component = source->getComponent(sourceRow, column);
+			sourceTypes[column]->moveConstruct(
+				target->getComponent(targetRow, (size_t)target->getColumnIndex(sourceTypes[column]->index)),
+				component);
+			sourceTypes[column]->destruct(component);
+		}
+
+		// The first of a type given twice wins, as it would adding them one by one.
+		ComponentMask added;
+		auto component = components.begin();
+		for (const auto type : types)
+		{
+			if (!source->hasComponent(type->index) && !added.test(type->index))
+			{
+				auto slot = target->getComponent(targetRow, (size_t)target->getColumnIndex(type->index));
+				type->moveConstruct(slot, *component);
+				type->setOwner(slot, &entity);
+				added.set(type->index);
+			}
+			++component;
+		}
+
+		source->releaseRow(sourceRow);
+		entity._location = EntityLocation
+		{
+			.archetype = target,
+			.row = targetRow
+		};
+	}
+
+	bool ComponentStorage::removeComponent(Entity& entity, const ComponentTypeInfo& type)
+	{
+		auto source = entity._location.archetype;
+		if (!source->hasComponent(type.index))
+		{
+			return false;
+		}
+
+		const auto sourceRow = entity._location.row;
+		auto target = getRemoveTarget(source, type.id);
+
+		const auto targetRow = target->allocateRow(&entity);
+
+		const auto& sourceTypes = source->getTypes();
+		for (size_t column = 0; column < sourceTypes.size(); ++column)
+		{
+			auto component = source->getComponent(sourceRow, column);
+			if (sourceTypes[column]->id != type.id)
+			{
+				sourceTypes[column]->moveConstruct(
+					target->getComponent(targetRow, (size_t)target->getColumnIndex(sourceTypes[column]->index)),
+					component);
+			}
+			sourceTypes[column]->destruct(component);
+		}
+
+		source->releaseRow(sourceRow);
+		entity._location = EntityLocation
+		{
+			.archetype = target,
+			.row = targetRow
+		};
+
+		return true;
+	}
+
+	void ComponentStorage::setTag(Entity& entity, uint32_t tagIndex, bool value)
+	{
+		auto source = entity._location.archetype;
+		auto target = getTagTarget(source, tagIndex, value);
+		if (target != source)
+		{
+			moveEntity(entity, entity, *target);
+		}
+	}
+
+	Archetype* ComponentStorage::getOrCreateArchetype(std::vector<const ComponentTypeInfo*> types, const TagMask& tags)
+	{
+		std::sort(types.begin(), types.end(), [](const ComponentTypeInfo* lhs, const ComponentTypeInfo* rhs)
+			{
+				return lhs->id < rhs->id;
+			});
+
+		// The tags always come last, so they cannot be mistaken for a type id.
+		static_assert(TagRegistry::MaxTags <= 64);
+		std::vector<size_t> signature;
+		signature.reserve(types.size() + 1);
+		for (const auto type : types)
+		{
+			signature.push_back(type->id);
+		}
+		signature.push_back((size_t)tags.to_ullong());
+
+		if (auto it = _archetypesBySignature.find(signature); it != _archetypesBySignature.end())
+		{
+			return it->second;
+		}
+
+		auto& archetype = _archetypes.emplace_back(std::make_unique<Archetype>(std::move(types), tags, _chunkAllocator));
+		_archetypesBySignature.emplace(std::move(signature), archetype.get());
+
+		for (const auto& query : _queries)
+		{
+			if (query->matches(*archetype))
+			{
+				query->add(archetype.get());
+			}
+		}
+
+		return archetype.get();
+	}
+
+	Archetype* ComponentStorage::getPoolArchetype(Archetype& archetype)
+	{
+		auto& pooled = _poolArchetypes[&archetype];
+		if (pooled == nullptr)
+		{
+			// Never added to _archetypes, which is all queries are matched against.
+			pooled = std::make_unique<Archetype>(archetype.getTypes(), archetype.getTags(), _chunkAllocator);
+		}
+
+		return pooled.get();
+	}
+
+	Archetype* ComponentStorage::getAddTarget(Archetype* source, const ComponentTypeInfo& type)
+	{
+		if (auto it = source->addEdges.find(type.id); it != source->addEdges.end())
+		{
+			return it->second;
+		}
+
+		auto types = source->getTypes();
+		types.push_back(&type);
+
+		auto target = getOrCreateArchetype(std::move(types), source->getTags());
+		source->addEdges[type.id] = target;
+		target->removeEdges[type.id] = source;
+
+		return target;
+	}
+
+	Archetype* ComponentStorage::getRemoveTarget(Archetype* source, size_t typeId)
+	{
+		if (auto it = source->removeEdges.find(typeId); it != source->removeEdges.end())
+		{
+			return it->second;
+		}
+
+		auto types = source->getTypes();
+		std::erase_if(types, [typeId](const ComponentTypeInfo* type) { return type->id == typeId; });
+
+		auto target = getOrCreateArchetype(std::move(types), source->getTags());
+		source->removeEdges[typeId] = target;
+		target->addEdges[typeId] = source;
+
+		return target;
+	}
+
+	Archetype* ComponentStorage::getTagTarget(Archetype* source, uint32_t tagIndex, bool value)
+	{
+		if (source->hasTag(tagIndex) == value)
+		{
+			return source;
+		}
+
+		auto& edges = value ? source->addTagEdges : source->removeTagEdges;
+		if (auto it = edges.find(tagIndex); it != edges.end())
+		{
+			return it->second;
+		}
+
+		auto tags = source->getTags();
+		tags.set(tagIndex, value);
+
+		auto target = getOrCreateArchetype(source->getTypes(), tags);
+		edges[tagIndex] = target;
+		(value ? target->removeTagEdges : target->addTagEdges)[tagIndex] = source;
+
+		return target;
+	}
+
+	const QueryState* ComponentStorage::getOrCreateQuery(std::vector<uint32_t> required, bool hasTag, uint32_t tag)
+	{
+		auto it = std::find_if(_queries.begin(), _queries.end(), [&](const std::unique_ptr<QueryState>& query)
+			{
+				return query->hasTag == hasTag && query->tag == tag && query->required == required;
+			});
+
+		if (it != _queries.end())
+		{
+			return it->get();
+		}
+
+		auto& query = _queries.emplace_back(std::make_unique<QueryState>());
+		query->required = std::move(required);
+		for (const auto index : query->required)
+		{
+			query->requiredMask.set(index);
+		}
+		query->hasTag = hasTag;
+		query->tag = tag;
+
+		for (const auto& archetype : _archetypes)
+		{
+			if (query->matches(*archetype))
+			{
+				query->add(archetype.get());
+			}
+		}
+
+		return query.get();
+	}
+}
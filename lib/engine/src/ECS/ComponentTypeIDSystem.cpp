@@ -1,6 +1,52 @@
 #include <helsinki/Engine/ECS/ComponentTypeIDSystem.hpp>
+#include <unordered_map>
+#include <stdexcept>
+#include <string>
+#include <mutex>
 
 namespace hl
 {
-	size_t ComponentTypeIDSystem::nextTypeID = 0;
-}
\ No newline at end of file
+	struct ComponentTypeRegistry
+	{
+		std::mutex mutex;
+		std::unordered_map<size_t, std::pair<uint32_t, std::string>> types;
+	};
+
+	static ComponentTypeRegistry& getRegistry()
+	{
+		static ComponentTypeRegistry registry;
+		return registry;
+	}
+
+	uint32_t ComponentTypeIDSystem::RegisterType(size_t typeId, std::string_view name)
+	{
+		auto& registry = getRegistry();
+		std::lock_guard lock(registry.mutex);
+
+		if (auto it = registry.types.find(typeId); it != registry.types.end())
+		{
+			if (it->second.second != name)
+			{
+				throw std::runtime_error("Component type id collision between " + it->second.second + " and " + std::string(name));
+			}
+
+			return it->second.first;
+		}
+
+		if (registry.types.size() >= MaxComponents)
+		{
+			throw std::runtime_error("Too many component types registered, increase ComponentTypeIDSystem::MaxComponents");
+		}
+
+		const auto index = (uint32_t)registry.types.size();
+		registry.types.emplace(typeId, std::make_pair(index, std::string(name)));
+		return index;
+	}
+
+	size_t ComponentTypeIDSystem::GetRegisteredTypeCount()
+	{
+		auto& registry = getRegistry();
+		std::lock_guard lock(registry.mutex);
+		return registry.types.size();
+	}
+}
@@ -2,12 +2,6 @@
 
 namespace hl
 {
-    void TransformComponent::SetPosition(const glm::vec3& pos)
-    {
-        position = pos;
-        transformDirty = true;
-    }
-
     void TransformComponent::SetRotation(const glm::vec3& rot)
     {
         rotation = rot;
@@ -19,20 +13,25 @@ namespace hl
         scale = s;
         transformDirty = true;
     }
-    
-    glm::mat4 TransformComponent::GetTransformMatrix() const
+
+    void TransformComponent::SetParent(int parentId)
     {
-        if (transformDirty)
+        if (parent != parentId)
         {
-            // Calculate transformation matrix
-            glm::mat4 translationMatrix = glm::translate(glm::mat4(1.0f), position);
-            glm::mat4 rotationMatrix = glm::mat4_cast(glm::quat(glm::vec3(glm::radians(rotation.x), glm::radians(rotation.y), glm::radians(rotation.z))));
-            glm::mat4 scaleMatrix = glm::scale(glm::mat4(1.0f), scale);
-
-            transformMatrix = translationMatrix * rotationMatrix * scaleMatrix;
-            transformDirty = false;
+            parent = parentId;
+            parentDirty = true;
         }
+    }
+
+    glm::mat4 TransformComponent::GetTransformMatrix() const
+    {
+        // translate * rotate * scale, without the two full matrix products.
+        glm::mat4 matrix = glm::mat4_cast(glm::quat(glm::vec3(glm::radians(rotation.x), glm::radians(rotation.y), glm::radians(rotation.z))));
+        matrix[0] = matrix[0] * scale.x;
+        matrix[1] = matrix[1] * scale.y;
+        matrix[2] = matrix[2] * scale.z;
+        matrix[3] = glm::vec4(position, 1.0f);
 
-        return transformMatrix;
+        return matrix;
     }
-}
\ No newline at end of file
+}
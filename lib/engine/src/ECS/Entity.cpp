@@ -6,15 +6,77 @@ namespace hl
 
 	void Entity::AddTag(const std::string& tag)
 	{
-		tags.insert(String::fnv1a_32(tag));
+		AddTag(String::fnv1a_32(tag));
+	}
+	void Entity::AddTag(uint32_t tagHash)
+	{
+		addTagIndex(_tagRegistry.getOrCreateIndex(tagHash));
+	}
+	void Entity::addTagIndex(uint32_t tagIndex)
+	{
+		if (!_tags.test(tagIndex))
+		{
+			_storage.setTag(*this, tagIndex, true);
+			_tags.set(tagIndex);
+			_tagRegistry.add(tagIndex, *this);
+		}
 	}
 	void Entity::ClearTag(const std::string& tag)
 	{
-		tags.erase(String::fnv1a_32(tag));
+		ClearTag(String::fnv1a_32(tag));
+	}
+	void Entity::ClearTag(uint32_t tagHash)
+	{
+		const auto index = _tagRegistry.findIndex(tagHash);
+		if (index != TagRegistry::InvalidIndex && _tags.test(index))
+		{
+			_storage.setTag(*this, index, false);
+			_tags.reset(index);
+			_tagRegistry.remove(index, *this);
+		}
 	}
 	bool Entity::HasTag(const std::string& tag) const
 	{
-		return tags.count(String::fnv1a_32(tag)) > 0;
+		return HasTag(String::fnv1a_32(tag));
+	}
+	bool Entity::HasTag(uint32_t tagHash) const
+	{
+		const auto index = _tagRegistry.findIndex(tagHash);
+		return index != TagRegistry::InvalidIndex && _tags.test(index);
+	}
+
+	void Entity::adoptComponent(const ComponentTypeInfo& type, void* component)
+	{
+		if (_location.archetype->hasComponent(type.index))
+		{
+			type.destruct(component);
+			return;
+		}
+
+		type.setOwner(component, this);
+
+		void* slot = _storage.addComponent(*this, type);
+		type.moveConstruct(slot, component);
+		type.destruct(component);
+	}
+	void Entity::replaceComponent(const ComponentTypeInfo& type, void* component)
+	{
+		const int column = _location.archetype->getColumnIndex(type.index);
+		if (column < 0)
+		{
+			adoptComponent(type, component);
+			return;
+		}
+
+		auto existing = _location.archetype->getComponent(_location.row, (size_t)column);
+		type.destruct(existing);
+		type.moveConstruct(existing, component);
+		type.destruct(component);
+		type.setOwner(existing, this);
+	}
+	bool Entity::removeComponent(const ComponentTypeInfo& type)
+	{
+		return _storage.removeComponent(*this, type);
 	}
 
 }
\ No newline at end of file
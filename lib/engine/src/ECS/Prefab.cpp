@@ -0,0 +1,40 @@
+#include <helsinki/Engine/ECS/Prefab.hpp>
+#include <algorithm>
+
+namespace hl
+{
+	Prefab& Prefab::addTag(uint32_t tagHash)
+	{
+		if (std::find(_tags.begin(), _tags.end(), tagHash) == _tags.end())
+		{
+			_tags.push_back(tagHash);
+		}
+
+		return *this;
+	}
+
+	std::vector<const ComponentTypeInfo*> Prefab::getTypes() const
+	{
+		std::vector<const ComponentTypeInfo*> types;
+		types.reserve(_components.size());
+		for (const auto& component : _components)
+		{
+			types.push_back(component.get_deleter().type);
+		}
+
+		return types;
+	}
+
+	void* Prefab::find(const ComponentTypeInfo& type) const
+	{
+		for (const auto& component : _components)
+		{
+			if (component.get_deleter().type->id == type.id)
+			{
+				return component.get();
+			}
+		}
+
+		return nullptr;
+	}
+}
@@ -0,0 +1,186 @@
+#include <helsinki/Engine/ECS/SystemScheduler.hpp>
+#include <helsinki/System/HelsinkiTracy.hpp>
+#include <typeinfo>
+#include <chrono>
+
+namespace hl
+{
+	static thread_local CommandBuffer* t_currentCommandBuffer = nullptr;
+
+	CommandBuffer* SystemScheduler::getCurrentCommandBuffer()
+	{
+		return t_currentCommandBuffer;
+	}
+
+	void SystemScheduler::update(const std::vector<std::unique_ptr<System>>& systems, float delta)
+	{
+		ZoneScopedN("SystemScheduler::update");
+
+		if (_builtFor != systems.size())
+		{
+			rebuild(systems);
+		}
+
+		const auto start = std::chrono::steady_clock::now();
+
+		for (const auto& batch : _batches)
+		{
+			if (!_parallel || batch.last - batch.first == 1)
+			{
+				for (size_t i = batch.first; i < batch.last; ++i)
+				{
+					runSystem(systems, i, delta);
+				}
+			}
+			else
+			{
+				runBatch(systems, batch, delta);
+			}
+		}
+
+		_lastUpdateMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	void SystemScheduler::rebuild(const std::vector<std::unique_ptr<System>>& systems)
+	{
+		_builtFor = systems.size();
+		_batches.clear();
+		_dependents.assign(systems.size(), {});
+		_dependencyCount.assign(systems.size(), 0);
+		_remaining = std::make_unique<std::atomic<uint32_t>[]>(systems.size());
+
+		_timings.resize(systems.size());
+		while (_commandBuffers.size() < systems.size())
+		{
+			_commandBuffers.emplace_back(std::make_unique<CommandBuffer>());
+		}
+		for (size_t i = 0; i < systems.size(); ++i)
+		{
+			_timings[i].name = typeid(*systems[i]).name();
+		}
+
+		size_t first = 0;
+		while (first < systems.size())
+		{
+			size_t last = first + 1;
+			if (!systems[first]->getAccess().isExclusive())
+			{
+				while (last < systems.size() && !systems[last]->getAccess().isExclusive())
+				{
+					last++;
+				}
+			}
+
+			for (size_t later = first; later < last; ++later)
+			{
+				for (size_t earlier = first; earlier < later; ++earlier)
+				{
+					if (systems[earlier]->getAccess().conflictsWith(systems[later]->getAccess()))
+					{
+						_dependents[earlier].push_back(later);
+						_dependencyCount[later]++;
+					}
+				}
+			}
+
+			_batches.push_back(Batch{ .first = first, .last = last });
+			first = last;
+		}
+	}
+
+	void SystemScheduler::runBatch(const std::vector<std::unique_ptr<System>>& systems, const Batch& batch, float delta)
+	{
+		auto& pool = _pool != nullptr ? *_pool : ThreadPool::getShared();
+
+		BatchState state;
+		state.outstanding = batch.last - batch.first;
+
+		for (size_t i = batch.first; i < batch.last; ++i)
+		{
+			_remaining[i].store(_dependencyCount[i], std::memory_order_relaxed);
+		}
+
+		for (size_t i = batch.first; i < batch.last; ++i)
+		{
+			if (_dependencyCount[i] == 0)
+			{
+				pool.submit([this, &systems, i, delta, &state]() { runScheduled(systems, i, delta, state); });
+			}
+		}
+
+		// Help out with the queued work rather than sitting idle.
+		while (state.outstanding.load(std::memory_order_acquire) > 0)
+		{
+			if (pool.tryRunTask())
+			{
+				continue;
+			}
+
+			std::unique_lock lock(state.mutex);
+			state.done.wait(lock, [&state]() { return state.outstanding.load(std::memory_order_acquire) == 0; });
+		}
+
+		std::lock_guard lock(state.mutex);
+		if (state.exception)
+		{
+			std::rethrow_exception(state.exception);
+		}
+	}
+
+	void SystemScheduler::runSystem(const std::vector<std::unique_ptr<System>>& systems, size_t index, float delta)
+	{
+		const auto start = std::chrono::steady_clock::now();
+
+		auto previous = t_currentCommandBuffer;
+		t_currentCommandBuffer = _commandBuffers[index].get();
+
+		try
+		{
+			systems[index]->update(delta);
+		}
+		catch (...)
+		{
+			t_currentCommandBuffer = previous;
+			throw;
+		}
+
+		t_currentCommandBuffer = previous;
+
+		_timings[index].milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	void SystemScheduler::runScheduled(const std::vector<std::unique_ptr<System>>& systems, size_t index, float delta, BatchState& state)
+	{
+		ZoneScopedN("SystemScheduler::runScheduled");
+
+		try
+		{
+			runSystem(systems, index, delta);
+		}
+		catch (...)
+		{
+			std::lock_guard lock(state.mutex);
+			if (!state.exception)
+			{
+				state.exception = std::current_exception();
+			}
+		}
+
+		for (const auto dependent : _dependents[index])
+		{
+			if (_remaining[dependent].fetch_sub(1, std::memory_order_acq_rel) == 1)
+			{
+				auto& pool = _pool != nullptr ? *_pool : ThreadPool::getShared();
+				pool.submit([this, &systems, dependent, delta, &state]() { runScheduled(systems, dependent, delta, state); });
+			}
+		}
+
+		// Decrement under the lock so the batch state is not released by the
+		// waiting thread while this one is still notifying.
+		std::lock_guard lock(state.mutex);
+		if (state.outstanding.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			state.done.notify_all();
+		}
+	}
+}
@@ -0,0 +1,59 @@
+#include <helsinki/Engine/ECS/TagRegistry.hpp>
+#include <helsinki/Engine/ECS/EntityHandle.hpp>
+#include <helsinki/Engine/ECS/Entity.hpp>
+#include <stdexcept>
+
+namespace hl
+{
+	uint32_t TagRegistry::getOrCreateIndex(uint32_t tagHash)
+	{
+		if (auto it = _indices.find(tagHash); it != _indices.end())
+		{
+			return it->second;
+		}
+
+		if (_tags.size() >= MaxTags)
+		{
+			throw std::runtime_error("Too many distinct tags, increase TagRegistry::MaxTags");
+		}
+
+		const auto index = (uint32_t)_tags.size();
+		_indices.emplace(tagHash, index);
+		_tags.emplace_back().hash = tagHash;
+		return index;
+	}
+
+	void TagRegistry::add(uint32_t index, Entity& entity)
+	{
+		auto& tag = _tags[index];
+		const auto slot = EntityHandle::index(entity.Id);
+
+		if (slot >= tag.positions.size())
+		{
+			tag.positions.resize(slot + 1, InvalidIndex);
+		}
+
+		tag.positions[slot] = (uint32_t)tag.entities.size();
+		tag.entities.push_back(&entity);
+	}
+
+	void TagRegistry::remove(uint32_t index, Entity& entity)
+	{
+		auto& tag = _tags[index];
+		const auto slot = EntityHandle::index(entity.Id);
+		const auto position = tag.positions[slot];
+
+		auto last = tag.entities.back();
+		tag.entities[position] = last;
+		tag.positions[EntityHandle::index(last->Id)] = position;
+
+		tag.entities.pop_back();
+		tag.positions[slot] = InvalidIndex;
+	}
+
+	const std::vector<Entity*>& TagRegistry::getEntities(uint32_t index) const
+	{
+		static const std::vector<Entity*> empty;
+		return index < _tags.size() ? _tags[index].entities : empty;
+	}
+}
@@ -0,0 +1,315 @@
+#include <helsinki/Engine/ECS/TransformHierarchy.hpp>
+#include <helsinki/Engine/Scene/Scene.hpp>
+#include <helsinki/System/HelsinkiTracy.hpp>
+#include <algorithm>
+#include <stdexcept>
+
+namespace hl
+{
+	void TransformHierarchy::update(Scene& scene)
+	{
+		ZoneScopedN("TransformHierarchy::update");
+
+		if (!_registered)
+		{
+			_transforms = scene.query<TransformComponent>();
+			_registered = true;
+		}
+
+		// Refresh the local matrices of transforms that changed and note which are
+		// still there. New transforms are appended afterwards, only reparenting
+		// means the order has to be rebuilt.
+		bool reparented = false;
+		bool anyDirty = false;
+		_seen.assign(_entities.size(), 0);
+		_added.clear();
+		_transforms.each([&](Entity& entity, TransformComponent& transform)
+			{
+				if (reparented)
+				{
+					return;
+				}
+
+				const auto index = transform.worldIndex;
+				if (index >= _entities.size() || _entities[index] != &entity)
+				{
+					_added.push_back(&entity);
+					return;
+				}
+
+				if (transform.parentDirty)
+				{
+					reparented = true;
+					return;
+				}
+
+				_seen[index] = 1;
+				if (transform.transformDirty)
+				{
+					_local[index] = transform.GetTransformMatrix();
+					_dirty[index] = 1;
+					transform.transformDirty = false;
+					anyDirty = true;
+				}
+			});
+
+		if (reparented || !patch(scene))
+		{
+			rebuild(scene);
+			anyDirty = !_entities.empty();
+		}
+		else if (!_added.empty())
+		{
+			anyDirty = true;
+		}
+
+		_lastUpdatedCount = 0;
+		if (!anyDirty)
+		{
+			return;
+		}
+
+		// Parents precede their children, so by the time a child is reached its
+		// parent's dirty flag and world matrix are final.
+		const auto size = _entities.size();
+		for (size_t i = 0; i < size; ++i)
+		{
+			const auto parent = _parents[i];
+			if (parent != NoParent)
+			{
+				_dirty[i] |= _dirty[parent];
+			}
+
+			if (_dirty[i])
+			{
+				_world[i] = parent == NoParent
+					? _local[i]
+					: _world[parent] * _local[i];
+				_lastUpdatedCount++;
+			}
+		}
+
+		std::fill(_dirty.begin(), _dirty.end(), uint8_t{ 0 });
+	}
+
+	glm::mat4 TransformHierarchy::getWorldMatrix(const TransformComponent& transform) const
+	{
+		if (transform.worldIndex < _world.size())
+		{
+			return _world[transform.worldIndex];
+		}
+
+		return transform.GetTransformMatrix();
+	}
+
+	bool TransformHierarchy::patch(Scene& scene)
+	{
+		const auto size = _entities.size();
+		if (_added.empty() && std::find(_seen.begin(), _seen.end(), uint8_t{ 0 }) == _seen.end())
+		{
+			return true;
+		}
+
+		ZoneScopedN("TransformHierarchy::patch");
+
+		// Removing keeps the order of what is left, so parents still come first.
+		_remap.resize(size);
+		uint32_t kept = 0;
+		for (size_t i = 0; i < size; ++i)
+		{
+			if (!_seen[i])
+			{
+				_remap[i] = NoParent;
+				continue;
+			}
+
+			const auto parent = _parents[i];
+			if (parent != NoParent && _remap[parent] == NoParent)
+			{
+				// Its parent was removed, so it becomes a root.
+				return false;
+			}
+
+			_remap[i] = kept;
+			_parents[kept] = parent == NoParent ? NoParent : _remap[parent];
+			if (kept != i)
+			{
+				_entities[kept] = _entities[i];
+				_dirty[kept] = _dirty[i];
+				_local[kept] = _local[i];
+				_world[kept] = _world[i];
+				_entities[kept]->GetComponent<TransformComponent>()->worldIndex = kept;
+			}
+			kept++;
+		}
+
+		_entities.resize(kept);
+		_parents.resize(kept);
+		_dirty.resize(kept);
+		_local.resize(kept);
+		_world.resize(kept);
+
+		// A new transform could be the parent an existing one has been waiting on.
+		if (_added.empty())
+		{
+			return true;
+		}
+		if (_unresolvedParents > 0)
+		{
+			return false;
+		}
+
+		// Appended after everything already placed, so only a parent added after
+		// its child in query order needs the order rebuilding.
+		for (const auto entity : _added)
+		{
+			auto transform = entity->GetComponent<TransformComponent>();
+
+			auto parentIndex = NoParent;
+			if (const auto parent = parentOf(scene, *entity); parent != nullptr)
+			{
+				parentIndex = parent->GetComponent<TransformComponent>()->worldIndex;
+				if (parentIndex >= _entities.size() || _entities[parentIndex] != parent)
+				{
+					return false;
+				}
+			}
+			else if (transform->GetParent() != EntityHandle::Invalid)
+			{
+				_unresolvedParents++;
+			}
+
+			transform->worldIndex = (uint32_t)_entities.size();
+			transform->transformDirty = false;
+			transform->parentDirty = false;
+			_entities.push_back(entity);
+			_parents.push_back(parentIndex);
+			_dirty.push_back(1);
+			_local.push_back(transform->GetTransformMatrix());
+			_world.emplace_back();
+		}
+
+		return true;
+	}
+
+	void TransformHierarchy::rebuild(Scene& scene)
+	{
+		ZoneScopedN("TransformHierarchy::rebuild");
+
+		_entities.clear();
+		_transforms.each([&](Entity& entity, TransformComponent&)
+			{
+				_entities.push_back(&entity);
+
+				const auto slot = EntityHandle::index(entity.Id);
+				if (slot >= _depths.size())
+				{
+					_depths.resize(slot + 1, UnknownDepth);
+				}
+				_depths[slot] = UnknownDepth;
+			});
+
+		// Counting sort by depth keeps siblings in query order, so rebuilding
+		// an unchanged hierarchy gives the same order.
+		uint32_t maxDepth = 0;
+		for (const auto entity : _entities)
+		{
+			maxDepth = std::max(maxDepth, depthOf(scene, *entity));
+		}
+
+		_depthOffsets.assign(maxDepth + 2, 0);
+		for (const auto entity : _entities)
+		{
+			_depthOffsets[_depths[EntityHandle::index(entity->Id)] + 1]++;
+		}
+		for (size_t depth = 1; depth < _depthOffsets.size(); ++depth)
+		{
+			_depthOffsets[depth] += _depthOffsets[depth - 1];
+		}
+
+		_sorted.resize(_entities.size());
+		for (const auto entity : _entities)
+		{
+			_sorted[_depthOffsets[_depths[EntityHandle::index(entity->Id)]]++] = entity;
+		}
+		std::swap(_entities, _sorted);
+
+		const auto size = _entities.size();
+		_parents.resize(size);
+		_dirty.assign(size, 1);
+		_local.resize(size);
+		_world.resize(size);
+
+		for (size_t i = 0; i < size; ++i)
+		{
+			auto transform = _entities[i]->GetComponent<TransformComponent>();
+			transform->worldIndex = (uint32_t)i;
+			transform->transformDirty = false;
+			transform->parentDirty = false;
+			_local[i] = transform->GetTransformMatrix();
+		}
+
+		_unresolvedParents = 0;
+		for (size_t i = 0; i < size; ++i)
+		{
+			const auto parent = parentOf(scene, *_entities[i]);
+			_parents[i] = parent == nullptr
+				? NoParent
+				: parent->GetComponent<TransformComponent>()->worldIndex;
+
+			if (parent == nullptr && _entities[i]->GetComponent<TransformComponent>()->GetParent() != EntityHandle::Invalid)
+			{
+				_unresolvedParents++;
+			}
+		}
+	}
+
+	uint32_t TransformHierarchy::depthOf(Scene& scene, Entity& entity)
+	{
+		// Walk up until reaching a root or an ancestor whose depth is known, then
+		// fill in the depths on the way back down.
+		_path.clear();
+
+		uint32_t depth = 0;
+		for (Entity* current = &entity; current != nullptr; current = parentOf(scene, *current))
+		{
+			const auto known = _depths[EntityHandle::index(current->Id)];
+			if (known != UnknownDepth)
+			{
+				depth = known + 1;
+				break;
+			}
+
+			if (_path.size() >= _entities.size())
+			{
+				throw std::runtime_error("Transform hierarchy contains a cycle");
+			}
+
+			_path.push_back(current);
+		}
+
+		for (auto it = _path.rbegin(); it != _path.rend(); ++it)
+		{
+			_depths[EntityHandle::index((*it)->Id)] = depth++;
+		}
+
+		return _depths[EntityHandle::index(entity.Id)];
+	}
+
+	Entity* TransformHierarchy::parentOf(Scene& scene, const Entity& entity) const
+	{
+		const auto parentId = entity.GetComponent<TransformComponent>()->GetParent();
+		if (parentId == EntityHandle::Invalid)
+		{
+			return nullptr;
+		}
+
+		auto parent = scene.getEntity(parentId);
+		if (parent == nullptr || !parent->HasComponent<TransformComponent>())
+		{
+			return nullptr;
+		}
+
+		return parent;
+	}
+}
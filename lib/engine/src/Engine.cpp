@@ -4,9 +4,13 @@
 #include <helsinki/System/Events/WindowResizeEvent.hpp>
 #include <helsinki/System/Events/KeyEvents.hpp>
 #include <helsinki/System/Events/ScrollEvent.hpp>
+#include <helsinki/System/Events/EventReplayer.hpp>
 #include <helsinki/Renderer/Vulkan/RenderGraph/CameraUniformBufferObject.hpp>
 #define GLFW_INCLUDE_VULKAN
 #include <GLFW/glfw3.h>
+#include <algorithm>
+#include <chrono>
+#include <limits>
 
 namespace hl
 {
@@ -22,19 +26,19 @@ namespace hl
 		if (action == GLFW_PRESS)
 		{
 			KeyPressEvent event(key);
-			app->sendEvent(event);
+			app->sendInputEvent(event);
 		}
 		else if (action == GLFW_RELEASE)
 		{
 			KeyReleaseEvent event(key);
-			app->sendEvent(event);
+			app->sendInputEvent(event);
 		}
 	}
 	static void scrollCallback(GLFWwindow* window, double xOffset, double yOffset)
 	{
 		auto app = reinterpret_cast<Engine*>(glfwGetWindowUserPointer(window));
 		ScrollEvent event((int)xOffset, (int)yOffset);
-		app->sendEvent(event);
+		app->sendInputEvent(event);
 	}
 
 	Engine::Engine(
@@ -65,6 +69,7 @@ namespace hl
 	void Engine::init(EngineConfiguration config)
 	{
 		_config = config;
+		_eventBus.Coalesce<WindowResizeEvent>();
 		initWindow(_config.Width, _config.Height, _config.Title.c_str());
 		initVulkan(_config.Title.c_str());
 	}
@@ -73,6 +78,77 @@ namespace hl
 		mainLoop();
 		cleanup();
 	}
+	ReplayResult Engine::replay(const EventRecording& recording)
+	{
+		EventReplayer replayer(_eventBus, recording);
+		replayer.Register<KeyPressEvent>();
+		replayer.Register<KeyReleaseEvent>();
+		replayer.Register<ScrollEvent>();
+		replayer.Register<WindowResizeEvent>();
+		replayer.Register<MouseStateEvent>();
+
+		_replaying = true;
+		_inputManager.setUseRecordedInput(true);
+		// Ahead of every other listener, so key state is current when they
+		// see the event.
+		const auto inputListener = _eventBus.AddScopedListener(&_inputManager, std::numeric_limits<int32_t>::max());
+		const auto mouseSubscription = _eventBus.SubscribeScoped<&InputManager::onMouseState>(&_inputManager, std::numeric_limits<int32_t>::max());
+
+		ReplayResult result;
+		_running = true;
+
+		const auto start = std::chrono::steady_clock::now();
+
+		for (const auto updates : replayer.GetFrames())
+		{
+			if (!_running)
+			{
+				break;
+			}
+
+			ZoneScopedN("ReplayFrame");
+			const auto frameStart = std::chrono::steady_clock::now();
+
+			setCurrentSceneAsAppropriate();
+
+			_eventBus.ProcessEvents(EventPhase::PreUpdate);
+
+			for (uint32_t i = 0; i < updates; ++i)
+			{
+				glfwPollEvents();
+				replayer.ReplayUpdate(_updateCount);
+
+				update(FixedDelta);
+				_updateCount++;
+			}
+
+			_eventBus.ProcessEvents(EventPhase::PostPhysics);
+			_eventBus.ProcessEvents(EventPhase::EndOfFrame);
+
+			_textSystem.processDeferredTextDestruction(1);
+
+			const auto frameMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - frameStart).count();
+			result.slowestFrameMilliseconds = std::max(result.slowestFrameMilliseconds, frameMilliseconds);
+			result.frames++;
+			result.updates += updates;
+		}
+
+		result.totalMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+		_inputManager.setUseRecordedInput(false);
+		_replaying = false;
+
+		_device.waitIdle();
+		cleanup();
+
+		return result;
+	}
+	void Engine::setRecorder(EventRecorder* recorder)
+	{
+		_recorder = recorder;
+		_eventBus.SetRecorder(recorder);
+		_lastMouseState = {};
+	}
 	void Engine::notifyFramebufferResized(int width, int height)
 	{
 		_framebufferResized = true;
@@ -105,8 +181,10 @@ namespace hl
 
 	void Engine::mainLoop()
 	{
-		const float delta = 1.0f / 60.0f;
-		float accumulator = 0.0f;
+		// Frame times are accumulated in clock ticks, summing them as floats
+		// drifts and the number of updates run would wander with it.
+		const auto step = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(FixedDelta));
+		std::chrono::steady_clock::duration accumulator{ 0 };
 		float statsAccumulator = 0.0f;
 		unsigned int fps = 0;
 		unsigned int ups = 0;
@@ -124,7 +202,7 @@ namespace hl
 			const auto frameTime = now - start;
 			start = now;
 
-			accumulator += std::chrono::duration<float>(frameTime).count();
+			accumulator += frameTime;
 			statsAccumulator += std::chrono::duration<float>(frameTime).count();
 
 			if (statsAccumulator >= 1.0f)
@@ -141,15 +219,36 @@ namespace hl
 			}
 
 			setCurrentSceneAsAppropriate();
+
+			_eventBus.ProcessEvents(EventPhase::PreUpdate);
 			
-			while (accumulator >= delta)
+			while (accumulator >= step)
 			{
+				if (_recorder != nullptr)
+				{
+					_recorder->BeginUpdate(_updateCount);
+				}
+
 				glfwPollEvents();
 
-				update(delta);
+				if (_recorder != nullptr)
+				{
+					recordMouseState();
+				}
+
+				update(FixedDelta);
+				_updateCount++;
 				ups++;
 
-				accumulator -= delta;
+				accumulator -= step;
+			}
+
+			_eventBus.ProcessEvents(EventPhase::PostPhysics);
+			_eventBus.ProcessEvents(EventPhase::EndOfFrame);
+
+			if (_recorder != nullptr)
+			{
+				_recorder->EndFrame();
 			}
 
 			draw();
@@ -188,6 +287,24 @@ namespace hl
 		ZoneScopedN("Update");
 		_currentEngineScene->updateBase(_currentFrame, delta);
 	}
+	void Engine::recordMouseState()
+	{
+		const auto position = _inputManager.getMousePosition();
+		MouseStateEvent state{ .x = position.x, .y = position.y, .buttons = 0 };
+		for (int button = GLFW_MOUSE_BUTTON_1; button <= GLFW_MOUSE_BUTTON_LAST; ++button)
+		{
+			if (_inputManager.isButtonDown(button))
+			{
+				state.buttons |= 1u << button;
+			}
+		}
+
+		if (state != _lastMouseState)
+		{
+			_lastMouseState = state;
+			_eventBus.Publish(state);
+		}
+	}
 	void Engine::draw()
 	{
 		ZoneScopedN("Draw");
@@ -282,6 +399,10 @@ namespace hl
 		ZoneScopedN("InitWindow");
 		glfwInit();
 		glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
+		if (_config.Headless)
+		{
+			glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+		}
 		_window = glfwCreateWindow(width, height, title, nullptr, nullptr);
 		glfwSetWindowUserPointer(_window, this);
 		glfwSetFramebufferSizeCallback(_window, framebufferResizeCallback);
@@ -361,6 +482,11 @@ namespace hl
 		ZoneScopedN("create engine scene");
 
 		_currentEngineScene.reset(scene);
+		// Before initialise, which is where scenes build their entities.
+		if (_config.Seed.has_value())
+		{
+			_currentEngineScene->getScene().setDeterministic(*_config.Seed);
+		}
 		_currentEngineScene->initialise(
 			"camera_matrix_ubo",// TODO: To constant
 			_device,
@@ -483,7 +483,7 @@ namespace hl
                 //    ? _resourceManager->GetResource<hl::ModelResource>(model->getModelId())
                 //    : _resourceManager->GetResource<hl::ModelResource>("FALLBACK_MODEL");
 
-                auto modelTransform = transform->GetTransformMatrix();
+                auto modelTransform = _scene.getWorldMatrix(*transform);
                 const auto& meshes = modelResource->getMeshes();
 
                 auto pc = hl::MaterialPushConstantObject
@@ -612,7 +612,7 @@ namespace hl
                     continue;
                 }
 
-                auto modelTransform = transform->GetTransformMatrix();
+                auto modelTransform = _scene.getWorldMatrix(*transform);
 
                 auto pc = hl::TextPushConstantObject
                 {
@@ -0,0 +1,140 @@
+#include <helsinki/Engine/HeadlessGame.hpp>
+#include <helsinki/Engine/HeadlessRunner.hpp>
+#include <algorithm>
+#include <cstdlib>
+
+namespace hl
+{
+	static constexpr std::string_view SharedUsage =
+		"  --updates <n>       fixed updates to run, 3600 by default\n"
+		"  --replay <path>     input recorded with the game's --record instead of\n"
+		"                      the scripted input, run frame by frame as recorded\n"
+		"  --replay-from <n>   the recorded update the gameplay started at, as\n"
+		"                      the recording counts from the engine starting and\n"
+		"                      includes anything before it, such as a title screen\n"
+		"  --serial            updates systems one at a time\n"
+		"  --seed <n>          deterministic, systems update one at a time and\n"
+		"                      random choices come from the seed\n"
+		"  --checksums <path>  saves the scene's checksum after every update\n"
+		"  --verify <path>     compares against checksums saved by an earlier run\n"
+		"                      and fails at the first update that differs\n"
+		"  --min-ups <n>       fails if fewer updates a second than this, for CI\n"
+		"  --help              prints these options\n";
+
+	HeadlessOptions HeadlessGame::parseOptions(int argc, char** argv)
+	{
+		HeadlessOptions options;
+		for (int i = 1; i < argc; ++i)
+		{
+			const std::string_view arg(argv[i]);
+			const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+
+			if (arg == "--serial")
+			{
+				options.serial = true;
+			}
+			else if (arg == "--help")
+			{
+				options.help = true;
+			}
+			else if (value != nullptr && arg == "--updates")
+			{
+				options.updates = std::stoull(argv[++i]);
+			}
+			else if (value != nullptr && arg == "--replay")
+			{
+				options.replayPath = argv[++i];
+			}
+			else if (value != nullptr && arg == "--replay-from")
+			{
+				options.replayFrom = std::stoull(argv[++i]);
+			}
+			else if (value != nullptr && arg == "--seed")
+			{
+				options.seed = std::stoull(argv[++i]);
+			}
+			else if (value != nullptr && arg == "--checksums")
+			{
+				options.checksumsPath = argv[++i];
+			}
+			else if (value != nullptr && arg == "--verify")
+			{
+				options.verifyPath = argv[++i];
+			}
+			else if (value != nullptr && arg == "--min-ups")
+			{
+				options.minUpdatesPerSecond = std::stod(argv[++i]);
+			}
+			else
+			{
+				// Unknown to the game as well is skipped, as it always has been.
+				i += std::max(parseOption(arg, value), 1) - 1;
+			}
+		}
+		return options;
+	}
+
+	std::string HeadlessGame::getUsage() const
+	{
+		return "Runs the game's systems without a window or a device and reports how fast they update\n\n"
+			+ std::string(SharedUsage)
+			+ getOptionUsage();
+	}
+
+	int HeadlessGame::run(int argc, char** argv, std::ostream& stream)
+	{
+		const auto options = parseOptions(argc, argv);
+		if (options.help)
+		{
+			stream << getUsage();
+			return EXIT_SUCCESS;
+		}
+
+		_scene.getScheduler().setParallel(!options.serial);
+		if (options.seed.has_value())
+		{
+			_scene.setDeterministic(*options.seed);
+		}
+
+		initialise(options);
+
+		HeadlessRunner runner(_eventBus, _inputManager, _scene);
+		runner.setRecordChecksums(!options.checksumsPath.empty() || !options.verifyPath.empty());
+		runner.setUpdateCallback([this](uint64_t update, float delta)
+			{
+				this->update(update, delta);
+			});
+
+		const auto input = options.replayPath.empty()
+			? scriptInput(options.updates)
+			: EventRecording::LoadFromFile(options.replayPath);
+		const auto result = runner.run(options.updates, input, options.replayPath.empty() ? 0 : options.replayFrom);
+
+		stream << getName() << std::endl;
+		result.print(stream);
+		report(stream);
+
+		if (!options.checksumsPath.empty())
+		{
+			result.saveChecksums(options.checksumsPath);
+		}
+		if (!options.verifyPath.empty())
+		{
+			const auto divergence = result.findDivergence(HeadlessResult::loadChecksums(options.verifyPath));
+			if (divergence.has_value())
+			{
+				stream << "Diverged from " << options.verifyPath << " at update " << *divergence << std::endl;
+				return EXIT_FAILURE;
+			}
+			stream << "Matches " << options.verifyPath << std::endl;
+		}
+
+		if (result.getUpdatesPerSecond() < options.minUpdatesPerSecond)
+		{
+			stream << "Below the minimum of " << options.minUpdatesPerSecond << " updates/s" << std::endl;
+			return EXIT_FAILURE;
+		}
+
+		return EXIT_SUCCESS;
+	}
+}
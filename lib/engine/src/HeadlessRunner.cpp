@@ -0,0 +1,225 @@
+#include <helsinki/Engine/HeadlessRunner.hpp>
+#include <helsinki/Engine/Input/MouseStateEvent.hpp>
+#include <helsinki/System/HelsinkiTracy.hpp>
+#include <helsinki/System/Events/EventReplayer.hpp>
+#include <helsinki/System/Events/KeyEvents.hpp>
+#include <helsinki/System/Events/ScrollEvent.hpp>
+#include <helsinki/System/Events/WindowResizeEvent.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <format>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#if defined(__GNUG__)
+#include <cxxabi.h>
+#endif
+
+namespace hl
+{
+	// typeid names are mangled outside MSVC.
+	static std::string readableName(const std::string& name)
+	{
+#if defined(__GNUG__)
+		int status = 0;
+		const std::unique_ptr<char, decltype(&std::free)> demangled(
+			abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status),
+			&std::free);
+		if (status == 0 && demangled != nullptr)
+		{
+			return demangled.get();
+		}
+#endif
+		return name;
+	}
+
+	double HeadlessResult::getUpdatesPerSecond() const
+	{
+		return totalMilliseconds > 0.0 ? updates * 1000.0 / totalMilliseconds : 0.0;
+	}
+
+	void HeadlessResult::print(std::ostream& stream) const
+	{
+		stream << std::format("{} updates in {:.1f}ms, {:.0f} updates/s, slowest update {:.3f}ms\n",
+			updates, totalMilliseconds, getUpdatesPerSecond(), slowestUpdateMilliseconds);
+		if (!checksums.empty())
+		{
+			stream << std::format("Final checksum {:016x}\n", checksums.back());
+		}
+
+		for (const auto& system : systems)
+		{
+			const auto mean = updates > 0 ? system.totalMilliseconds / updates : 0.0;
+			stream << std::format("  {:<48} mean {:.4f}ms, slowest {:.4f}ms\n",
+				system.name, mean, system.slowestMilliseconds);
+		}
+	}
+
+	std::optional<uint64_t> HeadlessResult::findDivergence(const std::vector<uint64_t>& expected) const
+	{
+		const auto count = std::min(checksums.size(), expected.size());
+		for (size_t update = 0; update < count; ++update)
+		{
+			if (checksums[update] != expected[update])
+			{
+				return update;
+			}
+		}
+		return std::nullopt;
+	}
+
+	void HeadlessResult::saveChecksums(const std::string& path) const
+	{
+		std::ofstream file(path, std::ios::trunc);
+		for (const auto checksum : checksums)
+		{
+			file << std::format("{:016x}\n", checksum);
+		}
+		if (!file)
+		{
+			throw std::runtime_error(std::format("Failed to write checksums to {}", path));
+		}
+	}
+
+	std::vector<uint64_t> HeadlessResult::loadChecksums(const std::string& path)
+	{
+		std::ifstream file(path);
+		if (!file)
+		{
+			throw std::runtime_error(std::format("Failed to open checksums {}", path));
+		}
+
+		std::vector<uint64_t> checksums;
+		std::string line;
+		while (std::getline(file, line))
+		{
+			if (!line.empty())
+			{
+				checksums.push_back(std::stoull(line, nullptr, 16));
+			}
+		}
+		return checksums;
+	}
+
+	HeadlessRunner::HeadlessRunner(EventBus& eventBus, InputManager& inputManager, Scene& scene) :
+		_eventBus(eventBus),
+		_inputManager(inputManager),
+		_scene(scene)
+	{
+	}
+
+	HeadlessResult HeadlessRunner::run(uint64_t updateCount)
+	{
+		return run(updateCount, EventRecording{});
+	}
+
+	HeadlessResult HeadlessRunner::run(uint64_t updateCount, const EventRecording& input, uint64_t firstUpdate)
+	{
+		EventReplayer replayer(_eventBus, input);
+		replayer.Register<KeyPressEvent>();
+		replayer.Register<KeyReleaseEvent>();
+		replayer.Register<ScrollEvent>();
+		replayer.Register<WindowResizeEvent>();
+		replayer.Register<MouseStateEvent>();
+
+		_inputManager.setUseRecordedInput(true);
+		// Ahead of every other listener, as in Engine::replay.
+		const auto inputListener = _eventBus.AddScopedListener(&_inputManager, std::numeric_limits<int32_t>::max());
+		const auto mouseSubscription = _eventBus.SubscribeScoped<&InputManager::onMouseState>(&_inputManager, std::numeric_limits<int32_t>::max());
+
+		// Skip the recorded frames before the first update, the frame it falls
+		// in only runs its updates from there.
+		const auto& frames = replayer.GetFrames();
+		size_t frame = 0;
+		uint64_t recordedUpdate = 0;
+		while (frame < frames.size() && recordedUpdate + frames[frame] <= firstUpdate)
+		{
+			recordedUpdate += frames[frame++];
+		}
+		auto skipped = firstUpdate - recordedUpdate;
+
+		HeadlessResult result;
+		if (_recordChecksums)
+		{
+			result.checksums.reserve(updateCount);
+		}
+		const auto start = std::chrono::steady_clock::now();
+
+		uint64_t update = 0;
+		while (update < updateCount)
+		{
+			ZoneScopedN("HeadlessFrame");
+
+			// As many updates as the recorded frame had, one once past them or
+			// for input that has no frames, such as scripted input.
+			uint64_t frameUpdates = 1;
+			if (frame < frames.size())
+			{
+				frameUpdates = frames[frame++] - skipped;
+				skipped = 0;
+			}
+			frameUpdates = std::min(frameUpdates, updateCount - update);
+
+			// The phases are processed once a frame around its updates, as the
+			// engine's main loop and Engine::replay do.
+			_eventBus.ProcessEvents(EventPhase::PreUpdate);
+
+			for (uint64_t i = 0; i < frameUpdates; ++i, ++update)
+			{
+				ZoneScopedN("HeadlessUpdate");
+				const auto updateStart = std::chrono::steady_clock::now();
+
+				replayer.ReplayUpdate(firstUpdate + update);
+
+				if (_updateCallback)
+				{
+					_updateCallback(update, FixedDelta);
+				}
+
+				_scene.update(FixedDelta);
+				_inputManager.updateEndOfFrame();
+				_scene.update();
+
+				const auto updateMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - updateStart).count();
+				result.slowestUpdateMilliseconds = std::max(result.slowestUpdateMilliseconds, updateMilliseconds);
+				result.updates++;
+
+				// Systems added part way through start from zero.
+				const auto& timings = _scene.getSystemTimings();
+				for (size_t t = result.systems.size(); t < timings.size(); ++t)
+				{
+					result.systems.push_back(HeadlessSystemResult{ .name = readableName(timings[t].name) });
+				}
+				for (size_t t = 0; t < timings.size(); ++t)
+				{
+					auto& system = result.systems[t];
+					system.totalMilliseconds += timings[t].milliseconds;
+					system.slowestMilliseconds = std::max(system.slowestMilliseconds, timings[t].milliseconds);
+				}
+
+				// Outside the timed part of the update, the frame's last update
+				// once its phases have been processed.
+				if (_recordChecksums && i + 1 < frameUpdates)
+				{
+					result.checksums.push_back(_scene.checksum());
+				}
+			}
+
+			_eventBus.ProcessEvents(EventPhase::PostPhysics);
+			_eventBus.ProcessEvents(EventPhase::EndOfFrame);
+
+			if (_recordChecksums && frameUpdates > 0)
+			{
+				result.checksums.push_back(_scene.checksum());
+			}
+		}
+
+		result.totalMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+		_inputManager.setUseRecordedInput(false);
+
+		return result;
+	}
+}
@@ -1,4 +1,5 @@
 #include <helsinki/Engine/Input/InputManager.hpp>
+#include <helsinki/System/Events/KeyEvents.hpp>
 
 #define GLFW_INCLUDE_VULKAN
 #include <GLFW/glfw3.h>
@@ -10,6 +11,11 @@ namespace hl
 	// TODO: Overload relative to camera???
 	glm::vec2 InputManager::getMousePosition() const
 	{
+		if (_useRecordedInput)
+		{
+			return glm::vec2(_recordedMouse.x, _recordedMouse.y);
+		}
+
 		double x, y;
 		glfwGetCursorPos(m_Window, &x, &y);
 
@@ -27,11 +33,22 @@ namespace hl
 	}
 	bool InputManager::isKeyDown(int _key) const
 	{
+		if (_useRecordedInput)
+		{
+			const auto it = _recordedKeyDown.find(_key);
+			return it != _recordedKeyDown.end() && it->second;
+		}
+
 		return glfwGetKey(m_Window, _key) == GLFW_PRESS;
 	}
 
 	bool InputManager::isButtonDown(int _button) const
 	{
+		if (_useRecordedInput)
+		{
+			return _button >= 0 && _button < 32 && (_recordedMouse.buttons & (1u << _button)) != 0;
+		}
+
 		return glfwGetMouseButton(m_Window, _button) == GLFW_PRESS;
 	}
 
@@ -82,12 +99,39 @@ namespace hl
 
 		for (auto& [button, state] : _wasButtonDown)
 		{
-			state = glfwGetMouseButton(m_Window, button) == GLFW_PRESS;
+			state = isButtonDown(button);
 		}
 
 		for (auto& [key, state] : _wasKeyDown)
 		{
-			state = glfwGetKey(m_Window, key) == GLFW_PRESS;
+			state = isKeyDown(key);
 		}
 	}
+
+	void InputManager::setUseRecordedInput(bool useRecordedInput)
+	{
+		_useRecordedInput = useRecordedInput;
+		_recordedKeyDown.clear();
+		_recordedMouse = {};
+	}
+	void InputManager::OnEvent(const Event& event)
+	{
+		if (!_useRecordedInput)
+		{
+			return;
+		}
+
+		if (auto kpe = dynamic_cast<const KeyPressEvent*>(&event))
+		{
+			_recordedKeyDown[kpe->GetKeyCode()] = true;
+		}
+		else if (auto kre = dynamic_cast<const KeyReleaseEvent*>(&event))
+		{
+			_recordedKeyDown[kre->GetKeyCode()] = false;
+		}
+	}
+	void InputManager::onMouseState(const MouseStateEvent& event)
+	{
+		_recordedMouse = event;
+	}
 }
\ No newline at end of file
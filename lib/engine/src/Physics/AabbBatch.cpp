@@ -0,0 +1,259 @@
+#include <helsinki/Engine/Physics/AabbBatch.hpp>
+#include <algorithm>
+#include <bit>
+#include <limits>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define HL_AABB_BATCH_X86
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define HL_TARGET_SSE
+#define HL_TARGET_AVX2
+#else
+#define HL_TARGET_SSE __attribute__((target("sse2")))
+#define HL_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+namespace hl
+{
+	namespace
+	{
+		constexpr size_t BatchWidth = 8;
+
+		struct BatchView
+		{
+			const float* minX;
+			const float* minY;
+			const float* maxX;
+			const float* maxY;
+			size_t count;
+		};
+
+		template <bool Sorted>
+		void findOverlapsScalar(const BatchView& batch, const Aabb& bounds, std::vector<uint32_t>& hits, uint32_t first)
+		{
+			for (size_t i = first; i < batch.count; ++i)
+			{
+				if (Sorted && batch.minX[i] > bounds.max.x)
+				{
+					break;
+				}
+
+				if (batch.minX[i] <= bounds.max.x && bounds.min.x <= batch.maxX[i] &&
+					batch.minY[i] <= bounds.max.y && bounds.min.y <= batch.maxY[i])
+				{
+					hits.push_back((uint32_t)i);
+				}
+			}
+		}
+
+		void appendHits(std::vector<uint32_t>& hits, size_t base, uint32_t mask)
+		{
+			while (mask != 0)
+			{
+				hits.push_back((uint32_t)(base + std::countr_zero(mask)));
+				mask &= mask - 1;
+			}
+		}
+
+#ifdef HL_AABB_BATCH_X86
+		// Blocks start on a multiple of the width, lanes before first are
+		// masked off. Reads past count land in the NaN padding.
+		template <bool Sorted>
+		HL_TARGET_SSE void findOverlapsSse(const BatchView& batch, const Aabb& bounds, std::vector<uint32_t>& hits, uint32_t first)
+		{
+			const auto queryMinX = _mm_set1_ps(bounds.min.x);
+			const auto queryMinY = _mm_set1_ps(bounds.min.y);
+			const auto queryMaxX = _mm_set1_ps(bounds.max.x);
+			const auto queryMaxY = _mm_set1_ps(bounds.max.y);
+
+			for (size_t i = first & ~size_t{ 3 }; i < batch.count; i += 4)
+			{
+				const auto minX = _mm_loadu_ps(batch.minX + i);
+				const auto overlapX = _mm_and_ps(
+					_mm_cmple_ps(minX, queryMaxX),
+					_mm_cmple_ps(queryMinX, _mm_loadu_ps(batch.maxX + i)));
+				const auto overlapY = _mm_and_ps(
+					_mm_cmple_ps(_mm_loadu_ps(batch.minY + i), queryMaxY),
+					_mm_cmple_ps(queryMinY, _mm_loadu_ps(batch.maxY + i)));
+
+				auto mask = (uint32_t)_mm_movemask_ps(_mm_and_ps(overlapX, overlapY));
+				if (i < first)
+				{
+					mask &= ~0u << (first - i);
+				}
+				appendHits(hits, i, mask);
+
+				if (Sorted && _mm_movemask_ps(_mm_cmpgt_ps(minX, queryMaxX)) != 0)
+				{
+					break;
+				}
+			}
+		}
+
+		template <bool Sorted>
+		HL_TARGET_AVX2 void findOverlapsAvx2(const BatchView& batch, const Aabb& bounds, std::vector<uint32_t>& hits, uint32_t first)
+		{
+			const auto queryMinX = _mm256_set1_ps(bounds.min.x);
+			const auto queryMinY = _mm256_set1_ps(bounds.min.y);
+			const auto queryMaxX = _mm256_set1_ps(bounds.max.x);
+			const auto queryMaxY = _mm256_set1_ps(bounds.max.y);
+
+			for (size_t i = first & ~size_t{ 7 }; i < batch.count; i += 8)
+			{
+				const auto minX = _mm256_loadu_ps(batch.minX + i);
+				const auto overlapX = _mm256_and_ps(
+					_mm256_cmp_ps(minX, queryMaxX, _CMP_LE_OQ),
+					_mm256_cmp_ps(queryMinX, _mm256_loadu_ps(batch.maxX + i), _CMP_LE_OQ));
+				const auto overlapY = _mm256_and_ps(
+					_mm256_cmp_ps(_mm256_loadu_ps(batch.minY + i), queryMaxY, _CMP_LE_OQ),
+					_mm256_cmp_ps(queryMinY, _mm256_loadu_ps(batch.maxY + i), _CMP_LE_OQ));
+
+				auto mask = (uint32_t)_mm256_movemask_ps(_mm256_and_ps(overlapX, overlapY));
+				if (i < first)
+				{
+					mask &= ~0u << (first - i);
+				}
+				appendHits(hits, i, mask);
+
+				if (Sorted && _mm256_movemask_ps(_mm256_cmp_ps(minX, queryMaxX, _CMP_GT_OQ)) != 0)
+				{
+					break;
+				}
+			}
+		}
+#endif
+
+		SimdLevel detectSupportedLevel()
+		{
+#if defined(HL_AABB_BATCH_X86) && defined(_MSC_VER)
+			int info[4]{};
+			__cpuid(info, 0);
+			const auto maxLeaf = info[0];
+
+			__cpuid(info, 1);
+			const auto sse2 = (info[3] & (1 << 26)) != 0;
+			// The os has to save the ymm registers for avx to be usable.
+			const auto osAvx = (info[2] & (1 << 27)) != 0 && (info[2] & (1 << 28)) != 0 &&
+				(_xgetbv(0) & 0x6) == 0x6;
+
+			auto avx2 = false;
+			if (maxLeaf >= 7)
+			{
+				__cpuidex(info, 7, 0);
+				avx2 = osAvx && (info[1] & (1 << 5)) != 0;
+			}
+
+			return avx2 ? SimdLevel::Avx2 : sse2 ? SimdLevel::Sse : SimdLevel::Scalar;
+#elif defined(HL_AABB_BATCH_X86)
+			__builtin_cpu_init();
+			if (__builtin_cpu_supports("avx2"))
+			{
+				return SimdLevel::Avx2;
+			}
+			if (__builtin_cpu_supports("sse2"))
+			{
+				return SimdLevel::Sse;
+			}
+			return SimdLevel::Scalar;
+#else
+			return SimdLevel::Scalar;
+#endif
+		}
+
+		template <bool Sorted>
+		void dispatchOverlaps(const BatchView& batch, const Aabb& bounds, std::vector<uint32_t>& hits, uint32_t first, SimdLevel level)
+		{
+			if (first >= batch.count)
+			{
+				return;
+			}
+
+			// Asking for more than the cpu has falls back to the best it does.
+			switch (std::min(level, detectSimdLevel()))
+			{
+#ifdef HL_AABB_BATCH_X86
+			case SimdLevel::Avx2:
+				findOverlapsAvx2<Sorted>(batch, bounds, hits, first);
+				return;
+			case SimdLevel::Sse:
+				findOverlapsSse<Sorted>(batch, bounds, hits, first);
+				return;
+#endif
+			default:
+				findOverlapsScalar<Sorted>(batch, bounds, hits, first);
+				return;
+			}
+		}
+	}
+
+	SimdLevel detectSimdLevel()
+	{
+		static const auto level = detectSupportedLevel();
+		return level;
+	}
+
+	void AabbBatch::clear()
+	{
+		_minX.clear();
+		_minY.clear();
+		_maxX.clear();
+		_maxY.clear();
+		_count = 0;
+	}
+
+	void AabbBatch::reserve(size_t count)
+	{
+		const auto padded = (count + BatchWidth - 1) / BatchWidth * BatchWidth;
+		_minX.reserve(padded);
+		_minY.reserve(padded);
+		_maxX.reserve(padded);
+		_maxY.reserve(padded);
+	}
+
+	uint32_t AabbBatch::add(const Aabb& bounds)
+	{
+		const auto index = _count++;
+		if (index == _minX.size())
+		{
+			constexpr auto NaN = std::numeric_limits<float>::quiet_NaN();
+			_minX.resize(index + BatchWidth, NaN);
+			_minY.resize(index + BatchWidth, NaN);
+			_maxX.resize(index + BatchWidth, NaN);
+			_maxY.resize(index + BatchWidth, NaN);
+		}
+
+		_minX[index] = bounds.min.x;
+		_minY[index] = bounds.min.y;
+		_maxX[index] = bounds.max.x;
+		_maxY[index] = bounds.max.y;
+		return (uint32_t)index;
+	}
+
+	Aabb AabbBatch::get(uint32_t index) const
+	{
+		return Aabb{ { _minX[index], _minY[index] }, { _maxX[index], _maxY[index] } };
+	}
+
+	void AabbBatch::findOverlaps(const Aabb& bounds, std::vector<uint32_t>& hits, uint32_t first) const
+	{
+		findOverlaps(bounds, hits, first, detectSimdLevel());
+	}
+
+	void AabbBatch::findOverlaps(const Aabb& bounds, std::vector<uint32_t>& hits, uint32_t first, SimdLevel level) const
+	{
+		dispatchOverlaps<false>(BatchView{ _minX.data(), _minY.data(), _maxX.data(), _maxY.data(), _count }, bounds, hits, first, level);
+	}
+
+	void AabbBatch::findSortedOverlaps(const Aabb& bounds, std::vector<uint32_t>& hits, uint32_t first) const
+	{
+		findSortedOverlaps(bounds, hits, first, detectSimdLevel());
+	}
+
+	void AabbBatch::findSortedOverlaps(const Aabb& bounds, std::vector<uint32_t>& hits, uint32_t first, SimdLevel level) const
+	{
+		dispatchOverlaps<true>(BatchView{ _minX.data(), _minY.data(), _maxX.data(), _maxY.data(), _count }, bounds, hits, first, level);
+	}
+}
@@ -0,0 +1,123 @@
+#include <helsinki/Engine/Physics/Broadphase.hpp>
+#include <helsinki/Engine/ECS/EntityHandle.hpp>
+#include <helsinki/System/HelsinkiTracy.hpp>
+#include <algorithm>
+#include <utility>
+
+namespace hl
+{
+	void Broadphase::beginUpdate()
+	{
+		_round++;
+	}
+
+	void Broadphase::update(int entityId, const Aabb& bounds, CollisionFilter filter)
+	{
+		const auto slot = EntityHandle::index(entityId);
+		if (slot >= _proxyBySlot.size())
+		{
+			_proxyBySlot.resize(slot + 1, NoProxy);
+		}
+
+		auto proxy = _proxyBySlot[slot];
+		if (proxy != NoProxy && _proxies[proxy].entityId != entityId)
+		{
+			// The entity was removed and its slot reused without endUpdate
+			// having caught up with it.
+			removeProxy(proxy);
+			proxy = NoProxy;
+		}
+
+		if (proxy == NoProxy)
+		{
+			if (_freeProxies.empty())
+			{
+				proxy = (uint32_t)_proxies.size();
+				_proxies.emplace_back();
+			}
+			else
+			{
+				proxy = _freeProxies.back();
+				_freeProxies.pop_back();
+			}
+
+			_proxies[proxy] = Proxy{ bounds, filter, entityId, _round };
+			_proxyBySlot[slot] = proxy;
+			_colliderCount++;
+			onAdded(proxy);
+			return;
+		}
+
+		auto& entry = _proxies[proxy];
+		entry.round = _round;
+		entry.filter = filter;
+		if (entry.bounds != bounds)
+		{
+			const auto previous = entry.bounds;
+			entry.bounds = bounds;
+			onMoved(proxy, previous);
+		}
+	}
+
+	void Broadphase::endUpdate()
+	{
+		for (uint32_t proxy = 0; proxy < (uint32_t)_proxies.size(); ++proxy)
+		{
+			const auto& entry = _proxies[proxy];
+			if (entry.entityId != EntityHandle::Invalid && entry.round != _round)
+			{
+				removeProxy(proxy);
+			}
+		}
+	}
+
+	void Broadphase::remove(int entityId)
+	{
+		const auto slot = EntityHandle::index(entityId);
+		if (slot < _proxyBySlot.size())
+		{
+			const auto proxy = _proxyBySlot[slot];
+			if (proxy != NoProxy && _proxies[proxy].entityId == entityId)
+			{
+				removeProxy(proxy);
+			}
+		}
+	}
+
+	void Broadphase::clear()
+	{
+		onCleared();
+		_proxies.clear();
+		_proxyBySlot.clear();
+		_freeProxies.clear();
+		_colliderCount = 0;
+	}
+
+	void Broadphase::findPairs(std::vector<BroadphasePair>& pairs)
+	{
+		ZoneScopedN("Broadphase::findPairs");
+
+		pairs.clear();
+		collectPairs(pairs);
+
+		for (auto& pair : pairs)
+		{
+			if (pair.entityB < pair.entityA)
+			{
+				std::swap(pair.entityA, pair.entityB);
+			}
+		}
+		std::sort(pairs.begin(), pairs.end());
+	}
+
+	void Broadphase::removeProxy(uint32_t proxy)
+	{
+		onRemoved(proxy);
+
+		auto& entry = _proxies[proxy];
+		_proxyBySlot[EntityHandle::index(entry.entityId)] = NoProxy;
+		entry.entityId = EntityHandle::Invalid;
+		_freeProxies.push_back(proxy);
+		_colliderCount--;
+	}
+}
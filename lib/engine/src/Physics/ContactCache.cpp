@@ -0,0 +1,189 @@
+#include <helsinki/Engine/Physics/ContactCache.hpp>
+#include <helsinki/System/HelsinkiTracy.hpp>
+#include <algorithm>
+#include <bit>
+#include <utility>
+
+namespace hl
+{
+	BroadphasePair ContactCache::makePair(int entityA, int entityB)
+	{
+		// Ordered the same way as the broadphase so either can be passed on.
+		return entityB < entityA
+			? BroadphasePair{ entityB, entityA }
+			: BroadphasePair{ entityA, entityB };
+	}
+
+	uint64_t ContactCache::makeKey(const BroadphasePair& pair)
+	{
+		return (uint64_t)(uint32_t)pair.entityA << 32 | (uint32_t)pair.entityB;
+	}
+
+	uint32_t ContactCache::home(uint64_t key) const
+	{
+		// Fibonacci hashing, the top bits of the product are well mixed even
+		// though ids mostly differ in their low bits.
+		return (uint32_t)((key * 0x9E3779B97F4A7C15ull) >> _shift);
+	}
+
+	uint32_t ContactCache::find(uint64_t key) const
+	{
+		if (_slots.empty())
+		{
+			return NoSlot;
+		}
+
+		const auto mask = (uint32_t)_slots.size() - 1;
+		for (auto slot = home(key); ; slot = (slot + 1) & mask)
+		{
+			if (_slots[slot].key == key)
+			{
+				return slot;
+			}
+			if (_slots[slot].key == EmptyKey)
+			{
+				return NoSlot;
+			}
+		}
+	}
+
+	void ContactCache::erase(uint32_t slot)
+	{
+		// Shifts the rest of the run back over the hole instead of leaving a
+		// tombstone, so lookups never slow down however many pairs come and go.
+		const auto mask = (uint32_t)_slots.size() - 1;
+		auto hole = slot;
+		for (auto next = (hole + 1) & mask; _slots[next].key != EmptyKey; next = (next + 1) & mask)
+		{
+			const auto distance = (next - home(_slots[next].key)) & mask;
+			if (distance >= ((next - hole) & mask))
+			{
+				_slots[hole] = _slots[next];
+				hole = next;
+			}
+		}
+
+		_slots[hole].key = EmptyKey;
+		_size--;
+	}
+
+	void ContactCache::rehash(uint32_t capacity)
+	{
+		auto previous = std::move(_slots);
+		_slots.assign(capacity, Slot{ EmptyKey, 0 });
+		_shift = 64 - (uint32_t)std::countr_zero(capacity);
+
+		const auto mask = capacity - 1;
+		for (const auto& entry : previous)
+		{
+			if (entry.key == EmptyKey)
+			{
+				continue;
+			}
+
+			auto slot = home(entry.key);
+			while (_slots[slot].key != EmptyKey)
+			{
+				slot = (slot + 1) & mask;
+			}
+			_slots[slot] = entry;
+		}
+	}
+
+	void ContactCache::beginUpdate()
+	{
+		_round++;
+		_current.clear();
+		_entered.clear();
+		_stayed.clear();
+		_exited.clear();
+	}
+
+	void ContactCache::add(int entityA, int entityB)
+	{
+		if ((size_t)(_size + 1) * 2 > _slots.size())
+		{
+			rehash(std::max(MinCapacity, (uint32_t)_slots.size() * 2));
+		}
+
+		const auto pair = makePair(entityA, entityB);
+		const auto key = makeKey(pair);
+		const auto mask = (uint32_t)_slots.size() - 1;
+
+		auto slot = home(key);
+		while (_slots[slot].key != key && _slots[slot].key != EmptyKey)
+		{
+			slot = (slot + 1) & mask;
+		}
+
+		auto& entry = _slots[slot];
+		if (entry.key == EmptyKey)
+		{
+			entry = Slot{ key, _round };
+			_size++;
+			_current.push_back(pair);
+			_entered.push_back(pair);
+			return;
+		}
+
+		if (entry.round == _round)
+		{
+			return;
+		}
+
+		entry.round = _round;
+		_current.push_back(pair);
+		if (_reportStays)
+		{
+			_stayed.push_back(pair);
+		}
+	}
+
+	void ContactCache::endUpdate()
+	{
+		ZoneScopedN("ContactCache::endUpdate");
+
+		for (const auto& pair : _contacts)
+		{
+			const auto slot = find(makeKey(pair));
+			if (_slots[slot].round != _round)
+			{
+				_exited.push_back(pair);
+				erase(slot);
+			}
+		}
+
+		std::swap(_contacts, _current);
+	}
+
+	void ContactCache::update(const std::vector<BroadphasePair>& pairs)
+	{
+		ZoneScopedN("ContactCache::update");
+
+		beginUpdate();
+		for (const auto& pair : pairs)
+		{
+			add(pair.entityA, pair.entityB);
+		}
+		endUpdate();
+	}
+
+	void ContactCache::clear()
+	{
+		for (auto& slot : _slots)
+		{
+			slot.key = EmptyKey;
+		}
+		_size = 0;
+		_contacts.clear();
+		_current.clear();
+		_entered.clear();
+		_stayed.clear();
+		_exited.clear();
+	}
+
+	bool ContactCache::contains(int entityA, int entityB) const
+	{
+		return find(makeKey(makePair(entityA, entityB))) != NoSlot;
+	}
+}
@@ -0,0 +1,30 @@
+#include <helsinki/Engine/Physics/KinematicSystem.hpp>
+#include <helsinki/System/HelsinkiTracy.hpp>
+
+namespace hl
+{
+	KinematicSystem::KinematicSystem(Scene& scene, IntegrationScheme scheme) :
+		_bodies(scene.query<TransformComponent, KinematicComponent>()),
+		_scheme(scheme)
+	{
+		access().writes<TransformComponent, KinematicComponent>();
+	}
+
+	void KinematicSystem::update(float delta)
+	{
+		ZoneScopedN("KinematicSystem::update");
+
+		withIntegrationScheme(_scheme, [&](auto scheme)
+			{
+				_bodies.eachChunk([&](Entity**, TransformComponent* transforms, KinematicComponent* kinematics, uint32_t count)
+					{
+						for (uint32_t i = 0; i < count; ++i)
+						{
+							auto& kinematic = kinematics[i];
+							const auto displacement = integrateKinematic<decltype(scheme)::value>(kinematic.velocity, kinematic.acceleration, delta);
+							transforms[i].SetPosition(transforms[i].GetPosition() + displacement);
+						}
+					});
+			});
+	}
+}
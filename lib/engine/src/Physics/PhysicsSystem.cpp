@@ -0,0 +1,313 @@
+#include <helsinki/Engine/Physics/PhysicsSystem.hpp>
+#include <helsinki/Engine/Physics/SweptAabb.hpp>
+#include <helsinki/Engine/ECS/EntityHandle.hpp>
+#include <helsinki/System/HelsinkiTracy.hpp>
+#include <algorithm>
+#include <cmath>
+
+namespace hl
+{
+	static void moveBounds(Aabb& bounds, const glm::vec2& motion)
+	{
+		bounds.min += motion;
+		bounds.max += motion;
+	}
+
+	PhysicsSystem::PhysicsSystem(Scene& scene, IntegrationScheme scheme) :
+		_bodies(scene.query<TransformComponent, KinematicComponent>()),
+		_colliders(scene.query<TransformComponent, ColliderComponent>()),
+		_scheme(scheme)
+	{
+		access()
+			.writes<TransformComponent, KinematicComponent>()
+			.reads<ColliderComponent>();
+	}
+
+	void PhysicsSystem::update(float delta)
+	{
+		ZoneScopedN("PhysicsSystem::update");
+
+		gatherBodies();
+		integrate(delta);
+		findCandidates();
+		moveBodies();
+		findBodyContacts();
+
+		for (size_t i = 0; i < _bodyTransforms.size(); ++i)
+		{
+			// Resting bodies are left alone so their transforms stay clean.
+			if (_positions[i] != _bodyTransforms[i]->GetPosition())
+			{
+				_bodyTransforms[i]->SetPosition(_positions[i]);
+			}
+			_bodyKinematics[i]->velocity = _velocities[i];
+		}
+	}
+
+	void PhysicsSystem::gatherBodies()
+	{
+		ZoneScopedN("PhysicsSystem::gatherBodies");
+
+		_bodyTransforms.clear();
+		_bodyKinematics.clear();
+		_positions.clear();
+		_velocities.clear();
+		_accelerations.clear();
+		_bodyColliders.clear();
+		_colliderBodies.clear();
+		_colliderEntities.clear();
+		_colliderComponents.clear();
+		_startBounds.clear();
+		_staticEntities.clear();
+		_staticBounds.clear();
+		_contacts.clear();
+
+		const auto setIndex = [this](int entityId, uint32_t index)
+			{
+				const auto slot = EntityHandle::index(entityId);
+				if (slot >= _indexBySlot.size())
+				{
+					_indexBySlot.resize(slot + 1, NoCollider);
+				}
+				_indexBySlot[slot] = index;
+			};
+
+		_broadphase.beginUpdate();
+
+		_bodies.each([&](Entity& entity, TransformComponent& transform, KinematicComponent& kinematic)
+			{
+				const auto body = (uint32_t)_positions.size();
+				_bodyTransforms.push_back(&transform);
+				_bodyKinematics.push_back(&kinematic);
+				_positions.push_back(transform.GetPosition());
+				_velocities.push_back(kinematic.velocity);
+				_accelerations.push_back(kinematic.acceleration);
+
+				if (!entity.HasComponents<ColliderComponent>())
+				{
+					_bodyColliders.push_back(NoCollider);
+					return;
+				}
+
+				const auto collider = (uint32_t)_colliderBodies.size();
+				const auto component = entity.GetComponent<ColliderComponent>();
+				_bodyColliders.push_back(collider);
+				_colliderBodies.push_back(body);
+				_colliderEntities.push_back(entity.Id);
+				_colliderComponents.push_back(component);
+				_startBounds.push_back(component->getBounds(transform.GetPosition()));
+				setIndex(entity.Id, collider);
+			});
+
+		_colliders.each([&](Entity& entity, TransformComponent& transform, ColliderComponent& collider)
+			{
+				if (entity.HasComponents<KinematicComponent>())
+				{
+					return;
+				}
+
+				const auto bounds = collider.getBounds(transform.GetPosition());
+				setIndex(entity.Id, StaticBit | (uint32_t)_staticEntities.size());
+				_staticEntities.push_back(entity.Id);
+				_staticBounds.push_back(bounds);
+				_broadphase.update(entity.Id, bounds, collider.getFilter());
+			});
+	}
+
+	void PhysicsSystem::integrate(float delta)
+	{
+		ZoneScopedN("PhysicsSystem::integrate");
+
+		_motions.resize(_positions.size());
+		withIntegrationScheme(_scheme, [&](auto scheme)
+			{
+				for (size_t i = 0; i < _positions.size(); ++i)
+				{
+					const auto displacement = integrateKinematic<decltype(scheme)::value>(_velocities[i], _accelerations[i], delta);
+					_motions[i] = glm::vec2(displacement.x, displacement.y);
+					_positions[i].z += displacement.z;
+				}
+			});
+	}
+
+	void PhysicsSystem::findCandidates()
+	{
+		ZoneScopedN("PhysicsSystem::findCandidates");
+
+		// Moving colliders go in with the box covering their whole path, so
+		// anything they could hit this step comes back as a candidate. Bounces
+		// keep them inside that box, unless they speed up on the bounce.
+		for (size_t c = 0; c < _colliderBodies.size(); ++c)
+		{
+			const auto& motion = _motions[_colliderBodies[c]];
+			const auto& start = _startBounds[c];
+			const auto overshoot = glm::abs(motion) * std::max(0.0f, _colliderComponents[c]->restitution - 1.0f);
+
+			const Aabb path
+			{
+				glm::min(start.min, start.min + motion) - overshoot,
+				glm::max(start.max, start.max + motion) + overshoot
+			};
+			_broadphase.update(_colliderEntities[c], path, _colliderComponents[c]->getFilter());
+		}
+
+		_broadphase.endUpdate();
+		_broadphase.findPairs(_pairs);
+
+		const auto colliderCount = _colliderBodies.size();
+		_candidateStarts.assign(colliderCount + 1, 0);
+		_bodyPairs.clear();
+
+		const auto classify = [this](const BroadphasePair& pair, uint32_t& a, uint32_t& b)
+			{
+				a = _indexBySlot[EntityHandle::index(pair.entityA)];
+				b = _indexBySlot[EntityHandle::index(pair.entityB)];
+				if ((a & StaticBit) != 0)
+				{
+					std::swap(a, b);
+				}
+			};
+
+		for (const auto& pair : _pairs)
+		{
+			uint32_t a, b;
+			classify(pair, a, b);
+			if ((a & StaticBit) != 0)
+			{
+				// Static colliders never need testing against each other.
+				continue;
+			}
+
+			if ((b & StaticBit) != 0)
+			{
+				_candidateStarts[a + 1]++;
+			}
+			else
+			{
+				_bodyPairs.emplace_back(a, b);
+			}
+		}
+
+		for (size_t c = 0; c < colliderCount; ++c)
+		{
+			_candidateStarts[c + 1] += _candidateStarts[c];
+		}
+
+		_candidates.resize(_candidateStarts[colliderCount]);
+		_candidateCursors.assign(_candidateStarts.begin(), _candidateStarts.end() - 1);
+		for (const auto& pair : _pairs)
+		{
+			uint32_t a, b;
+			classify(pair, a, b);
+			if ((a & StaticBit) == 0 && (b & StaticBit) != 0)
+			{
+				_candidates[_candidateCursors[a]++] = b & ~StaticBit;
+			}
+		}
+	}
+
+	void PhysicsSystem::moveBodies()
+	{
+		ZoneScopedN("PhysicsSystem::moveBodies");
+
+		_endBounds.resize(_colliderBodies.size());
+
+		for (size_t body = 0; body < _positions.size(); ++body)
+		{
+			const auto c = _bodyColliders[body];
+			auto motion = _motions[body];
+			if (c == NoCollider)
+			{
+				_positions[body].x += motion.x;
+				_positions[body].y += motion.y;
+				continue;
+			}
+
+			const auto restitution = _colliderComponents[c]->restitution;
+			auto& velocity = _velocities[body];
+			auto bounds = _startBounds[c];
+			auto elapsed = 0.0f;
+
+			for (int bounce = 0; ; ++bounce)
+			{
+				SweepHit hit;
+				SweepHit first{ .time = 2.0f };
+				uint32_t firstStatic = NoCollider;
+				for (auto i = _candidateStarts[c]; i < _candidateStarts[c + 1]; ++i)
+				{
+					const auto candidate = _candidates[i];
+					if (sweepAabb(bounds, motion, _staticBounds[candidate], hit) && hit.time < first.time)
+					{
+						first = hit;
+						firstStatic = candidate;
+					}
+				}
+
+				if (firstStatic == NoCollider)
+				{
+					moveBounds(bounds, motion);
+					break;
+				}
+
+				// Moved up to the surface, then put exactly against it so the
+				// next sweep starts from touching rather than a rounding error
+				// either side.
+				const auto& target = _staticBounds[firstStatic];
+				const auto axis = first.normal.x != 0.0f ? 0 : 1;
+				moveBounds(bounds, motion * first.time);
+				auto snap = glm::vec2(0.0f);
+				snap[axis] = first.normal[axis] < 0.0f
+					? target.min[axis] - bounds.max[axis]
+					: target.max[axis] - bounds.min[axis];
+				moveBounds(bounds, snap);
+
+				elapsed += (1.0f - elapsed) * first.time;
+				_contacts.push_back(PhysicsContact
+					{
+						.entityA = _colliderEntities[c],
+						.entityB = _staticEntities[firstStatic],
+						.normal = first.normal,
+						.time = elapsed
+					});
+
+				velocity[axis] *= -restitution;
+				if (bounce + 1 == MaxBounces)
+				{
+					// Stopping short beats passing through.
+					break;
+				}
+
+				motion *= 1.0f - first.time;
+				motion[axis] *= -restitution;
+			}
+
+			_endBounds[c] = bounds;
+			const auto& offset = _colliderComponents[c]->offset;
+			_positions[body].x = bounds.min.x - offset.x;
+			_positions[body].y = bounds.min.y - offset.y;
+		}
+	}
+
+	void PhysicsSystem::findBodyContacts()
+	{
+		ZoneScopedN("PhysicsSystem::findBodyContacts");
+
+		// Each body is taken to have moved in a straight line from its start to
+		// its end, which is exact unless it bounced.
+		for (const auto& [a, b] : _bodyPairs)
+		{
+			const auto motion = (_endBounds[a].min - _startBounds[a].min) - (_endBounds[b].min - _startBounds[b].min);
+
+			SweepHit hit;
+			if (sweepAabb(_startBounds[a], motion, _startBounds[b], hit))
+			{
+				_contacts.push_back(PhysicsContact{ _colliderEntities[a], _colliderEntities[b], hit.normal, hit.time });
+			}
+			else if (_endBounds[a].overlaps(_endBounds[b]))
+			{
+				const auto overlapping = _startBounds[a].overlaps(_startBounds[b]);
+				_contacts.push_back(PhysicsContact{ _colliderEntities[a], _colliderEntities[b], glm::vec2(0.0f), overlapping ? 0.0f : 1.0f });
+			}
+		}
+	}
+}
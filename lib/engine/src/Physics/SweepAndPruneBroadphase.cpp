@@ -0,0 +1,119 @@
+#include <helsinki/Engine/Physics/SweepAndPruneBroadphase.hpp>
+#include <helsinki/System/HelsinkiTracy.hpp>
+#include <algorithm>
+
+namespace hl
+{
+	void SweepAndPruneBroadphase::onAdded(uint32_t proxy)
+	{
+		if (proxy >= _stale.size())
+		{
+			_stale.resize(proxy + 1, 0);
+		}
+
+		// A proxy id reused before the sweep dropped it is still in the order.
+		if (_stale[proxy])
+		{
+			_stale[proxy] = 0;
+			_staleCount--;
+		}
+		else
+		{
+			_order.push_back(proxy);
+		}
+
+		_addedCount++;
+	}
+
+	void SweepAndPruneBroadphase::onMoved(uint32_t, const Aabb&)
+	{
+		// Picked up by the insertion sort before the next sweep.
+	}
+
+	void SweepAndPruneBroadphase::onRemoved(uint32_t proxy)
+	{
+		_stale[proxy] = 1;
+		_staleCount++;
+	}
+
+	void SweepAndPruneBroadphase::onCleared()
+	{
+		_order.clear();
+		_sweepBounds.clear();
+		_sweepFilters.clear();
+		_sweepEntities.clear();
+		_stale.clear();
+		_staleCount = 0;
+		_addedCount = 0;
+	}
+
+	void SweepAndPruneBroadphase::collectPairs(std::vector<BroadphasePair>& pairs)
+	{
+		ZoneScopedN("SweepAndPruneBroadphase::collectPairs");
+
+		sortOrder();
+
+		_sweepBounds.clear();
+		_sweepBounds.reserve(_order.size());
+		_sweepFilters.resize(_order.size());
+		_sweepEntities.resize(_order.size());
+		for (size_t i = 0; i < _order.size(); ++i)
+		{
+			const auto& proxy = _proxies[_order[i]];
+			_sweepBounds.add(proxy.bounds);
+			_sweepFilters[i] = proxy.filter;
+			_sweepEntities[i] = proxy.entityId;
+		}
+
+		const auto count = (uint32_t)_order.size();
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			_hits.clear();
+			_sweepBounds.findSortedOverlaps(_sweepBounds.get(i), _hits, i + 1);
+
+			for (const auto j : _hits)
+			{
+				if (_sweepFilters[i].accepts(_sweepFilters[j]))
+				{
+					pairs.push_back(BroadphasePair{ _sweepEntities[i], _sweepEntities[j] });
+				}
+			}
+		}
+	}
+
+	void SweepAndPruneBroadphase::sortOrder()
+	{
+		if (_staleCount > 0)
+		{
+			std::erase_if(_order, [this](uint32_t proxy) { return _stale[proxy] != 0; });
+			std::fill(_stale.begin(), _stale.end(), uint8_t{ 0 });
+			_staleCount = 0;
+		}
+
+		const auto minX = [this](uint32_t proxy) { return _proxies[proxy].bounds.min.x; };
+
+		if (_addedCount > _order.size() / 8)
+		{
+			std::sort(_order.begin(), _order.end(),
+				[&](uint32_t a, uint32_t b) { return minX(a) < minX(b); });
+		}
+		else
+		{
+			for (size_t i = 1; i < _order.size(); ++i)
+			{
+				const auto proxy = _order[i];
+				const auto key = minX(proxy);
+
+				auto j = i;
+				while (j > 0 && minX(_order[j - 1]) > key)
+				{
+					_order[j] = _order[j - 1];
+					j--;
+				}
+				_order[j] = proxy;
+			}
+		}
+
+		_addedCount = 0;
+	}
+}
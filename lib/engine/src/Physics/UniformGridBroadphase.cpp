@@ -0,0 +1,142 @@
+#include <helsinki/Engine/Physics/UniformGridBroadphase.hpp>
+#include <helsinki/System/HelsinkiTracy.hpp>
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace hl
+{
+	UniformGridBroadphase::UniformGridBroadphase(float cellSize) :
+		_cellSize(cellSize),
+		_inverseCellSize(1.0f / cellSize)
+	{
+		if (!(cellSize > 0.0f))
+		{
+			throw std::runtime_error("Broadphase cell size must be positive");
+		}
+	}
+
+	void UniformGridBroadphase::onAdded(uint32_t proxy)
+	{
+		if (proxy >= _ranges.size())
+		{
+			_ranges.resize(proxy + 1);
+		}
+
+		const auto range = cellRangeOf(_proxies[proxy].bounds);
+		_ranges[proxy] = range;
+		insertInto(proxy, range);
+	}
+
+	void UniformGridBroadphase::onMoved(uint32_t proxy, const Aabb&)
+	{
+		const auto range = cellRangeOf(_proxies[proxy].bounds);
+		if (range == _ranges[proxy])
+		{
+			return;
+		}
+
+		removeFrom(proxy, _ranges[proxy]);
+		_ranges[proxy] = range;
+		insertInto(proxy, range);
+	}
+
+	void UniformGridBroadphase::onRemoved(uint32_t proxy)
+	{
+		removeFrom(proxy, _ranges[proxy]);
+	}
+
+	void UniformGridBroadphase::onCleared()
+	{
+		_cells.clear();
+		_ranges.clear();
+	}
+
+	void UniformGridBroadphase::collectPairs(std::vector<BroadphasePair>& pairs)
+	{
+		ZoneScopedN("UniformGridBroadphase::collectPairs");
+
+		for (const auto& [key, proxies] : _cells)
+		{
+			const auto x = (int32_t)(uint32_t)(key >> 32);
+			const auto y = (int32_t)(uint32_t)key;
+
+			for (size_t i = 0; i < proxies.size(); ++i)
+			{
+				const auto a = proxies[i];
+				const auto& rangeA = _ranges[a];
+				const auto& proxyA = _proxies[a];
+
+				for (size_t j = i + 1; j < proxies.size(); ++j)
+				{
+					const auto b = proxies[j];
+					const auto& rangeB = _ranges[b];
+
+					// Colliders sharing several cells are only reported from
+					// the first of them.
+					if (std::max(rangeA.minX, rangeB.minX) != x ||
+						std::max(rangeA.minY, rangeB.minY) != y)
+					{
+						continue;
+					}
+
+					const auto& proxyB = _proxies[b];
+					if (isCandidate(proxyA, proxyB))
+					{
+						pairs.push_back(BroadphasePair{ proxyA.entityId, proxyB.entityId });
+					}
+				}
+			}
+		}
+	}
+
+	UniformGridBroadphase::CellRange UniformGridBroadphase::cellRangeOf(const Aabb& bounds) const
+	{
+		return CellRange
+		{
+			.minX = (int32_t)std::floor(bounds.min.x * _inverseCellSize),
+			.minY = (int32_t)std::floor(bounds.min.y * _inverseCellSize),
+			.maxX = (int32_t)std::floor(bounds.max.x * _inverseCellSize),
+			.maxY = (int32_t)std::floor(bounds.max.y * _inverseCellSize)
+		};
+	}
+
+	void UniformGridBroadphase::insertInto(uint32_t proxy, const CellRange& range)
+	{
+		for (auto y = range.minY; y <= range.maxY; ++y)
+		{
+			for (auto x = range.minX; x <= range.maxX; ++x)
+			{
+				_cells[cellKey(x, y)].push_back(proxy);
+			}
+		}
+	}
+
+	void UniformGridBroadphase::removeFrom(uint32_t proxy, const CellRange& range)
+	{
+		for (auto y = range.minY; y <= range.maxY; ++y)
+		{
+			for (auto x = range.minX; x <= range.maxX; ++x)
+			{
+				const auto cell = _cells.find(cellKey(x, y));
+				if (cell == _cells.end())
+				{
+					continue;
+				}
+
+				auto& proxies = cell->second;
+				const auto it = std::find(proxies.begin(), proxies.end(), proxy);
+				if (it != proxies.end())
+				{
+					*it = proxies.back();
+					proxies.pop_back();
+				}
+
+				if (proxies.empty())
+				{
+					_cells.erase(cell);
+				}
+			}
+		}
+	}
+}
@@ -1,16 +1,143 @@
 #include <helsinki/Engine/Scene/Scene.hpp>
+#include <bit>
+#include <stdexcept>
 
 namespace hl
 {
 	Entity* Scene::addEntity()
 	{
-		_entities.emplace_back(std::make_unique<Entity>(_nextId++));
+		return createEntity(nullptr);
+	}
+
+	uint32_t Scene::allocateSlot()
+	{
+		if (!_freeSlots.empty())
+		{
+			const auto index = _freeSlots.back();
+			_freeSlots.pop_back();
+			return index;
+		}
+
+		if (_slots.size() >= EntityHandle::MaxEntities)
+		{
+			throw std::runtime_error("Scene has run out of entity slots");
+		}
+
+		_slots.emplace_back();
+		return (uint32_t)_slots.size() - 1;
+	}
+
+	Entity* Scene::createEntity(Archetype* archetype)
+	{
+		const auto index = allocateSlot();
+		auto& slot = _slots[index];
+		slot.dense = (uint32_t)_entities.size();
+
+		_entities.emplace_back(_entityPool.make(EntityHandle::make(index, slot.generation), _storage, _tagRegistry));
 
 		auto& ePtr = _entities.back();
+		try
+		{
+			if (archetype == nullptr)
+			{
+				_storage.createEntity(*ePtr);
+			}
+			else
+			{
+				_storage.createEntity(*ePtr, *archetype);
+			}
+		}
+		catch (...)
+		{
+			_entities.pop_back();
+			slot.dense = EntitySlot::Free;
+			_freeSlots.push_back(index);
+			throw;
+		}
 
 		return ePtr.get();
 	}
 
+	EntityPool& Scene::createPool(Prefab prefab, size_t count)
+	{
+		auto& pool = *_pools.emplace_back(new EntityPool(std::move(prefab)));
+
+		// Spawned entities go straight to the archetype with the prefab's tags.
+		TagMask tags;
+		for (const auto tag : pool._prefab.getTags())
+		{
+			pool._tags.push_back(_tagRegistry.getOrCreateIndex(tag));
+			tags.set(pool._tags.back());
+		}
+
+		pool._archetype = _storage.getArchetype(pool._prefab.getTypes(), tags);
+		pool._waitingArchetype = _storage.getPoolArchetype(*pool._archetype);
+		for (const auto type : pool._archetype->getTypes())
+		{
+			pool._prototypes.push_back(pool._prefab.getPrototype(*type));
+		}
+
+		pool._waiting.reserve(count);
+		for (size_t i = 0; i < count; ++i)
+		{
+			addToPool(pool);
+		}
+
+		return pool;
+	}
+
+	void Scene::addToPool(EntityPool& pool)
+	{
+		// Waiting entities are not part of the scene, so have no id of their own.
+		auto entity = _entityPool.make(EntityHandle::Invalid, _storage, _tagRegistry);
+		_storage.createEntity(*entity, *pool._waitingArchetype, pool._prototypes);
+		entity->_pool = &pool;
+		pool._waiting.push_back(std::move(entity));
+		pool._stats.capacity++;
+	}
+
+	Entity* Scene::spawn(EntityPool& pool)
+	{
+		if (pool._waiting.empty())
+		{
+			addToPool(pool);
+			pool._stats.grows++;
+		}
+
+		const auto index = allocateSlot();
+		auto& slot = _slots[index];
+
+		// The waiting entity's id is stale, so its row moves to a new entity with
+		// a fresh one and ids held on to from its last spawn stay invalid.
+		auto entity = _entityPool.make(EntityHandle::make(index, slot.generation), _storage, _tagRegistry);
+		_storage.moveEntity(*pool._waiting.back(), *entity, *pool._archetype);
+		pool._waiting.pop_back();
+
+		const auto& types = pool._archetype->getTypes();
+		const auto row = entity->_location.row;
+		for (size_t column = 0; column < types.size(); ++column)
+		{
+			auto component = pool._archetype->getComponent(row, column);
+			types[column]->copyAssign(component, pool._prototypes[column]);
+			types[column]->setOwner(component, entity.get());
+		}
+
+		for (const auto tag : pool._tags)
+		{
+			entity->addTagIndex(tag);
+		}
+		entity->_pool = &pool;
+
+		slot.dense = (uint32_t)_entities.size();
+		_entities.push_back(std::move(entity));
+
+		pool._stats.spawns++;
+		pool._stats.active++;
+		pool._stats.peak = std::max(pool._stats.peak, pool._stats.active);
+
+		return _entities.back().get();
+	}
+
 	Entity* Scene::addEntity(const std::string& name)
 	{
 		if (auto e = getEntity(name); e != nullptr)
@@ -20,72 +147,155 @@ namespace hl
 
 		auto e = addEntity();
 		e->setName(name);
+		_entitiesByName.emplace(name, e->Id);
 		return e;
 	}
 
 	Entity* Scene::getEntity(const std::string& name)
 	{
-		auto it = std::find_if(
-			_entities.begin(),
-			_entities.end(),
-			[&name](const std::unique_ptr<Entity>& e)
-			{
-				return name == e->getName();
-			});
-
-		if (it == _entities.end())
+		auto it = _entitiesByName.find(name);
+		if (it == _entitiesByName.end())
 		{
 			return nullptr;
 		}
 
-		return (*it).get();
+		return getEntity(it->second);
 	}
 
 	Entity* Scene::getEntity(int id)
 	{
-		auto it = std::find_if(
-			_entities.begin(),
-			_entities.end(),
-			[&id](const std::unique_ptr<Entity>& e)
-			{
-				return id == e->Id;
-			});
-
-		if (it == _entities.end())
+		if (!isValid(id))
 		{
 			return nullptr;
 		}
 
-		return (*it).get();
+		return _entities[_slots[EntityHandle::index(id)].dense].get();
+	}
+
+	bool Scene::isValid(int id) const
+	{
+		const auto index = EntityHandle::index(id);
+		if (index >= _slots.size())
+		{
+			return false;
+		}
+
+		const auto& slot = _slots[index];
+		return slot.dense != EntitySlot::Free && slot.generation == EntityHandle::generation(id);
 	}
 
 	void Scene::removeEntity(const std::string& name)
 	{
 		if (auto e = getEntity(name); e != nullptr)
 		{
-			_entitiesToRemove.insert(e->Id);
+			removeEntity(e->Id);
 		}
 	}
 
 	void Scene::removeEntity(int id)
 	{
-		if (auto e = getEntity(id); e != nullptr)
+		if (isValid(id))
 		{
-			_entitiesToRemove.insert(id);
+			std::lock_guard lock(_entitiesToRemoveMutex);
+			auto& slot = _slots[EntityHandle::index(id)];
+			if (!slot.pendingRemoval)
+			{
+				slot.pendingRemoval = true;
+				_entitiesToRemove.push_back(id);
+			}
 		}
 	}
 
+	bool Scene::isPendingRemoval(int id) const
+	{
+		if (!isValid(id))
+		{
+			return false;
+		}
+
+		std::lock_guard lock(_entitiesToRemoveMutex);
+		return _slots[EntityHandle::index(id)].pendingRemoval;
+	}
+
+	CommandBuffer& Scene::getCommandBuffer()
+	{
+		if (auto current = SystemScheduler::getCurrentCommandBuffer(); current != nullptr)
+		{
+			return *current;
+		}
+
+		return _commands;
+	}
+
 	void Scene::update()
 	{
+		for (const auto& commands : _scheduler.getCommandBuffers())
+		{
+			commands->playback(*this);
+		}
+		_commands.playback(*this);
+
 		if (!_entitiesToRemove.empty())
 		{
-			std::erase_if(_entities, [&](const std::unique_ptr<Entity>& e)
+			std::erase_if(_entities, [&](EntityPointer& e)
 				{
-					return _entitiesToRemove.contains(e->Id);
+					auto& slot = _slots[EntityHandle::index(e->Id)];
+					if (!slot.pendingRemoval)
+					{
+						return false;
+					}
+
+					slot.pendingRemoval = false;
+					slot.dense = EntitySlot::Free;
+					slot.generation = EntityHandle::nextGeneration(slot.generation);
+					_freeSlots.push_back(EntityHandle::index(e->Id));
+
+					if (const auto& name = e->getName(); !name.empty())
+					{
+						if (auto it = _entitiesByName.find(name); it != _entitiesByName.end() && it->second == e->Id)
+						{
+							_entitiesByName.erase(it);
+						}
+					}
+
+					// Only visits the tags the entity has.
+					static_assert(TagRegistry::MaxTags <= 64);
+					for (auto tags = e->getTags().to_ullong(); tags != 0; tags &= tags - 1)
+					{
+						_tagRegistry.remove((uint32_t)std::countr_zero(tags), *e);
+					}
+
+					if (auto pool = e->_pool; pool != nullptr)
+					{
+						pool->_stats.active--;
+
+						// Only entities that still have the prefab's components can be
+						// spawned again, extra tags are cleared below.
+						if (e->_location.archetype->getMask() == pool->_archetype->getMask())
+						{
+							_storage.moveEntity(*e, *e, *pool->_waitingArchetype);
+							e->_tags.reset();
+							pool->_waiting.push_back(std::move(e));
+							return true;
+						}
+
+						pool->_stats.capacity--;
+					}
+
+					_storage.destroyEntity(*e);
+					return true;
 				});
 
+			// Removal keeps the remaining entities in order, so re-point their slots.
+			for (uint32_t i = 0; i < (uint32_t)_entities.size(); ++i)
+			{
+				_slots[EntityHandle::index(_entities[i]->Id)].dense = i;
+			}
+
 			_entitiesToRemove.clear();
 		}
+
+		_transformHierarchy.update(*this);
 	}
 
 	void Scene::addSystem(System* system)
@@ -93,34 +303,117 @@ namespace hl
 		_systems.emplace_back(std::move(system));
 	}
 
-	const std::vector<std::unique_ptr<Entity>>& Scene::getEntities() const
+	const std::vector<Scene::EntityPointer>& Scene::getEntities() const
 	{
 		return _entities;
 	}
-	std::vector<std::unique_ptr<Entity>>& Scene::getEntities()
+	std::vector<Scene::EntityPointer>& Scene::getEntities()
 	{
 		return _entities;
 	}
 
-	std::vector<Entity*> Scene::getEntitiesByTag(const std::string& tag) const
+	void Scene::reserve(size_t entityCount)
 	{
-		std::vector<Entity*> taggedEntities;
+		_entityPool.reserve(entityCount);
+		_entities.reserve(entityCount);
+		_slots.reserve(entityCount);
+		_freeSlots.reserve(entityCount);
+		_entitiesToRemove.reserve(entityCount);
+	}
+
+	SceneAllocationStats Scene::getAllocationStats() const
+	{
+		SceneAllocationStats stats
+		{
+			.entities = _entityPool.getStats(),
+			.chunks = _storage.getChunkStats(),
+			.prefabPools = {}
+		};
+
+		for (const auto& pool : _pools)
+		{
+			const auto& poolStats = pool->getStats();
+			stats.prefabPools.capacity += poolStats.capacity;
+			stats.prefabPools.active += poolStats.active;
+			stats.prefabPools.peak += poolStats.peak;
+			stats.prefabPools.spawns += poolStats.spawns;
+			stats.prefabPools.grows += poolStats.grows;
+		}
 
-		transform_if(
-			std::cbegin(_entities),
-			std::cend(_entities),
-			std::back_inserter(taggedEntities),
-			[&](const std::unique_ptr<Entity>& o) { return o->HasTag(tag); },
-			[](const std::unique_ptr<Entity>& o) { return o.get(); });
+		return stats;
+	}
 
-		return taggedEntities;
+	const std::vector<Entity*>& Scene::getEntitiesByTag(const std::string& tag) const
+	{
+		return getEntitiesByTag(String::fnv1a_32(tag));
+	}
+	const std::vector<Entity*>& Scene::getEntitiesByTag(uint32_t tagHash) const
+	{
+		return _tagRegistry.getEntities(_tagRegistry.findIndex(tagHash));
 	}
 
 	void Scene::update(float delta)
 	{
-		for (auto& system : _systems)
+		_scheduler.update(_systems, delta);
+	}
+
+	void Scene::setDeterministic(uint64_t seed)
+	{
+		_random.seed(seed);
+		// Concurrent systems publish events and take random numbers in
+		// whatever order their threads get there.
+		_scheduler.setParallel(false);
+		_deterministic = true;
+	}
+
+	uint64_t Scene::checksum() const
+	{
+		Checksum checksum;
+		checksum.add(_random.getState());
+
+		for (const auto& archetype : _storage.getArchetypes())
 		{
-			system->update(delta);
+			if (archetype->getEntityCount() == 0)
+			{
+				continue;
+			}
+
+			const auto& types = archetype->getTypes();
+			for (const auto type : types)
+			{
+				checksum.add(type->id);
+			}
+
+			for (size_t c = 0; c < archetype->getChunkCount(); ++c)
+			{
+				const auto& chunk = archetype->getChunk(c);
+				const auto entities = archetype->getEntities(chunk);
+				for (uint32_t row = 0; row < chunk.getCount(); ++row)
+				{
+					checksum.add(entities[row]->Id);
+					// Tag indices depend on the order tags were first used, hashes do not.
+					for (auto tags = entities[row]->getTags().to_ullong(); tags != 0; tags &= tags - 1)
+					{
+						checksum.add(_tagRegistry.getHash((uint32_t)std::countr_zero(tags)));
+					}
+				}
+
+				for (size_t column = 0; column < types.size(); ++column)
+				{
+					if (types[column]->checksum == nullptr)
+					{
+						continue;
+					}
+
+					const auto data = static_cast<const std::byte*>(archetype->getColumn(chunk, column));
+					for (uint32_t row = 0; row < chunk.getCount(); ++row)
+					{
+						types[column]->checksum(data + row * types[column]->size, checksum);
+					}
+				}
+			}
 		}
+
+		return checksum.get();
 	}
 }
\ No newline at end of file
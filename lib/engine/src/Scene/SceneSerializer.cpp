@@ -0,0 +1,649 @@
+#include <helsinki/Engine/Scene/SceneSerializer.hpp>
+#include <helsinki/Engine/ECS/Components/TransformComponent.hpp>
+#include <helsinki/Engine/ECS/Components/KinematicComponent.hpp>
+#include <helsinki/Engine/ECS/Components/ColliderComponent.hpp>
+#include <helsinki/Engine/ECS/Components/SpriteComponent.hpp>
+#include <helsinki/Engine/ECS/Components/ModelComponent.hpp>
+#include <helsinki/System/Utils/Json.hpp>
+#include <helsinki/System/HelsinkiTracy.hpp>
+#include <bit>
+#include <fstream>
+#include <stdexcept>
+
+namespace hl
+{
+	static constexpr char Magic[4] = { 'H', 'L', 'S', 'C' };
+	static constexpr uint32_t NoIndex = UINT32_MAX;
+	// Smallest a component (name and field count) and an entity (name and tag
+	// mask) can take up in the data, to check the header's counts against.
+	static constexpr size_t MinComponentSize = 3 * sizeof(uint32_t);
+	static constexpr size_t MinEntitySize = 2 * sizeof(uint32_t) + sizeof(uint64_t);
+
+	struct SceneFileHeader
+	{
+		char magic[4];
+		uint32_t version;
+		uint32_t componentCount;
+		uint32_t tagCount;
+		uint32_t blockCount;
+		uint32_t entityCount;
+		uint64_t stringsOffset;
+		uint64_t stringsSize;
+	};
+
+	static uint32_t fieldSize(SerializedFieldType type)
+	{
+		switch (type)
+		{
+		case SerializedFieldType::Int32:
+		case SerializedFieldType::UInt32:
+		case SerializedFieldType::Float:
+		case SerializedFieldType::Bool:
+		case SerializedFieldType::Entity:
+			return 4;
+		case SerializedFieldType::Vec2:
+		case SerializedFieldType::String:
+			return 8;
+		case SerializedFieldType::Vec3:
+			return 12;
+		case SerializedFieldType::Vec4:
+			return 16;
+		}
+
+		throw std::runtime_error("Scene data has an unknown field type");
+	}
+
+	template<typename T>
+	static void append(std::vector<std::byte>& data, const T& value)
+	{
+		const auto offset = data.size();
+		data.resize(offset + sizeof(T));
+		std::memcpy(data.data() + offset, &value, sizeof(T));
+	}
+
+	// Bounds checked reads from the saved data, which may be unaligned.
+	class SceneDataReader
+	{
+	public:
+		explicit SceneDataReader(std::span<const std::byte> data) : _data(data) {}
+
+		template<typename T>
+		T read()
+		{
+			T value;
+			std::memcpy(&value, take(sizeof(T)), sizeof(T));
+			return value;
+		}
+
+		const std::byte* take(size_t size)
+		{
+			if (size > _data.size() - _offset)
+			{
+				throw std::runtime_error("Scene data is truncated");
+			}
+
+			const auto data = _data.data() + _offset;
+			_offset += size;
+			return data;
+		}
+
+		size_t getRemaining() const { return _data.size() - _offset; }
+
+	private:
+		std::span<const std::byte> _data;
+		size_t _offset{ 0 };
+	};
+
+	uint32_t SceneWriteContext::addString(const std::string& value)
+	{
+		if (value.empty())
+		{
+			return 0;
+		}
+
+		const auto [it, added] = stringOffsets.emplace(value, (uint32_t)strings.size());
+		if (added)
+		{
+			strings += value;
+		}
+		return it->second;
+	}
+
+	uint32_t SceneWriteContext::getEntityIndex(int id) const
+	{
+		const auto slot = EntityHandle::index(id);
+		if (!scene->isValid(id) || slot >= entityIndices.size())
+		{
+			return NoIndex;
+		}
+
+		return entityIndices[slot];
+	}
+
+	std::string SceneReadContext::getString(uint32_t offset, uint32_t length) const
+	{
+		if ((size_t)offset + length > strings.size())
+		{
+			throw std::runtime_error("Scene data has a string out of range");
+		}
+
+		return std::string(reinterpret_cast<const char*>(strings.data()) + offset, length);
+	}
+
+	int SceneReadContext::getEntity(uint32_t index) const
+	{
+		return index < entities.size() ? entities[index] : EntityHandle::Invalid;
+	}
+
+	void SceneSerializer::registerEngineComponents()
+	{
+		registerComponent<TransformComponent>("Transform")
+			.field<&TransformComponent::GetPosition, &TransformComponent::SetPosition>("position")
+			.field<&TransformComponent::GetRotation, &TransformComponent::SetRotation>("rotation")
+			.field<&TransformComponent::GetScale, &TransformComponent::SetScale>("scale")
+			.entityField<&TransformComponent::GetParent, &TransformComponent::SetParent>("parent");
+
+		registerComponent<KinematicComponent>("Kinematic")
+			.field<&KinematicComponent::velocity>("velocity")
+			.field<&KinematicComponent::acceleration>("acceleration");
+
+		registerComponent<ColliderComponent>("Collider")
+			.field<&ColliderComponent::size>("size")
+			.field<&ColliderComponent::offset>("offset")
+			.field<&ColliderComponent::layer>("layer")
+			.field<&ColliderComponent::mask>("mask")
+			.field<&ColliderComponent::restitution>("restitution");
+
+		registerComponent<SpriteComponent>("Sprite")
+			.field<&SpriteComponent::getFrameDataIndex, &SpriteComponent::setFrameDataIndex>("frameDataIndex");
+
+		registerComponent<ModelComponent>("Model")
+			.field<&ModelComponent::getModelId, &ModelComponent::setModelId>("modelId");
+	}
+
+	std::vector<std::byte> SceneSerializer::save(const Scene& scene) const
+	{
+		ZoneScopedN("SceneSerializer::save");
+
+		struct Block
+		{
+			const Archetype* archetype;
+			std::vector<uint32_t> components;
+			std::vector<size_t> columns;
+		};
+
+		SceneWriteContext context;
+		context.scene = &scene;
+
+		// Number every entity first so that entity fields can refer to entities
+		// in blocks that have not been written yet.
+		std::vector<Block> blocks;
+		uint32_t entityCount = 0;
+		for (const auto& archetype : scene.getStorage().getArchetypes())
+		{
+			if (archetype->getEntityCount() == 0)
+			{
+				continue;
+			}
+
+			auto& block = blocks.emplace_back(Block{ .archetype = archetype.get(), .components = {}, .columns = {} });
+			for (uint32_t c = 0; c < (uint32_t)_components.size(); ++c)
+			{
+				const auto column = archetype->getColumnIndex(_components[c]->type->index);
+				if (column >= 0)
+				{
+					block.components.push_back(c);
+					block.columns.push_back((size_t)column);
+				}
+			}
+
+			for (uint32_t row = 0; row < archetype->getEntityCount(); ++row)
+			{
+				const auto slot = EntityHandle::index(archetype->getEntity(row)->Id);
+				if (slot >= context.entityIndices.size())
+				{
+					context.entityIndices.resize(slot + 1, NoIndex);
+				}
+				context.entityIndices[slot] = entityCount++;
+			}
+		}
+
+		std::vector<std::byte> data(sizeof(SceneFileHeader));
+
+		for (const auto& component : _components)
+		{
+			append(data, context.addString(component->name));
+			append(data, (uint32_t)component->name.size());
+			append(data, (uint32_t)component->fields.size());
+
+			for (const auto& field : component->fields)
+			{
+				append(data, context.addString(field.name));
+				append(data, (uint32_t)field.name.size());
+				append(data, field.type);
+			}
+		}
+
+		const auto& tags = scene._tagRegistry;
+		for (uint32_t tag = 0; tag < (uint32_t)tags.getTagCount(); ++tag)
+		{
+			append(data, tags.getHash(tag));
+		}
+
+		for (const auto& block : blocks)
+		{
+			const auto archetype = block.archetype;
+			const auto count = archetype->getEntityCount();
+
+			append(data, count);
+			append(data, (uint32_t)block.components.size());
+			for (const auto component : block.components)
+			{
+				append(data, component);
+			}
+
+			for (uint32_t row = 0; row < count; ++row)
+			{
+				const auto& name = archetype->getEntity(row)->getName();
+				append(data, context.addString(name));
+				append(data, (uint32_t)name.size());
+			}
+			for (uint32_t row = 0; row < count; ++row)
+			{
+				append(data, (uint64_t)archetype->getEntity(row)->getTags().to_ullong());
+			}
+
+			for (size_t c = 0; c < block.components.size(); ++c)
+			{
+				for (const auto& field : _components[block.components[c]]->fields)
+				{
+					const auto offset = data.size();
+					data.resize(offset + (size_t)field.size * count);
+
+					for (uint32_t row = 0; row < count; ++row)
+					{
+						field.write(archetype->getComponent(row, block.columns[c]), data.data() + offset + (size_t)field.size * row, context);
+					}
+				}
+			}
+		}
+
+		SceneFileHeader header
+		{
+			.magic = { Magic[0], Magic[1], Magic[2], Magic[3] },
+			.version = Version,
+			.componentCount = (uint32_t)_components.size(),
+			.tagCount = (uint32_t)tags.getTagCount(),
+			.blockCount = (uint32_t)blocks.size(),
+			.entityCount = entityCount,
+			.stringsOffset = data.size(),
+			.stringsSize = context.strings.size()
+		};
+		std::memcpy(data.data(), &header, sizeof(header));
+
+		const auto strings = reinterpret_cast<const std::byte*>(context.strings.data());
+		data.insert(data.end(), strings, strings + context.strings.size());
+
+		return data;
+	}
+
+	void SceneSerializer::saveToFile(const Scene& scene, const std::string& path) const
+	{
+		const auto data = save(scene);
+
+		std::ofstream file(path, std::ios::binary | std::ios::trunc);
+		file.write(reinterpret_cast<const char*>(data.data()), (std::streamsize)data.size());
+		if (!file)
+		{
+			throw std::runtime_error(std::format("Failed to write scene to {}", path));
+		}
+	}
+
+	void SceneSerializer::load(Scene& scene, std::span<const std::byte> data) const
+	{
+		ZoneScopedN("SceneSerializer::load");
+
+		SceneDataReader reader(data);
+
+		const auto header = reader.read<SceneFileHeader>();
+		if (std::memcmp(header.magic, Magic, sizeof(Magic)) != 0)
+		{
+			throw std::runtime_error("Data is not a saved scene");
+		}
+		if (header.version > Version)
+		{
+			throw std::runtime_error(std::format("Scene data is version {}, only up to {} is supported", header.version, Version));
+		}
+		if (header.stringsOffset > data.size() || header.stringsSize > data.size() - header.stringsOffset)
+		{
+			throw std::runtime_error("Scene data is truncated");
+		}
+		// The counts size the allocations below, so have to fit in the data first.
+		if (header.componentCount > reader.getRemaining() / MinComponentSize ||
+			header.entityCount > reader.getRemaining() / MinEntitySize)
+		{
+			throw std::runtime_error("Scene data is truncated");
+		}
+
+		SceneReadContext context;
+		context.strings = data.subspan((size_t)header.stringsOffset, (size_t)header.stringsSize);
+
+		// Match the saved components and fields to the registered ones by name,
+		// anything that is not registered (any more) is skipped over.
+		struct LoadedField
+		{
+			const SerializedField* field;
+			uint32_t size;
+		};
+		struct LoadedComponent
+		{
+			const SerializedComponent* component;
+			std::vector<LoadedField> fields;
+		};
+
+		std::vector<LoadedComponent> components(header.componentCount);
+		for (auto& loaded : components)
+		{
+			const auto nameOffset = reader.read<uint32_t>();
+			const auto nameLength = reader.read<uint32_t>();
+			loaded.component = findComponent(context.getString(nameOffset, nameLength));
+
+			const auto fieldCount = reader.read<uint32_t>();
+			for (uint32_t f = 0; f < fieldCount; ++f)
+			{
+				const auto fieldNameOffset = reader.read<uint32_t>();
+				const auto fieldNameLength = reader.read<uint32_t>();
+				const auto type = reader.read<SerializedFieldType>();
+
+				const SerializedField* match = nullptr;
+				if (loaded.component != nullptr)
+				{
+					const auto name = context.getString(fieldNameOffset, fieldNameLength);
+					for (const auto& field : loaded.component->fields)
+					{
+						if (field.name == name && field.type == type)
+						{
+							match = &field;
+							break;
+						}
+					}
+				}
+
+				loaded.fields.push_back(LoadedField{ .field = match, .size = fieldSize(type) });
+			}
+		}
+
+		if (header.tagCount > TagRegistry::MaxTags)
+		{
+			throw std::runtime_error("Scene data has too many tags");
+		}
+
+		std::vector<uint32_t> tagIndices;
+		for (uint32_t tag = 0; tag < header.tagCount; ++tag)
+		{
+			tagIndices.push_back(scene._tagRegistry.getOrCreateIndex(reader.read<uint32_t>()));
+		}
+
+		struct LoadedBlock
+		{
+			Archetype* archetype;
+			size_t firstEntity;
+			uint32_t count;
+			std::vector<uint32_t> components;
+			const std::byte* fields;
+		};
+
+		std::vector<LoadedBlock> blocks;
+		std::vector<Entity*> entities;
+		entities.reserve(header.entityCount);
+		context.entities.reserve(header.entityCount);
+		scene.reserve(scene.getEntities().size() + header.entityCount);
+		scene._entitiesByName.reserve(scene._entitiesByName.size() + header.entityCount);
+
+		try
+		{
+			// Create every entity straight into its archetype first, so that entity
+			// fields can be resolved regardless of which block they point into.
+			for (uint32_t b = 0; b < header.blockCount; ++b)
+			{
+				auto& block = blocks.emplace_back();
+				block.count = reader.read<uint32_t>();
+				block.firstEntity = entities.size();
+
+				const auto componentCount = reader.read<uint32_t>();
+				std::vector<const ComponentTypeInfo*> types;
+				ComponentMask mask;
+				for (uint32_t c = 0; c < componentCount; ++c)
+				{
+					const auto index = reader.read<uint32_t>();
+					if (index >= components.size())
+					{
+						throw std::runtime_error("Scene data refers to an unknown component");
+					}
+
+					block.components.push_back(index);
+					if (const auto component = components[index].component; component != nullptr && !mask.test(component->type->index))
+					{
+						mask.set(component->type->index);
+						types.push_back(component->type);
+					}
+				}
+
+				const auto names = reader.take((size_t)block.count * 2 * sizeof(uint32_t));
+				const auto tags = reader.take((size_t)block.count * sizeof(uint64_t));
+
+				// Tags are part of the archetype, so each entity's saved tag bits are
+				// turned into this scene's TagMask before it is created. A block is
+				// one archetype when saved, so the archetype is only looked up again
+				// if the mask changes, which older data may do.
+				Archetype* archetype = nullptr;
+				uint64_t archetypeTags = 0;
+				TagMask tagMask;
+				for (uint32_t i = 0; i < block.count; ++i)
+				{
+					uint64_t savedTags;
+					std::memcpy(&savedTags, tags + i * sizeof(savedTags), sizeof(savedTags));
+					if (archetype == nullptr || savedTags != archetypeTags)
+					{
+						tagMask.reset();
+						for (auto bits = savedTags; bits != 0; bits &= bits - 1)
+						{
+							const auto tag = (uint32_t)std::countr_zero(bits);
+							if (tag >= tagIndices.size())
+							{
+								throw std::runtime_error("Scene data refers to an unknown tag");
+							}
+							tagMask.set(tagIndices[tag]);
+						}
+
+						archetype = scene._storage.getArchetype(types, tagMask);
+						archetypeTags = savedTags;
+					}
+
+					auto entity = scene.createEntity(archetype);
+					entities.push_back(entity);
+					context.entities.push_back(entity->Id);
+
+					uint32_t name[2];
+					std::memcpy(name, names + i * sizeof(name), sizeof(name));
+					if (name[1] > 0)
+					{
+						entity->setName(context.getString(name[0], name[1]));
+						scene._entitiesByName.emplace(entity->getName(), entity->Id);
+					}
+
+					// Already in the right archetype, so only the registry is told.
+					entity->_tags = tagMask;
+					for (auto bits = tagMask.to_ullong(); bits != 0; bits &= bits - 1)
+					{
+						scene._tagRegistry.add((uint32_t)std::countr_zero(bits), *entity);
+					}
+				}
+				// Archetypes that only differ in tags share their column layout.
+				block.archetype = archetype;
+
+				size_t fieldsSize = 0;
+				for (const auto index : block.components)
+				{
+					for (const auto& field : components[index].fields)
+					{
+						fieldsSize += (size_t)field.size * block.count;
+					}
+				}
+				block.fields = reader.take(fieldsSize);
+			}
+
+			// Then copy the packed field arrays into the component columns.
+			for (const auto& block : blocks)
+			{
+				const auto* source = block.fields;
+				for (const auto index : block.components)
+				{
+					const auto& loaded = components[index];
+					const auto column = loaded.component != nullptr && block.archetype != nullptr
+						? block.archetype->getColumnIndex(loaded.component->type->index)
+						: -1;
+
+					for (const auto& field : loaded.fields)
+					{
+						if (field.field != nullptr && column >= 0)
+						{
+							for (uint32_t i = 0; i < block.count; ++i)
+							{
+								const auto entity = entities[block.firstEntity + i];
+								field.field->read(
+									entity->getLocation().archetype->getComponent(entity->getLocation().row, (size_t)column),
+									source + (size_t)field.size * i,
+									context);
+							}
+						}
+
+						source += (size_t)field.size * block.count;
+					}
+				}
+			}
+		}
+		catch (...)
+		{
+			for (const auto entity : entities)
+			{
+				scene.removeEntity(entity->Id);
+			}
+			throw;
+		}
+	}
+
+	void SceneSerializer::loadFromFile(Scene& scene, const std::string& path) const
+	{
+		std::ifstream file(path, std::ios::binary | std::ios::ate);
+		if (!file)
+		{
+			throw std::runtime_error(std::format("Failed to open scene {}", path));
+		}
+
+		std::vector<std::byte> data((size_t)file.tellg());
+		file.seekg(0);
+		file.read(reinterpret_cast<char*>(data.data()), (std::streamsize)data.size());
+		if (!file)
+		{
+			throw std::runtime_error(std::format("Failed to read scene {}", path));
+		}
+
+		load(scene, data);
+	}
+
+	static JsonNode* addJsonNode(JsonNode& parent, JsonNode::Type type, const std::string& name, const std::string& content = {})
+	{
+		auto node = new JsonNode();
+		node->type = type;
+		node->name = name;
+		node->content = content;
+		node->parent = &parent;
+		parent.children.push_back(node);
+		return node;
+	}
+
+	static JsonNode::Type jsonType(SerializedFieldType type)
+	{
+		switch (type)
+		{
+		case SerializedFieldType::Int32:
+		case SerializedFieldType::UInt32:
+		case SerializedFieldType::Entity:
+			return JsonNode::Type::ValueInteger;
+		case SerializedFieldType::Float:
+			return JsonNode::Type::ValueNumber;
+		case SerializedFieldType::Bool:
+			return JsonNode::Type::ValueBoolean;
+		default:
+			return JsonNode::Type::ValueString;
+		}
+	}
+
+	std::string SceneSerializer::toJson(const Scene& scene) const
+	{
+		JsonDocument document;
+		document.m_Root = new JsonNode();
+		document.m_Root->type = JsonNode::Type::Object;
+
+		addJsonNode(*document.m_Root, JsonNode::Type::ValueInteger, "version", std::format("{}", Version));
+		auto entities = addJsonNode(*document.m_Root, JsonNode::Type::Array, "entities");
+
+		const auto& tagRegistry = scene._tagRegistry;
+		for (const auto& entity : scene.getEntities())
+		{
+			auto node = addJsonNode(*entities, JsonNode::Type::Object, "");
+			addJsonNode(*node, JsonNode::Type::ValueInteger, "id", std::format("{}", entity->Id));
+			if (!entity->getName().empty())
+			{
+				addJsonNode(*node, JsonNode::Type::ValueString, "name", entity->getName());
+			}
+
+			std::string tags;
+			for (uint32_t tag = 0; tag < (uint32_t)tagRegistry.getTagCount(); ++tag)
+			{
+				if (entity->HasTagIndex(tag))
+				{
+					if (!tags.empty())
+					{
+						tags += ", ";
+					}
+					tags += std::format("{:#010x}", tagRegistry.getHash(tag));
+				}
+			}
+			addJsonNode(*node, JsonNode::Type::ValueString, "tags", tags);
+
+			const auto& location = entity->getLocation();
+			for (const auto& component : _components)
+			{
+				const auto column = location.archetype->getColumnIndex(component->type->index);
+				if (column < 0)
+				{
+					continue;
+				}
+
+				const auto data = location.archetype->getComponent(location.row, (size_t)column);
+				auto componentNode = addJsonNode(*node, JsonNode::Type::Object, component->name);
+				for (const auto& field : component->fields)
+				{
+					addJsonNode(*componentNode, jsonType(field.type), field.name, field.toString(data));
+				}
+			}
+		}
+
+		return document.dump();
+	}
+
+	const SerializedComponent* SceneSerializer::findComponent(const std::string& name) const
+	{
+		for (const auto& component : _components)
+		{
+			if (component->name == name)
+			{
+				return component.get();
+			}
+		}
+
+		return nullptr;
+	}
+}
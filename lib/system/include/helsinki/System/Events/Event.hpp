@@ -1,5 +1,8 @@
 #pragma once
 
+#include <cstddef>
+#include <new>
+
 namespace hl
 {
 
@@ -11,11 +14,20 @@ namespace hl
         virtual const char* GetType() const = 0;
 
         virtual Event* Clone() const = 0;
+
+        // Copy constructs the event into memory of at least GetSize() bytes
+        // aligned to GetAlignment(), used to queue events without allocating.
+        virtual Event* CloneInto(void* memory) const = 0;
+        virtual std::size_t GetSize() const = 0;
+        virtual std::size_t GetAlignment() const = 0;
     };
 
 #define DEFINE_EVENT_TYPE(type) \
     static const char* GetStaticType() { return #type; } \
     virtual const char* GetType() const override { return GetStaticType(); } \
-    virtual Event* Clone() const override { return new type(*this); }
+    virtual Event* Clone() const override { return new type(*this); } \
+    virtual Event* CloneInto(void* memory) const override { return new (memory) type(*this); } \
+    virtual std::size_t GetSize() const override { return sizeof(type); } \
+    virtual std::size_t GetAlignment() const override { return alignof(type); }
 
-}
\ No newline at end of file
+}
@@ -1,21 +1,61 @@
 #pragma once
 
 #include <helsinki/System/Events/Event.hpp>
+#include <helsinki/System/Events/EventChannel.hpp>
+#include <helsinki/System/Events/EventCoalescer.hpp>
 #include <helsinki/System/Events/EventListener.hpp>
+#include <helsinki/System/Events/EventPhase.hpp>
+#include <helsinki/System/Events/EventQueue.hpp>
+#include <helsinki/System/Events/EventRecorder.hpp>
+#include <helsinki/System/Events/EventSubscription.hpp>
+#include <algorithm>
+#include <array>
 #include <vector>
 #include <memory>
-#include <queue>
-#include <mutex>
+#include <optional>
+#include <type_traits>
 
 namespace hl
 {
 
+    template<typename T>
+    struct EventHandlerTraits;
+
+    template<typename C, typename T>
+    struct EventHandlerTraits<void (C::*)(const T&)>
+    {
+        using Class = C;
+        using EventType = T;
+    };
+
+    // Carries two kinds of events. Typed events are any copyable type, sent
+    // with Publish<T> only to the subscribers of that type. Events deriving
+    // from hl::Event are sent with PublishEvent to every EventListener, which
+    // then has to work out whether it cares about them. Listeners are kept in
+    // the channel for Event itself, so both kinds share one dispatch path.
+    //
+    // When not in immediate mode both kinds are copied into an EventQueue,
+    // which any thread can publish to without taking a lock, and dispatched
+    // from ProcessEvents.
+    //
+    // An event type given a phase with SetPhase<T> is always queued, in
+    // immediate mode too, and dispatched along with the rest of that phase
+    // when the engine processes it. Anything else queued belongs to
+    // EndOfFrame.
+    //
+    // Event types can opt in to being coalesced with Coalesce<T>, after which
+    // their events are merged as EventCoalescing<T> describes and only what is
+    // left is dispatched, at the end of their phase in either mode.
     class EventBus
     {
     private:
-        std::vector<EventListener*> listeners;
-        std::queue<std::unique_ptr<Event>> eventQueue;
-        std::mutex queueMutex;
+        std::vector<std::unique_ptr<EventChannelBase>> channels;
+        std::vector<std::unique_ptr<EventCoalescerBase>> coalescers;
+        std::vector<std::optional<EventPhase>> phases;
+        std::array<EventPhaseTiming, EventPhaseCount> phaseTimings;
+        // After the channels and coalescers, so queued events are destroyed first.
+        std::array<EventQueue, EventPhaseCount> queues;
+        EventRecorder* recorder = nullptr;
         bool immediateMode = true;
 
     public:
@@ -24,62 +64,366 @@ namespace hl
             immediateMode = immediate;
         }
 
-        void AddListener(EventListener* listener)
+        // Every recordable event published through Publish<T>, or through
+        // PublishEvent with its type known, is passed to the recorder first.
+        // Null stops recording.
+        void SetRecorder(EventRecorder* eventRecorder)
         {
-            listeners.push_back(listener);
+            recorder = eventRecorder;
         }
 
-        void RemoveListener(EventListener* listener)
+        // Subscribes a member function taking the event, e.g.
+        // Subscribe<&CollisionResolutionSystem::OnCollision>(this). Higher
+        // priorities are called first. Subscribe and unsubscribe from the
+        // thread that processes the events.
+        template<auto Handler>
+        void Subscribe(typename EventHandlerTraits<decltype(Handler)>::Class* instance, int32_t priority = 0)
+        {
+            using Traits = EventHandlerTraits<decltype(Handler)>;
+            GetChannel<typename Traits::EventType>().Subscribe(instance, &Invoke<Handler>, priority);
+        }
+
+        template<auto Handler>
+        void Unsubscribe(typename EventHandlerTraits<decltype(Handler)>::Class* instance)
+        {
+            using Traits = EventHandlerTraits<decltype(Handler)>;
+            GetChannel<typename Traits::EventType>().Unsubscribe(instance, &Invoke<Handler>);
+        }
+
+        // As Subscribe, unsubscribing when the returned handle goes.
+        template<auto Handler>
+        [[nodiscard]] EventSubscription SubscribeScoped(typename EventHandlerTraits<decltype(Handler)>::Class* instance, int32_t priority = 0)
+        {
+            using Class = typename EventHandlerTraits<decltype(Handler)>::Class;
+            Subscribe<Handler>(instance, priority);
+            return EventSubscription(*this,
+                [](EventBus& bus, void* subscribed) { bus.Unsubscribe<Handler>(static_cast<Class*>(subscribed)); },
+                instance);
+        }
+
+        template<typename T>
+        void Subscribe(void* instance, typename EventChannel<T>::Handler handler, int32_t priority = 0)
+        {
+            GetChannel<T>().Subscribe(instance, handler, priority);
+        }
+
+        template<typename T>
+        void Unsubscribe(void* instance, typename EventChannel<T>::Handler handler)
+        {
+            GetChannel<T>().Unsubscribe(instance, handler);
+        }
+
+        // Events of a type nobody has subscribed to are dropped straight away,
+        // in queued mode as well.
+        template<typename T>
+        void Publish(const T& event)
         {
-            auto it = std::find(listeners.begin(), listeners.end(), listener);
-            if (it != listeners.end())
+            if constexpr (RecordableEvent<T>)
+            {
+                if (recorder != nullptr)
+                {
+                    recorder->Record(event);
+                }
+            }
+
+            const auto index = EventTypeIndex::Get<T>();
+            if (index >= channels.size() || channels[index] == nullptr)
+            {
+                return;
+            }
+
+            const std::optional<EventPhase> phase = GetPhaseAt(index);
+
+            if constexpr (CoalescableEvent<T>)
+            {
+                if (auto coalescer = GetCoalescer<T>())
+                {
+                    AddCoalesced(*coalescer, event, phase);
+                    return;
+                }
+            }
+
+            auto& channel = static_cast<EventChannel<T>&>(*channels[index]);
+            if (immediateMode && !phase.has_value())
+            {
+                channel.Dispatch(event);
+            }
+            else
             {
-                listeners.erase(it);
+                GetQueue(phase).Push<T>(&DispatchQueued<T>, &channel, event);
             }
         }
 
+        template<typename T>
+        void SetPhase(EventPhase phase)
+        {
+            const auto index = EventTypeIndex::Get<T>();
+            if (index >= phases.size())
+            {
+                phases.resize(index + 1);
+            }
+
+            phases[index] = phase;
+        }
+
+        template<typename T>
+        std::optional<EventPhase> GetPhase() const
+        {
+            return GetPhaseAt(EventTypeIndex::Get<T>());
+        }
+
+        template<typename T>
+        EventChannel<T>& GetChannel()
+        {
+            const auto index = EventTypeIndex::Get<T>();
+            if (index >= channels.size())
+            {
+                channels.resize(index + 1);
+            }
+
+            auto& channel = channels[index];
+            if (channel == nullptr)
+            {
+                channel = std::make_unique<EventChannel<T>>();
+            }
+
+            return static_cast<EventChannel<T>&>(*channel);
+        }
+
+        // Holds back events of type T until their phase is processed and
+        // merges them by key first. Types deriving from Event are then broadcast to the
+        // listeners, but only when published through the PublishEvent overload
+        // that knows their type.
+        template<CoalescableEvent T>
+        void Coalesce()
+        {
+            const auto index = EventTypeIndex::Get<T>();
+            if (index >= coalescers.size())
+            {
+                coalescers.resize(index + 1);
+            }
+
+            auto& coalescer = coalescers[index];
+            if (coalescer != nullptr)
+            {
+                return;
+            }
+
+            if constexpr (std::is_base_of_v<Event, T>)
+            {
+                coalescer = std::make_unique<EventCoalescer<T>>(
+                    [](void* bus, const T& event) { static_cast<EventBus*>(bus)->Broadcast(event); },
+                    this);
+            }
+            else
+            {
+                coalescer = std::make_unique<EventCoalescer<T>>(
+                    [](void* channel, const T& event) { static_cast<EventChannel<T>*>(channel)->Dispatch(event); },
+                    &GetChannel<T>());
+            }
+        }
+
+        template<CoalescableEvent T>
+        EventCoalescer<T>* GetCoalescer()
+        {
+            const auto index = EventTypeIndex::Get<T>();
+            if (index >= coalescers.size() || coalescers[index] == nullptr)
+            {
+                return nullptr;
+            }
+
+            return static_cast<EventCoalescer<T>*>(coalescers[index].get());
+        }
+
+        // Higher priority listeners are sent events first, equal priorities
+        // in the order they were added.
+        // Like typed subscribers they can be added and removed while events
+        // are being dispatched.
+        void AddListener(EventListener* listener, int32_t priority = 0)
+        {
+            GetChannel<Event>().Subscribe(listener, &InvokeListener, priority);
+        }
+
+        void RemoveListener(EventListener* listener)
+        {
+            GetChannel<Event>().Unsubscribe(listener, &InvokeListener);
+        }
+
+        // As AddListener, removing the listener when the returned handle goes.
+        [[nodiscard]] EventSubscription AddScopedListener(EventListener* listener, int32_t priority = 0)
+        {
+            AddListener(listener, priority);
+            return EventSubscription(*this,
+                [](EventBus& bus, void* added) { bus.RemoveListener(static_cast<EventListener*>(added)); },
+                listener);
+        }
+
         void PublishEvent(const Event& event)
         {
             if (immediateMode)
             {
-                for (auto listener : listeners)
+                Broadcast(event);
+            }
+            else
+            {
+                QueueEvent(event, std::nullopt);
+            }
+        }
+
+        // Knowing the type lets the event be recorded, coalesced or given a
+        // phase.
+        template<typename T>
+            requires std::is_base_of_v<Event, T>
+        void PublishEvent(const T& event)
+        {
+            if constexpr (RecordableEvent<T>)
+            {
+                if (recorder != nullptr)
                 {
-                    listener->OnEvent(event);
+                    recorder->Record(event);
                 }
             }
+
+            const std::optional<EventPhase> phase = GetPhaseAt(EventTypeIndex::Get<T>());
+
+            if constexpr (CoalescableEvent<T>)
+            {
+                if (auto coalescer = GetCoalescer<T>())
+                {
+                    AddCoalesced(*coalescer, event, phase);
+                    return;
+                }
+            }
+
+            if (phase.has_value())
+            {
+                QueueEvent(event, phase);
+            }
             else
             {
-                std::lock_guard<std::mutex> lock(queueMutex);
-                eventQueue.push(std::unique_ptr<Event>(event.Clone()));
+                PublishEvent(static_cast<const Event&>(event));
+            }
+        }
+
+        // Dispatches the events queued for the phase, then the coalesced
+        // events that belong to it. Events from any one thread are dispatched
+        // in the order they were published, typed and broadcast events alike.
+        // Events published while processing wait for the next call, unless
+        // they belong to a later phase.
+        void ProcessEvents(EventPhase phase);
+
+        // Processes every phase in order.
+        void ProcessEvents();
+
+        // How long each phase took the last time it was processed.
+        const EventPhaseTiming& GetPhaseTiming(EventPhase phase) const
+        {
+            return phaseTimings[(size_t)phase];
+        }
+
+    private:
+        void Broadcast(const Event& event)
+        {
+            const auto index = EventTypeIndex::Get<Event>();
+            if (index < channels.size() && channels[index] != nullptr)
+            {
+                static_cast<EventChannel<Event>&>(*channels[index]).Dispatch(event);
             }
         }
 
-        void ProcessEvents()
+        std::optional<EventPhase> GetPhaseAt(uint32_t index) const
+        {
+            return index < phases.size() ? phases[index] : std::nullopt;
+        }
+
+        EventQueue& GetQueue(std::optional<EventPhase> phase)
+        {
+            return queues[(size_t)phase.value_or(EventPhase::EndOfFrame)];
+        }
+
+        void QueueEvent(const Event& event, std::optional<EventPhase> phase)
+        {
+            // The copy's Event pointer goes first, it may not be at the start
+            // of the copy once cast down from the derived type.
+            const auto alignment = std::max(alignof(Event*), event.GetAlignment());
+            const auto eventOffset = (sizeof(Event*) + event.GetAlignment() - 1) & ~(event.GetAlignment() - 1);
+            GetQueue(phase).Push(&BroadcastQueued, this, eventOffset + event.GetSize(), alignment,
+                [&](std::byte* memory)
+                {
+                    *reinterpret_cast<Event**>(memory) = event.CloneInto(memory + eventOffset);
+                });
+        }
+
+        template<CoalescableEvent T>
+        void AddCoalesced(EventCoalescer<T>& coalescer, const T& event, std::optional<EventPhase> phase)
         {
             if (immediateMode)
             {
-                return;
+                coalescer.Add(event);
             }
+            else
+            {
+                GetQueue(phase).Push<T>(&CoalesceQueued<T>, &coalescer, event);
+            }
+        }
 
-            std::queue<std::unique_ptr<Event>> currentEvents;
+        template<CoalescableEvent T>
+        static void CoalesceQueued(void* bus, void* coalescer, std::byte* memory)
+        {
+            auto event = std::launder(reinterpret_cast<T*>(memory));
+            struct Destroy
+            {
+                T* event;
+                ~Destroy() { event->~T(); }
+            } destroy{ event };
 
+            if (bus != nullptr)
             {
-                std::lock_guard<std::mutex> lock(queueMutex);
-                std::swap(currentEvents, eventQueue);
+                static_cast<EventCoalescer<T>*>(coalescer)->Add(*event);
             }
+        }
 
-            while (!currentEvents.empty())
+        template<typename T>
+        static void DispatchQueued(void* bus, void* channel, std::byte* memory)
+        {
+            auto event = std::launder(reinterpret_cast<T*>(memory));
+            struct Destroy
             {
-                auto& event = *currentEvents.front();
+                T* event;
+                ~Destroy() { event->~T(); }
+            } destroy{ event };
 
-                for (auto listener : listeners)
-                {
-                    listener->OnEvent(event);
-                }
+            if (bus != nullptr)
+            {
+                static_cast<EventChannel<T>*>(channel)->Dispatch(*event);
+            }
+        }
+
+        static void BroadcastQueued(void* bus, void*, std::byte* memory)
+        {
+            auto event = *reinterpret_cast<Event**>(memory);
+            struct Destroy
+            {
+                Event* event;
+                ~Destroy() { event->~Event(); }
+            } destroy{ event };
 
-                currentEvents.pop();
+            if (bus != nullptr)
+            {
+                static_cast<EventBus*>(bus)->Broadcast(*event);
             }
         }
+
+        static void InvokeListener(void* listener, const Event& event)
+        {
+            static_cast<EventListener*>(listener)->OnEvent(event);
+        }
+
+        template<auto Handler>
+        static void Invoke(void* instance, const typename EventHandlerTraits<decltype(Handler)>::EventType& event)
+        {
+            (static_cast<typename EventHandlerTraits<decltype(Handler)>::Class*>(instance)->*Handler)(event);
+        }
     };
 
-}
\ No newline at end of file
+}
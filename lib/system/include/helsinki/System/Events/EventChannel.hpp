@@ -0,0 +1,151 @@
+#pragma once
+
+#include <helsinki/System/Utils/TypeId.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace hl
+{
+
+    // Dense index for each event type, handed out the first time the type is
+    // used with an EventBus. Only meaningful within a process.
+    class EventTypeIndex
+    {
+    public:
+        template<typename T>
+        static uint32_t Get()
+        {
+            static const uint32_t index = RegisterType(TypeId::Get<T>(), TypeId::Name<T>());
+            return index;
+        }
+
+    private:
+        static uint32_t RegisterType(uint64_t typeId, std::string_view name);
+    };
+
+    class EventChannelBase
+    {
+    public:
+        virtual ~EventChannelBase() = default;
+    };
+
+    // Subscribers to a single event type. Each is a plain function pointer and
+    // instance pair, so dispatching neither allocates nor needs any casting.
+    // Higher priority subscribers are called first, equal priorities in the
+    // order they subscribed.
+    template<typename T>
+    class EventChannel : public EventChannelBase
+    {
+    public:
+        using Handler = void (*)(void* instance, const T& event);
+
+        void Subscribe(void* instance, Handler handler, int32_t priority = 0)
+        {
+            const Subscriber subscriber{ instance, handler, priority };
+            if (dispatchDepth > 0)
+            {
+                // Inserting would shift the ones Dispatch has yet to call, so
+                // sorted once it is done instead.
+                subscribers.push_back(subscriber);
+                unsorted = true;
+                return;
+            }
+
+            const auto position = std::upper_bound(subscribers.begin(), subscribers.end(), priority,
+                [](int32_t value, const Subscriber& other) { return value > other.priority; });
+            subscribers.insert(position, subscriber);
+        }
+
+        void Unsubscribe(void* instance, Handler handler)
+        {
+            for (auto& subscriber : subscribers)
+            {
+                if (subscriber.instance == instance && subscriber.handler == handler)
+                {
+                    // Cleared rather than erased while dispatching so the loop
+                    // in Dispatch stays valid.
+                    subscriber.handler = nullptr;
+                    removedSubscribers = true;
+                    break;
+                }
+            }
+
+            if (dispatchDepth == 0)
+            {
+                RemoveUnsubscribed();
+            }
+        }
+
+        size_t GetSubscriberCount() const
+        {
+            size_t count = 0;
+            for (const auto& subscriber : subscribers)
+            {
+                count += subscriber.handler != nullptr ? 1 : 0;
+            }
+            return count;
+        }
+
+        void Dispatch(const T& event)
+        {
+            ++dispatchDepth;
+
+            // Subscribing from a handler may grow the vector, so no iterators.
+            for (size_t i = 0; i < subscribers.size(); ++i)
+            {
+                const auto subscriber = subscribers[i];
+                if (subscriber.handler != nullptr)
+                {
+                    subscriber.handler(subscriber.instance, event);
+                }
+            }
+
+            if (--dispatchDepth == 0)
+            {
+                RemoveUnsubscribed();
+                SortSubscribers();
+            }
+        }
+
+    private:
+        struct Subscriber
+        {
+            void* instance;
+            Handler handler;
+            int32_t priority;
+        };
+
+        void RemoveUnsubscribed()
+        {
+            if (!removedSubscribers)
+            {
+                return;
+            }
+
+            std::erase_if(subscribers, [](const Subscriber& subscriber) { return subscriber.handler == nullptr; });
+            removedSubscribers = false;
+        }
+
+        void SortSubscribers()
+        {
+            if (!unsorted)
+            {
+                return;
+            }
+
+            std::stable_sort(subscribers.begin(), subscribers.end(),
+                [](const Subscriber& a, const Subscriber& b) { return a.priority > b.priority; });
+            unsorted = false;
+        }
+
+    private:
+        std::vector<Subscriber> subscribers;
+        uint32_t dispatchDepth = 0;
+        bool removedSubscribers = false;
+        bool unsorted = false;
+    };
+
+}
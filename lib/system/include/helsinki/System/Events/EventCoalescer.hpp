@@ -0,0 +1,162 @@
+#pragma once
+
+#include <concepts>
+#include <cstdint>
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace hl
+{
+
+    enum class EventMergePolicy
+    {
+        // Only the most recent event with a key is dispatched.
+        LastWins,
+        // Events with the same key are added together with operator+=.
+        Sum,
+        // Only the first event with a key is dispatched, repeats are dropped.
+        UniqueSet
+    };
+
+    // Specialise for an event type to let EventBus::Coalesce<T> merge its
+    // events, e.g.
+    //
+    //  template<>
+    //  struct EventCoalescing<CollisionEvent>
+    //  {
+    //      static constexpr EventMergePolicy Policy = EventMergePolicy::UniqueSet;
+    //      static uint64_t Key(const CollisionEvent& event) { ... }
+    //  };
+    template<typename T>
+    struct EventCoalescing;
+
+    template<typename T>
+    concept CoalescableEvent = requires(const T& event)
+    {
+        { EventCoalescing<T>::Policy } -> std::convertible_to<EventMergePolicy>;
+        { EventCoalescing<T>::Key(event) } -> std::convertible_to<uint64_t>;
+    };
+
+    class EventCoalescerBase
+    {
+    public:
+        virtual ~EventCoalescerBase() = default;
+
+        // Returns how many events were dispatched.
+        virtual size_t Flush() = 0;
+    };
+
+    // Merges the events of one type published between flushes, then
+    // dispatches what is left in the order their keys were first seen.
+    template<CoalescableEvent T>
+    class EventCoalescer : public EventCoalescerBase
+    {
+    public:
+        using Traits = EventCoalescing<T>;
+        using Dispatch = void (*)(void* target, const T& event);
+
+        EventCoalescer(Dispatch dispatch, void* target) :
+            dispatch(dispatch),
+            target(target)
+        {
+        }
+
+        void Add(const T& event)
+        {
+            // Grown before it is half full, so probing always finds a gap.
+            if ((pending.size() + 1) * 2 > slots.size())
+            {
+                Grow();
+            }
+
+            auto& slot = Find(Traits::Key(event));
+            if (slot.index == EmptySlot)
+            {
+                slot.key = Traits::Key(event);
+                slot.index = (uint32_t)pending.size();
+                pending.push_back(event);
+                return;
+            }
+
+            if constexpr (Traits::Policy == EventMergePolicy::LastWins)
+            {
+                pending[slot.index] = event;
+            }
+            else if constexpr (Traits::Policy == EventMergePolicy::Sum)
+            {
+                pending[slot.index] += event;
+            }
+        }
+
+        size_t GetPendingCount() const
+        {
+            return pending.size();
+        }
+
+        // Events added while flushing are kept for the next flush.
+        size_t Flush() override
+        {
+            if (pending.empty())
+            {
+                return 0;
+            }
+
+            flushing.clear();
+            std::swap(pending, flushing);
+            // Emptied rather than freed, so a steady stream of events stops
+            // allocating once the table has grown to fit it.
+            std::fill(slots.begin(), slots.end(), Slot{});
+
+            for (const auto& event : flushing)
+            {
+                dispatch(target, event);
+            }
+
+            return flushing.size();
+        }
+
+    private:
+        static constexpr uint32_t EmptySlot = std::numeric_limits<uint32_t>::max();
+
+        // An open addressed key to pending index table, probed linearly.
+        struct Slot
+        {
+            uint64_t key{ 0 };
+            uint32_t index{ EmptySlot };
+        };
+
+        Slot& Find(uint64_t key)
+        {
+            // Fibonacci hashing spreads keys packed from small ids.
+            const auto mask = slots.size() - 1;
+            auto i = (size_t)((key * 0x9E3779B97F4A7C15ull) >> 32) & mask;
+            while (slots[i].index != EmptySlot && slots[i].key != key)
+            {
+                i = (i + 1) & mask;
+            }
+            return slots[i];
+        }
+
+        void Grow()
+        {
+            const auto previous = std::move(slots);
+            slots.assign(std::max<size_t>(previous.size() * 2, 16), Slot{});
+            for (const auto& slot : previous)
+            {
+                if (slot.index != EmptySlot)
+                {
+                    Find(slot.key) = slot;
+                }
+            }
+        }
+
+        Dispatch dispatch;
+        void* target;
+        std::vector<Slot> slots;
+        std::vector<T> pending;
+        std::vector<T> flushing;
+    };
+
+}
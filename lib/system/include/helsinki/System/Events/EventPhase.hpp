@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace hl
+{
+
+    // Points in the frame where the engine dispatches the events queued for
+    // them, in this order.
+    enum class EventPhase : uint8_t
+    {
+        // Before the frame's fixed updates run.
+        PreUpdate,
+        // After the fixed updates, once everything has moved and collided.
+        PostPhysics,
+        // Last thing before drawing.
+        EndOfFrame
+    };
+
+    static constexpr size_t EventPhaseCount = 3;
+
+    constexpr const char* GetEventPhaseName(EventPhase phase)
+    {
+        switch (phase)
+        {
+        case EventPhase::PreUpdate: return "PreUpdate";
+        case EventPhase::PostPhysics: return "PostPhysics";
+        case EventPhase::EndOfFrame: return "EndOfFrame";
+        }
+        return "Unknown";
+    }
+
+    struct EventPhaseTiming
+    {
+        // Events taken from the phase's queue plus coalesced events dispatched.
+        size_t eventCount{ 0 };
+        double milliseconds{ 0.0 };
+    };
+
+}
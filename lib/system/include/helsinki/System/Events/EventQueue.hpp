@@ -0,0 +1,91 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+
+namespace hl
+{
+
+    struct EventQueueBlock;
+    struct EventQueueProducer;
+
+    // Queue of type erased events for the EventBus's deferred mode, published
+    // to from any number of threads and drained by one.
+    //
+    // Each publishing thread gets its own staging buffer, a chain of blocks
+    // that events are constructed in place in, so publishing is a bump
+    // allocation and a release store with no locks and nothing shared between
+    // threads. Drain walks the buffers in the order the threads first published
+    // to the queue, so events from any one thread come out in the order they
+    // were published. Drained blocks are handed back to their thread to reuse.
+    //
+    // A thread's buffer lives as long as the queue, so short lived threads
+    // should not publish to a long lived queue. Each thread finds its buffer
+    // through a list of the queues it has published to. A queue takes itself
+    // off the destroying thread's list, and other threads drop destroyed
+    // queues from theirs when they next publish to a queue not on it.
+    class EventQueue
+    {
+    public:
+        // Called from Drain with its context to dispatch an event, or with a
+        // null context when the queue is destroyed with the event still in it.
+        // Either way it has to destroy the event.
+        using Process = void (*)(void* context, void* target, std::byte* event);
+
+        static constexpr uint32_t BlockSize = 16 * 1024;
+
+        EventQueue();
+        ~EventQueue();
+
+        EventQueue(const EventQueue&) = delete;
+        EventQueue& operator=(const EventQueue&) = delete;
+
+        template<typename T>
+        void Push(Process process, void* target, const T& event)
+        {
+            Push(process, target, sizeof(T), alignof(T), [&](std::byte* memory) { new (memory) T(event); });
+        }
+
+        // Reserves size bytes with the given alignment for construct to build
+        // the event in.
+        template<typename F>
+        void Push(Process process, void* target, size_t size, size_t alignment, F&& construct)
+        {
+            auto& producer = GetProducer();
+            construct(Reserve(producer, process, target, size, alignment));
+            Commit(producer);
+        }
+
+        // Processes everything published before the call, anything published
+        // while draining waits for the next call. Calls made from inside a
+        // Process callback do nothing. Returns how many events were processed.
+        size_t Drain(void* context);
+
+        size_t GetProducerCount() const;
+        // How many queues the calling thread has a buffer listed for.
+        static size_t GetThreadQueueCount();
+
+    private:
+        EventQueueProducer& GetProducer();
+        EventQueueProducer& RegisterProducer();
+        static void PruneThreadProducers();
+
+        static std::byte* Reserve(EventQueueProducer& producer, Process process, void* target, size_t size, size_t alignment);
+        static void Commit(EventQueueProducer& producer);
+        static void NextBlock(EventQueueProducer& producer, uint32_t minimumCapacity);
+        static void ReturnBlock(EventQueueProducer& producer, EventQueueBlock* block);
+        static size_t DrainProducer(EventQueueProducer& producer, void* context);
+
+    private:
+        const uint64_t id;
+        mutable std::mutex producersMutex;
+        std::atomic<EventQueueProducer*> firstProducer{ nullptr };
+        EventQueueProducer* lastProducer{ nullptr };
+        size_t producerCount{ 0 };
+        bool draining{ false };
+    };
+
+}
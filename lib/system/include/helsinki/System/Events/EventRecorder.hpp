@@ -0,0 +1,80 @@
+#pragma once
+
+#include <helsinki/System/Events/EventChannel.hpp>
+#include <helsinki/System/Events/EventRecording.hpp>
+#include <helsinki/System/Utils/TypeId.hpp>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace hl
+{
+
+    // Captures the events an EventBus publishes into an EventRecording. Set it
+    // on the bus with EventBus::SetRecorder, the engine then marks where each
+    // fixed update and frame begins and ends.
+    class EventRecorder
+    {
+    public:
+        // Events recorded from now on are stamped with this update.
+        void BeginUpdate(uint64_t update)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            currentUpdate = update;
+            updatesInFrame++;
+        }
+
+        void EndFrame()
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            recording.AddFrame(updatesInFrame);
+            updatesInFrame = 0;
+        }
+
+        template<RecordableEvent T>
+        void Record(const T& event)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+
+            auto& payload = recording.GetPayload();
+            const auto offset = (uint32_t)payload.size();
+            EventRecordWriter writer(payload);
+            WriteRecordedEvent(writer, event);
+            recording.AddRecord(currentUpdate, GetRecordedType<T>(), offset);
+        }
+
+        const EventRecording& GetRecording() const
+        {
+            return recording;
+        }
+
+    private:
+        static constexpr uint32_t NoType = UINT32_MAX;
+
+        template<typename T>
+        uint32_t GetRecordedType()
+        {
+            const auto index = EventTypeIndex::Get<T>();
+            if (index >= recordedTypes.size())
+            {
+                recordedTypes.resize(index + 1, NoType);
+            }
+
+            if (recordedTypes[index] == NoType)
+            {
+                recordedTypes[index] = recording.AddType(TypeId::Name<T>());
+            }
+
+            return recordedTypes[index];
+        }
+
+    private:
+        std::mutex mutex;
+        EventRecording recording;
+        // Recording type index by EventTypeIndex.
+        std::vector<uint32_t> recordedTypes;
+        uint64_t currentUpdate{ 0 };
+        uint32_t updatesInFrame{ 0 };
+    };
+
+}
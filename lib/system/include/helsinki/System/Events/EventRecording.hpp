@@ -0,0 +1,159 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <concepts>
+#include <cstring>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace hl
+{
+
+    class EventRecordWriter
+    {
+    public:
+        explicit EventRecordWriter(std::vector<std::byte>& data) : data(data) {}
+
+        template<typename T>
+            requires std::is_trivially_copyable_v<T>
+        void Write(const T& value)
+        {
+            const auto offset = data.size();
+            data.resize(offset + sizeof(T));
+            std::memcpy(data.data() + offset, &value, sizeof(T));
+        }
+
+    private:
+        std::vector<std::byte>& data;
+    };
+
+    // Bounds checked reads from recorded data, which may be unaligned.
+    class EventRecordReader
+    {
+    public:
+        explicit EventRecordReader(std::span<const std::byte> data) : data(data) {}
+
+        template<typename T>
+            requires std::is_trivially_copyable_v<T>
+        T Read()
+        {
+            T value;
+            std::memcpy(&value, Take(sizeof(T)), sizeof(T));
+            return value;
+        }
+
+        const std::byte* Take(size_t size);
+        uint64_t ReadVarint();
+
+        bool IsAtEnd() const { return offset == data.size(); }
+
+    private:
+        std::span<const std::byte> data;
+        size_t offset{ 0 };
+    };
+
+    // Specialise for an event type that cannot just be copied byte for byte,
+    // e.g. one deriving from Event, to record and replay it:
+    //
+    //  template<>
+    //  struct EventRecordTraits<KeyPressEvent>
+    //  {
+    //      static void Write(EventRecordWriter& writer, const KeyPressEvent& event) { ... }
+    //      static KeyPressEvent Read(EventRecordReader& reader) { ... }
+    //  };
+    template<typename T>
+    struct EventRecordTraits;
+
+    template<typename T>
+    concept HasEventRecordTraits = requires(EventRecordWriter& writer, EventRecordReader& reader, const T& event)
+    {
+        EventRecordTraits<T>::Write(writer, event);
+        { EventRecordTraits<T>::Read(reader) } -> std::same_as<T>;
+    };
+
+    // Plain trivially copyable events are recorded as their bytes, so only
+    // replay correctly in builds where their layout is the same.
+    template<typename T>
+    concept RecordableEvent = HasEventRecordTraits<T> ||
+        (std::is_trivially_copyable_v<T> && !std::is_polymorphic_v<T>);
+
+    template<RecordableEvent T>
+    void WriteRecordedEvent(EventRecordWriter& writer, const T& event)
+    {
+        if constexpr (HasEventRecordTraits<T>)
+        {
+            EventRecordTraits<T>::Write(writer, event);
+        }
+        else
+        {
+            writer.Write(event);
+        }
+    }
+
+    template<RecordableEvent T>
+    T ReadRecordedEvent(EventRecordReader& reader)
+    {
+        if constexpr (HasEventRecordTraits<T>)
+        {
+            return EventRecordTraits<T>::Read(reader);
+        }
+        else
+        {
+            return reader.Read<T>();
+        }
+    }
+
+    // Events published during a session, each with the fixed update it was
+    // published in, plus how many updates each rendered frame ran so a replay
+    // can group them the same way.
+    //
+    // Saved as, integers marked varint are LEB128 and the rest host byte order:
+    //
+    //   Header   "HLER", version, type, record and frame counts
+    //   Types    varint length and name of each recorded event type
+    //   Frames   varint update count of each frame
+    //   Records  varint update delta from the previous record, varint type
+    //            index, varint payload size, payload
+    class EventRecording
+    {
+    public:
+        static constexpr uint32_t Version = 1;
+
+        struct Record
+        {
+            uint64_t update;
+            uint32_t type;
+            uint32_t offset;
+            uint32_t size;
+        };
+
+        uint32_t AddType(std::string_view name);
+        // The payload is what the writer appended to GetPayload().
+        void AddRecord(uint64_t update, uint32_t type, uint32_t offset);
+        void AddFrame(uint32_t updateCount);
+
+        std::vector<std::byte>& GetPayload() { return payload; }
+        std::span<const std::byte> GetPayload(const Record& record) const;
+
+        const std::vector<std::string>& GetTypes() const { return types; }
+        const std::vector<Record>& GetRecords() const { return records; }
+        const std::vector<uint32_t>& GetFrames() const { return frames; }
+
+        std::vector<std::byte> Save() const;
+        void SaveToFile(const std::string& path) const;
+
+        static EventRecording Load(std::span<const std::byte> data);
+        static EventRecording LoadFromFile(const std::string& path);
+
+    private:
+        std::vector<std::string> types;
+        std::vector<Record> records;
+        std::vector<uint32_t> frames;
+        std::vector<std::byte> payload;
+    };
+
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <helsinki/System/Events/EventBus.hpp>
+#include <helsinki/System/Events/EventRecording.hpp>
+#include <helsinki/System/Utils/TypeId.hpp>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace hl
+{
+
+    // Publishes recorded events again, update by update. Only the types
+    // registered with it are replayed, usually input, the rest are recorded
+    // for reference and are expected to be published again by whatever
+    // published them the first time.
+    class EventReplayer
+    {
+    public:
+        EventReplayer(EventBus& bus, const EventRecording& recording) :
+            bus(bus),
+            recording(recording)
+        {
+        }
+
+        template<RecordableEvent T>
+        void Register()
+        {
+            publishers[std::string(TypeId::Name<T>())] = &Publish<T>;
+            publishersByType.clear();
+        }
+
+        // Publishes the registered events recorded in the update, skipping
+        // any from earlier updates that were not replayed.
+        void ReplayUpdate(uint64_t update)
+        {
+            if (publishersByType.empty())
+            {
+                ResolveTypes();
+            }
+
+            const auto& records = recording.GetRecords();
+            while (nextRecord < records.size() && records[nextRecord].update <= update)
+            {
+                const auto& record = records[nextRecord++];
+                const auto publisher = publishersByType[record.type];
+                if (record.update == update && publisher != nullptr)
+                {
+                    EventRecordReader reader(recording.GetPayload(record));
+                    publisher(bus, reader);
+                }
+            }
+        }
+
+        const std::vector<uint32_t>& GetFrames() const
+        {
+            return recording.GetFrames();
+        }
+
+        bool IsFinished() const
+        {
+            return nextRecord >= recording.GetRecords().size();
+        }
+
+    private:
+        using Publisher = void (*)(EventBus& bus, EventRecordReader& reader);
+
+        template<RecordableEvent T>
+        static void Publish(EventBus& bus, EventRecordReader& reader)
+        {
+            const auto event = ReadRecordedEvent<T>(reader);
+            if constexpr (std::is_base_of_v<Event, T>)
+            {
+                bus.PublishEvent(event);
+            }
+            else
+            {
+                bus.Publish(event);
+            }
+        }
+
+        void ResolveTypes()
+        {
+            const auto& types = recording.GetTypes();
+            publishersByType.resize(types.size(), nullptr);
+            for (size_t i = 0; i < types.size(); ++i)
+            {
+                if (auto it = publishers.find(types[i]); it != publishers.end())
+                {
+                    publishersByType[i] = it->second;
+                }
+            }
+        }
+
+    private:
+        EventBus& bus;
+        const EventRecording& recording;
+        std::unordered_map<std::string, Publisher> publishers;
+        std::vector<Publisher> publishersByType;
+        size_t nextRecord{ 0 };
+    };
+
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <utility>
+
+namespace hl
+{
+
+    class EventBus;
+
+    // Handle from EventBus::SubscribeScoped or EventBus::AddScopedListener
+    // that unsubscribes when it is destroyed or reset. Must not outlive the
+    // bus it came from.
+    class EventSubscription
+    {
+    public:
+        using Release = void (*)(EventBus& bus, void* instance);
+
+        EventSubscription() = default;
+
+        EventSubscription(EventBus& bus, Release release, void* instance) :
+            bus(&bus),
+            release(release),
+            instance(instance)
+        {
+        }
+
+        EventSubscription(const EventSubscription&) = delete;
+        EventSubscription& operator=(const EventSubscription&) = delete;
+
+        EventSubscription(EventSubscription&& other) noexcept :
+            bus(std::exchange(other.bus, nullptr)),
+            release(other.release),
+            instance(other.instance)
+        {
+        }
+
+        EventSubscription& operator=(EventSubscription&& other) noexcept
+        {
+            if (this != &other)
+            {
+                Reset();
+                bus = std::exchange(other.bus, nullptr);
+                release = other.release;
+                instance = other.instance;
+            }
+
+            return *this;
+        }
+
+        ~EventSubscription()
+        {
+            Reset();
+        }
+
+        void Reset()
+        {
+            if (bus != nullptr)
+            {
+                release(*std::exchange(bus, nullptr), instance);
+            }
+        }
+
+        bool IsActive() const
+        {
+            return bus != nullptr;
+        }
+
+    private:
+        EventBus* bus{ nullptr };
+        Release release{ nullptr };
+        void* instance{ nullptr };
+    };
+
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <helsinki/System/Events/Event.hpp>
+#include <helsinki/System/Events/EventRecording.hpp>
 
 namespace hl
 {
@@ -31,4 +32,18 @@ namespace hl
 		int _keyCode;
 	};
 
+	template<>
+	struct EventRecordTraits<KeyPressEvent>
+	{
+		static void Write(EventRecordWriter& writer, const KeyPressEvent& event) { writer.Write<int32_t>(event.GetKeyCode()); }
+		static KeyPressEvent Read(EventRecordReader& reader) { return KeyPressEvent(reader.Read<int32_t>()); }
+	};
+
+	template<>
+	struct EventRecordTraits<KeyReleaseEvent>
+	{
+		static void Write(EventRecordWriter& writer, const KeyReleaseEvent& event) { writer.Write<int32_t>(event.GetKeyCode()); }
+		static KeyReleaseEvent Read(EventRecordReader& reader) { return KeyReleaseEvent(reader.Read<int32_t>()); }
+	};
+
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <helsinki/System/Events/Event.hpp>
+#include <helsinki/System/Events/EventRecording.hpp>
 
 namespace hl
 {
@@ -20,4 +21,20 @@ namespace hl
 		int _y;
 	};
 
+	template<>
+	struct EventRecordTraits<ScrollEvent>
+	{
+		static void Write(EventRecordWriter& writer, const ScrollEvent& event)
+		{
+			writer.Write<int32_t>(event.getX());
+			writer.Write<int32_t>(event.getY());
+		}
+		static ScrollEvent Read(EventRecordReader& reader)
+		{
+			const auto x = reader.Read<int32_t>();
+			const auto y = reader.Read<int32_t>();
+			return ScrollEvent(x, y);
+		}
+	};
+
 }
\ No newline at end of file
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <helsinki/System/Events/Event.hpp>
+#include <helsinki/System/Events/EventCoalescer.hpp>
+#include <helsinki/System/Events/EventRecording.hpp>
 
 namespace hl
 {
@@ -20,4 +22,28 @@ namespace hl
 		int _height;
 	};
 
+	// Only the final size of a drag matters.
+	template<>
+	struct EventCoalescing<WindowResizeEvent>
+	{
+		static constexpr EventMergePolicy Policy = EventMergePolicy::LastWins;
+		static uint64_t Key(const WindowResizeEvent&) { return 0; }
+	};
+
+	template<>
+	struct EventRecordTraits<WindowResizeEvent>
+	{
+		static void Write(EventRecordWriter& writer, const WindowResizeEvent& event)
+		{
+			writer.Write<int32_t>(event.GetWidth());
+			writer.Write<int32_t>(event.GetHeight());
+		}
+		static WindowResizeEvent Read(EventRecordReader& reader)
+		{
+			const auto width = reader.Read<int32_t>();
+			const auto height = reader.Read<int32_t>();
+			return WindowResizeEvent(width, height);
+		}
+	};
+
 }
\ No newline at end of file
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <helsinki/System/glm.hpp>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+namespace hl
+{
+	// Running fnv1a 64 hash of simulation state. Values are added field by
+	// field rather than as raw objects so padding, pointers and vtables never
+	// reach the hash, and floats are hashed by their bits so any difference at
+	// all shows up.
+	class Checksum
+	{
+	public:
+		static constexpr uint64_t Basis = 0xcbf29ce484222325ull;
+
+		void add(const void* data, size_t size)
+		{
+			const auto bytes = static_cast<const unsigned char*>(data);
+			for (size_t i = 0; i < size; ++i)
+			{
+				_value = (_value ^ bytes[i]) * Prime;
+			}
+		}
+
+		template<typename T>
+			requires std::is_integral_v<T> || std::is_enum_v<T>
+		void add(T value)
+		{
+			add(&value, sizeof(T));
+		}
+
+		void add(float value)
+		{
+			add(std::bit_cast<uint32_t>(value));
+		}
+
+		void add(const glm::vec2& value)
+		{
+			add(value.x);
+			add(value.y);
+		}
+
+		void add(const glm::vec3& value)
+		{
+			add(value.x);
+			add(value.y);
+			add(value.z);
+		}
+
+		void add(const glm::vec4& value)
+		{
+			add(value.x);
+			add(value.y);
+			add(value.z);
+			add(value.w);
+		}
+
+		// Length first, so "ab" + "c" and "a" + "bc" differ.
+		void add(std::string_view value)
+		{
+			add((uint64_t)value.size());
+			add(value.data(), value.size());
+		}
+
+		uint64_t get() const { return _value; }
+
+	private:
+		static constexpr uint64_t Prime = 0x100000001b3ull;
+
+		uint64_t _value{ Basis };
+	};
+}
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <helsinki/System/Utils/NonCopyable.hpp>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace hl
+{
+	struct PoolStats
+	{
+		// Slots currently handed out, and the most that ever were at once.
+		size_t live{ 0 };
+		size_t peak{ 0 };
+		// Slots handed out and returned over the lifetime of the pool.
+		size_t allocations{ 0 };
+		size_t deallocations{ 0 };
+		// Calls the pool itself made to the global allocator, and their total size.
+		// Once this stops growing the pool is no longer touching the heap.
+		size_t blockAllocations{ 0 };
+		size_t reservedBytes{ 0 };
+	};
+
+	// Hands out fixed size slots carved from blocks that are allocated on demand.
+	// Freed slots go on an intrusive free list and are reused before a new block
+	// is allocated, blocks are only released when the pool is destroyed.
+	// Not thread safe.
+	class PoolAllocator : NonCopyable
+	{
+	public:
+		PoolAllocator(size_t slotSize, size_t alignment, size_t slotsPerBlock);
+		~PoolAllocator() override;
+
+		void* allocate();
+		void deallocate(void* slot);
+
+		// Allocates blocks up front so that at least slots can be live without
+		// touching the heap again.
+		void reserve(size_t slots);
+
+		size_t getSlotSize() const { return _slotSize; }
+		size_t getCapacity() const { return _blocks.size() * _slotsPerBlock; }
+		const PoolStats& getStats() const { return _stats; }
+
+	private:
+		struct FreeSlot
+		{
+			FreeSlot* next;
+		};
+
+		void allocateBlock();
+
+	private:
+		size_t _slotSize;
+		size_t _alignment;
+		size_t _slotsPerBlock;
+		std::vector<std::byte*> _blocks;
+		FreeSlot* _free{ nullptr };
+		PoolStats _stats;
+	};
+
+	// Typed wrapper over PoolAllocator, objects are constructed in place in the
+	// pooled slots. Every object must be destroyed before the pool is.
+	template<typename T>
+	class ObjectPool : NonCopyable
+	{
+	public:
+		struct Deleter
+		{
+			ObjectPool* pool{ nullptr };
+
+			void operator()(T* object) const { pool->destroy(object); }
+		};
+
+		using Pointer = std::unique_ptr<T, Deleter>;
+
+		explicit ObjectPool(size_t objectsPerBlock = 256) :
+			_allocator(sizeof(T), alignof(T), objectsPerBlock)
+		{
+
+		}
+
+		template<typename... Args>
+		T* create(Args&&... args)
+		{
+			auto slot = _allocator.allocate();
+			try
+			{
+				return new (slot) T(std::forward<Args>(args)...);
+			}
+			catch (...)
+			{
+				_allocator.deallocate(slot);
+				throw;
+			}
+		}
+
+		template<typename... Args>
+		Pointer make(Args&&... args)
+		{
+			return Pointer(create(std::forward<Args>(args)...), Deleter{ this });
+		}
+
+		void destroy(T* object)
+		{
+			if (object != nullptr)
+			{
+				object->~T();
+				_allocator.deallocate(object);
+			}
+		}
+
+		void reserve(size_t objects) { _allocator.reserve(objects); }
+
+		size_t getCapacity() const { return _allocator.getCapacity(); }
+		const PoolStats& getStats() const { return _allocator.getStats(); }
+
+	private:
+		PoolAllocator _allocator;
+	};
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstdint>
+
+namespace hl
+{
+	// Seeded pseudo random numbers, a PCG32 generator. Unlike rand() and the
+	// std distributions the sequence for a seed is the same on every platform
+	// and standard library, so a seeded simulation can be replayed exactly.
+	// Not thread safe, draw from one thread or give each thread its own.
+	class Random
+	{
+	public:
+		static constexpr uint64_t DefaultSeed = 0x853c49e6748fea9bull;
+
+		Random() { seed(DefaultSeed); }
+		explicit Random(uint64_t seed) { this->seed(seed); }
+
+		void seed(uint64_t seed)
+		{
+			_state = 0;
+			next();
+			_state += seed;
+			next();
+		}
+
+		uint32_t next()
+		{
+			const auto state = _state;
+			_state = state * Multiplier + Increment;
+			const auto xorShifted = (uint32_t)(((state >> 18u) ^ state) >> 27u);
+			const auto rotation = (uint32_t)(state >> 59u);
+			return (xorShifted >> rotation) | (xorShifted << ((0u - rotation) & 31u));
+		}
+
+		// Uniform in [0, bound), without the bias of next() % bound.
+		uint32_t nextBelow(uint32_t bound)
+		{
+			if (bound == 0)
+			{
+				return 0;
+			}
+
+			const auto threshold = (0u - bound) % bound;
+			for (;;)
+			{
+				const auto value = next();
+				if (value >= threshold)
+				{
+					return value % bound;
+				}
+			}
+		}
+
+		// Uniform in [min, max], both inclusive.
+		int nextInt(int min, int max)
+		{
+			return min + (int)nextBelow((uint32_t)(max - min) + 1u);
+		}
+
+		// Uniform in [0, 1), from the top 24 bits so every value is exact.
+		float nextFloat()
+		{
+			return (float)(next() >> 8) * (1.0f / 16777216.0f);
+		}
+
+		// Uniform in [min, max).
+		float nextFloat(float min, float max)
+		{
+			return min + nextFloat() * (max - min);
+		}
+
+		// Two generators with the same state produce the same sequence.
+		uint64_t getState() const { return _state; }
+
+	private:
+		static constexpr uint64_t Multiplier = 6364136223846793005ull;
+		static constexpr uint64_t Increment = 1442695040888963407ull;
+
+		uint64_t _state{ 0 };
+	};
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <helsinki/System/Utils/NonCopyable.hpp>
+#include <condition_variable>
+#include <functional>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <deque>
+#include <mutex>
+#include <memory>
+
+namespace hl
+{
+	// Fixed size work stealing thread pool.
+	// Every worker owns a queue, tasks submitted from a worker go to its own queue
+	// and are popped LIFO, idle workers steal FIFO from the other queues.
+	class ThreadPool : NonCopyable
+	{
+	public:
+		explicit ThreadPool(size_t threadCount);
+		~ThreadPool();
+
+		void submit(std::function<void()> task);
+
+		// Runs one queued task on the calling thread if there is one, so that a
+		// thread waiting on submitted work can help instead of blocking.
+		bool tryRunTask();
+
+		size_t getThreadCount() const { return _threads.size(); }
+
+		// Process wide pool sized to the hardware, leaving a core for the main thread.
+		static ThreadPool& getShared();
+
+	private:
+		struct WorkerQueue
+		{
+			std::mutex mutex;
+			std::deque<std::function<void()>> tasks;
+		};
+
+		void workerLoop(size_t index);
+		bool popTask(size_t preferred, std::function<void()>& task);
+
+	private:
+		std::vector<std::unique_ptr<WorkerQueue>> _queues;
+		std::vector<std::thread> _threads;
+		std::atomic<size_t> _nextQueue{ 0 };
+		std::atomic<size_t> _queuedTasks{ 0 };
+
+		std::mutex _sleepMutex;
+		std::condition_variable _wake;
+		bool _stopping{ false };
+	};
+}
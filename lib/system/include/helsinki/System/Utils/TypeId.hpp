@@ -0,0 +1,46 @@
+#pragma once
+
+#include <helsinki/System/Utils/String.hpp>
+#include <string_view>
+#include <cstdint>
+
+namespace hl
+{
+	// Compile time type names and ids, the id is the fnv1a 64 hash of the name
+	// the compiler gives the type, so it does not depend on the order types are
+	// first used in and is the same in every translation unit and shared library
+	// built by the same compiler.
+	class TypeId
+	{
+	public:
+		TypeId() = delete;
+
+		template<typename T>
+		static constexpr std::string_view Name()
+		{
+#if defined(_MSC_VER) && !defined(__clang__)
+			constexpr std::string_view function = __FUNCSIG__;
+			constexpr std::string_view prefix = "Name<";
+			constexpr std::string_view suffix = ">(void)";
+
+			constexpr auto start = function.find(prefix) + prefix.size();
+			constexpr auto end = function.rfind(suffix);
+#else
+			constexpr std::string_view function = __PRETTY_FUNCTION__;
+			constexpr std::string_view prefix = "T = ";
+
+			constexpr auto start = function.find(prefix) + prefix.size();
+			constexpr auto end = function.find_first_of(";]", start);
+#endif
+			static_assert(start < end && end != std::string_view::npos, "Unable to determine the type name on this compiler");
+
+			return function.substr(start, end - start);
+		}
+
+		template<typename T>
+		static constexpr uint64_t Get()
+		{
+			return String::fnv1a_64(Name<T>());
+		}
+	};
+}
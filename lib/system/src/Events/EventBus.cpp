@@ -0,0 +1,38 @@
+#include <helsinki/System/Events/EventBus.hpp>
+#include <tracy/Tracy.hpp>
+#include <chrono>
+
+namespace hl
+{
+
+    void EventBus::ProcessEvents(EventPhase phase)
+    {
+        ZoneScopedN("EventBus::ProcessEvents");
+        ZoneNameF("ProcessEvents %s", GetEventPhaseName(phase));
+
+        const auto start = std::chrono::steady_clock::now();
+
+        auto eventCount = queues[(size_t)phase].Drain(this);
+
+        for (size_t i = 0; i < coalescers.size(); ++i)
+        {
+            if (coalescers[i] != nullptr && GetPhaseAt((uint32_t)i).value_or(EventPhase::EndOfFrame) == phase)
+            {
+                eventCount += coalescers[i]->Flush();
+            }
+        }
+
+        auto& timing = phaseTimings[(size_t)phase];
+        timing.eventCount = eventCount;
+        timing.milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    void EventBus::ProcessEvents()
+    {
+        for (size_t i = 0; i < EventPhaseCount; ++i)
+        {
+            ProcessEvents((EventPhase)i);
+        }
+    }
+
+}
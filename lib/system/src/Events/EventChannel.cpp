@@ -0,0 +1,42 @@
+#include <helsinki/System/Events/EventChannel.hpp>
+#include <unordered_map>
+#include <stdexcept>
+#include <string>
+#include <mutex>
+
+namespace hl
+{
+
+    struct EventTypeRegistry
+    {
+        std::mutex mutex;
+        std::unordered_map<uint64_t, std::pair<uint32_t, std::string>> types;
+    };
+
+    static EventTypeRegistry& getRegistry()
+    {
+        static EventTypeRegistry registry;
+        return registry;
+    }
+
+    uint32_t EventTypeIndex::RegisterType(uint64_t typeId, std::string_view name)
+    {
+        auto& registry = getRegistry();
+        std::lock_guard lock(registry.mutex);
+
+        if (auto it = registry.types.find(typeId); it != registry.types.end())
+        {
+            if (it->second.second != name)
+            {
+                throw std::runtime_error("Event type id collision between " + it->second.second + " and " + std::string(name));
+            }
+
+            return it->second.first;
+        }
+
+        const auto index = (uint32_t)registry.types.size();
+        registry.types.emplace(typeId, std::make_pair(index, std::string(name)));
+        return index;
+    }
+
+}
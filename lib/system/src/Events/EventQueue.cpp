@@ -0,0 +1,388 @@
+#include <helsinki/System/Events/EventQueue.hpp>
+#include <stdexcept>
+#include <unordered_set>
+#include <vector>
+
+namespace hl
+{
+
+    static constexpr size_t RecordAlignment = alignof(std::max_align_t);
+
+    static constexpr size_t alignUp(size_t value, size_t alignment)
+    {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+
+    struct EventQueueBlock
+    {
+        // Bytes of complete records, published by the producing thread.
+        std::atomic<uint32_t> committed{ 0 };
+        // Set once the producing thread has moved on, after its last commit.
+        std::atomic<EventQueueBlock*> next{ nullptr };
+        EventQueueBlock* nextFree{ nullptr };
+        uint32_t capacity{ 0 };
+
+        std::byte* data();
+    };
+
+    static constexpr size_t BlockDataOffset = alignUp(sizeof(EventQueueBlock), RecordAlignment);
+
+    std::byte* EventQueueBlock::data()
+    {
+        return reinterpret_cast<std::byte*>(this) + BlockDataOffset;
+    }
+
+    struct EventRecord
+    {
+        EventQueue::Process process;
+        void* target;
+        // From the start of this record to the start of the next.
+        uint32_t size;
+        uint32_t eventOffset;
+    };
+
+    struct EventQueueProducer
+    {
+        // Only touched by the publishing thread.
+        EventQueueBlock* tail{ nullptr };
+        uint32_t writeOffset{ 0 };
+        uint32_t pendingSize{ 0 };
+        EventQueueBlock* spare{ nullptr };
+
+        // The block the publishing thread last moved on to, where a drain stops.
+        std::atomic<EventQueueBlock*> published{ nullptr };
+        // Drained blocks handed back to the publishing thread.
+        std::atomic<EventQueueBlock*> returned{ nullptr };
+        std::atomic<EventQueueProducer*> next{ nullptr };
+
+        // Only touched by the draining thread, kept off the publishing thread's
+        // cache line.
+        alignas(64) EventQueueBlock* head{ nullptr };
+        uint32_t readOffset{ 0 };
+        EventQueueBlock* stopBlock{ nullptr };
+        uint32_t stopOffset{ 0 };
+    };
+
+    static EventQueueBlock* allocateBlock(uint32_t capacity)
+    {
+        auto block = new (::operator new(BlockDataOffset + capacity)) EventQueueBlock();
+        block->capacity = capacity;
+        return block;
+    }
+
+    static void freeBlock(EventQueueBlock* block)
+    {
+        block->~EventQueueBlock();
+        ::operator delete(block);
+    }
+
+    static void freeBlockList(EventQueueBlock* block)
+    {
+        while (block != nullptr)
+        {
+            const auto next = block->nextFree;
+            freeBlock(block);
+            block = next;
+        }
+    }
+
+    struct ThreadProducer
+    {
+        uint64_t queueId;
+        EventQueueProducer* producer;
+    };
+
+    // The ids of the queues that still exist, so threads can drop their
+    // entries for destroyed ones. Created on first use, so it outlives any
+    // queue with static storage.
+    struct LiveEventQueues
+    {
+        std::mutex mutex;
+        std::unordered_set<uint64_t> ids;
+        std::atomic<uint64_t> destroyed{ 0 };
+    };
+
+    static LiveEventQueues& getLiveQueues()
+    {
+        static LiveEventQueues live;
+        return live;
+    }
+
+    // Ids rather than queue addresses, so a queue allocated where a destroyed
+    // one used to be does not pick up its producers.
+    static std::atomic<uint64_t> nextQueueId{ 1 };
+    static thread_local std::vector<ThreadProducer> threadProducers;
+    // LiveEventQueues::destroyed when this thread last dropped its entries.
+    static thread_local uint64_t threadPrunedAt{ 0 };
+
+    EventQueue::EventQueue() :
+        id(nextQueueId.fetch_add(1, std::memory_order_relaxed))
+    {
+        auto& live = getLiveQueues();
+        std::lock_guard<std::mutex> lock(live.mutex);
+        live.ids.insert(id);
+    }
+
+    EventQueue::~EventQueue()
+    {
+        {
+            auto& live = getLiveQueues();
+            std::lock_guard<std::mutex> lock(live.mutex);
+            live.ids.erase(id);
+            live.destroyed.fetch_add(1, std::memory_order_relaxed);
+        }
+        // Other threads drop theirs the next time they look for a queue they
+        // have no entry for.
+        std::erase_if(threadProducers, [this](const ThreadProducer& entry) { return entry.queueId == id; });
+
+        auto producer = firstProducer.load(std::memory_order_acquire);
+        while (producer != nullptr)
+        {
+            auto block = producer->head;
+            auto offset = producer->readOffset;
+            while (block != nullptr)
+            {
+                const auto committed = block->committed.load(std::memory_order_acquire);
+                while (offset < committed)
+                {
+                    auto record = reinterpret_cast<EventRecord*>(block->data() + offset);
+                    offset += record->size;
+                    record->process(nullptr, record->target, reinterpret_cast<std::byte*>(record) + record->eventOffset);
+                }
+
+                const auto next = block->next.load(std::memory_order_acquire);
+                freeBlock(block);
+                block = next;
+                offset = 0;
+            }
+
+            freeBlockList(producer->spare);
+            freeBlockList(producer->returned.load(std::memory_order_acquire));
+
+            const auto next = producer->next.load(std::memory_order_acquire);
+            delete producer;
+            producer = next;
+        }
+    }
+
+    size_t EventQueue::Drain(void* context)
+    {
+        if (draining)
+        {
+            return 0;
+        }
+
+        struct DrainingScope
+        {
+            bool& draining;
+            explicit DrainingScope(bool& flag) : draining(flag) { draining = true; }
+            ~DrainingScope() { draining = false; }
+        } scope(draining);
+
+        // Fix where each buffer ends first, so whatever the handlers publish is
+        // left for the next drain, then process the buffers in order.
+        size_t count = 0;
+        for (auto producer = firstProducer.load(std::memory_order_acquire);
+            producer != nullptr;
+            producer = producer->next.load(std::memory_order_acquire))
+        {
+            producer->stopBlock = producer->published.load(std::memory_order_acquire);
+            producer->stopOffset = producer->stopBlock->committed.load(std::memory_order_acquire);
+            count++;
+        }
+
+        size_t processed = 0;
+        auto producer = firstProducer.load(std::memory_order_acquire);
+        for (size_t i = 0; i < count; ++i)
+        {
+            processed += DrainProducer(*producer, context);
+            producer = producer->next.load(std::memory_order_acquire);
+        }
+
+        return processed;
+    }
+
+    size_t EventQueue::GetProducerCount() const
+    {
+        std::lock_guard<std::mutex> lock(producersMutex);
+        return producerCount;
+    }
+
+    EventQueueProducer& EventQueue::GetProducer()
+    {
+        // Searched from the back, the most recently created queues are the most
+        // likely to be in use.
+        for (auto it = threadProducers.rbegin(); it != threadProducers.rend(); ++it)
+        {
+            if (it->queueId == id)
+            {
+                return *it->producer;
+            }
+        }
+
+        PruneThreadProducers();
+        return RegisterProducer();
+    }
+
+    size_t EventQueue::GetThreadQueueCount()
+    {
+        return threadProducers.size();
+    }
+
+    void EventQueue::PruneThreadProducers()
+    {
+        // Only worth taking the lock if a queue has been destroyed since the
+        // last time.
+        auto& live = getLiveQueues();
+        const auto destroyed = live.destroyed.load(std::memory_order_relaxed);
+        if (destroyed == threadPrunedAt)
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(live.mutex);
+        std::erase_if(threadProducers, [&](const ThreadProducer& entry) { return !live.ids.contains(entry.queueId); });
+        threadPrunedAt = destroyed;
+    }
+
+    EventQueueProducer& EventQueue::RegisterProducer()
+    {
+        auto producer = new EventQueueProducer();
+        auto block = allocateBlock(BlockSize);
+        producer->tail = block;
+        producer->head = block;
+        producer->published.store(block, std::memory_order_relaxed);
+
+        {
+            std::lock_guard<std::mutex> lock(producersMutex);
+            if (lastProducer == nullptr)
+            {
+                firstProducer.store(producer, std::memory_order_release);
+            }
+            else
+            {
+                lastProducer->next.store(producer, std::memory_order_release);
+            }
+            lastProducer = producer;
+            producerCount++;
+        }
+
+        threadProducers.push_back(ThreadProducer{ .queueId = id, .producer = producer });
+        return *producer;
+    }
+
+    std::byte* EventQueue::Reserve(EventQueueProducer& producer, Process process, void* target, size_t size, size_t alignment)
+    {
+        if (alignment > RecordAlignment)
+        {
+            throw std::runtime_error("Over aligned events cannot be queued");
+        }
+
+        const auto eventOffset = alignUp(sizeof(EventRecord), alignment);
+        const auto recordSize = alignUp(eventOffset + size, RecordAlignment);
+
+        if (producer.writeOffset + recordSize > producer.tail->capacity)
+        {
+            NextBlock(producer, (uint32_t)recordSize);
+        }
+
+        auto record = new (producer.tail->data() + producer.writeOffset) EventRecord
+            {
+                .process = process,
+                .target = target,
+                .size = (uint32_t)recordSize,
+                .eventOffset = (uint32_t)eventOffset
+            };
+        producer.pendingSize = (uint32_t)recordSize;
+
+        return reinterpret_cast<std::byte*>(record) + eventOffset;
+    }
+
+    void EventQueue::Commit(EventQueueProducer& producer)
+    {
+        producer.writeOffset += producer.pendingSize;
+        producer.tail->committed.store(producer.writeOffset, std::memory_order_release);
+    }
+
+    void EventQueue::NextBlock(EventQueueProducer& producer, uint32_t minimumCapacity)
+    {
+        EventQueueBlock* block = nullptr;
+        if (minimumCapacity > BlockSize)
+        {
+            block = allocateBlock(minimumCapacity);
+        }
+        else
+        {
+            if (producer.spare == nullptr)
+            {
+                producer.spare = producer.returned.exchange(nullptr, std::memory_order_acquire);
+            }
+
+            if (producer.spare != nullptr)
+            {
+                block = producer.spare;
+                producer.spare = block->nextFree;
+                block->nextFree = nullptr;
+                block->committed.store(0, std::memory_order_relaxed);
+                block->next.store(nullptr, std::memory_order_relaxed);
+            }
+            else
+            {
+                block = allocateBlock(BlockSize);
+            }
+        }
+
+        producer.tail->next.store(block, std::memory_order_release);
+        producer.tail = block;
+        producer.writeOffset = 0;
+        producer.published.store(block, std::memory_order_release);
+    }
+
+    void EventQueue::ReturnBlock(EventQueueProducer& producer, EventQueueBlock* block)
+    {
+        if (block->capacity != BlockSize)
+        {
+            freeBlock(block);
+            return;
+        }
+
+        auto head = producer.returned.load(std::memory_order_relaxed);
+        do
+        {
+            block->nextFree = head;
+        } while (!producer.returned.compare_exchange_weak(head, block, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    size_t EventQueue::DrainProducer(EventQueueProducer& producer, void* context)
+    {
+        size_t processed = 0;
+        while (true)
+        {
+            // Blocks before the stop block are complete, their final commit
+            // happened before the stop block was published.
+            const auto end = producer.head == producer.stopBlock
+                ? producer.stopOffset
+                : producer.head->committed.load(std::memory_order_acquire);
+
+            while (producer.readOffset < end)
+            {
+                auto record = reinterpret_cast<EventRecord*>(producer.head->data() + producer.readOffset);
+                // Moved past first so a throwing handler does not see it again.
+                producer.readOffset += record->size;
+                processed++;
+                record->process(context, record->target, reinterpret_cast<std::byte*>(record) + record->eventOffset);
+            }
+
+            if (producer.head == producer.stopBlock)
+            {
+                return processed;
+            }
+
+            const auto drained = producer.head;
+            producer.head = drained->next.load(std::memory_order_acquire);
+            producer.readOffset = 0;
+            ReturnBlock(producer, drained);
+        }
+    }
+
+}
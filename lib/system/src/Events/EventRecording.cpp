@@ -0,0 +1,216 @@
+#include <helsinki/System/Events/EventRecording.hpp>
+#include <format>
+#include <fstream>
+#include <stdexcept>
+
+namespace hl
+{
+
+    static constexpr char Magic[4] = { 'H', 'L', 'E', 'R' };
+
+    struct EventRecordingHeader
+    {
+        char magic[4];
+        uint32_t version;
+        uint32_t typeCount;
+        uint32_t recordCount;
+        uint32_t frameCount;
+    };
+
+    static void appendVarint(std::vector<std::byte>& data, uint64_t value)
+    {
+        while (value >= 0x80)
+        {
+            data.push_back(std::byte((value & 0x7F) | 0x80));
+            value >>= 7;
+        }
+        data.push_back(std::byte(value));
+    }
+
+    static void appendBytes(std::vector<std::byte>& data, const void* bytes, size_t size)
+    {
+        const auto offset = data.size();
+        data.resize(offset + size);
+        std::memcpy(data.data() + offset, bytes, size);
+    }
+
+    const std::byte* EventRecordReader::Take(size_t size)
+    {
+        if (size > data.size() - offset)
+        {
+            throw std::runtime_error("Event recording is truncated");
+        }
+
+        const auto taken = data.data() + offset;
+        offset += size;
+        return taken;
+    }
+
+    uint64_t EventRecordReader::ReadVarint()
+    {
+        uint64_t value = 0;
+        for (uint32_t shift = 0; shift < 64; shift += 7)
+        {
+            const auto byte = (uint8_t)*Take(1);
+            value |= (uint64_t)(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0)
+            {
+                return value;
+            }
+        }
+
+        throw std::runtime_error("Event recording has an invalid varint");
+    }
+
+    uint32_t EventRecording::AddType(std::string_view name)
+    {
+        types.emplace_back(name);
+        return (uint32_t)types.size() - 1;
+    }
+
+    void EventRecording::AddRecord(uint64_t update, uint32_t type, uint32_t offset)
+    {
+        records.push_back(Record
+            {
+                .update = update,
+                .type = type,
+                .offset = offset,
+                .size = (uint32_t)(payload.size() - offset)
+            });
+    }
+
+    void EventRecording::AddFrame(uint32_t updateCount)
+    {
+        frames.push_back(updateCount);
+    }
+
+    std::span<const std::byte> EventRecording::GetPayload(const Record& record) const
+    {
+        return std::span<const std::byte>(payload).subspan(record.offset, record.size);
+    }
+
+    std::vector<std::byte> EventRecording::Save() const
+    {
+        std::vector<std::byte> data;
+        data.reserve(sizeof(EventRecordingHeader) + payload.size() + records.size() * 4 + frames.size());
+
+        EventRecordingHeader header{};
+        std::memcpy(header.magic, Magic, sizeof(Magic));
+        header.version = Version;
+        header.typeCount = (uint32_t)types.size();
+        header.recordCount = (uint32_t)records.size();
+        header.frameCount = (uint32_t)frames.size();
+        appendBytes(data, &header, sizeof(header));
+
+        for (const auto& type : types)
+        {
+            appendVarint(data, type.size());
+            appendBytes(data, type.data(), type.size());
+        }
+
+        for (const auto updateCount : frames)
+        {
+            appendVarint(data, updateCount);
+        }
+
+        uint64_t previousUpdate = 0;
+        for (const auto& record : records)
+        {
+            appendVarint(data, record.update - previousUpdate);
+            appendVarint(data, record.type);
+            appendVarint(data, record.size);
+            appendBytes(data, payload.data() + record.offset, record.size);
+            previousUpdate = record.update;
+        }
+
+        return data;
+    }
+
+    void EventRecording::SaveToFile(const std::string& path) const
+    {
+        const auto data = Save();
+
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(data.data()), (std::streamsize)data.size());
+        if (!file)
+        {
+            throw std::runtime_error(std::format("Failed to write event recording to {}", path));
+        }
+    }
+
+    EventRecording EventRecording::Load(std::span<const std::byte> data)
+    {
+        EventRecordReader reader(data);
+
+        const auto header = reader.Read<EventRecordingHeader>();
+        if (std::memcmp(header.magic, Magic, sizeof(Magic)) != 0)
+        {
+            throw std::runtime_error("Data is not an event recording");
+        }
+        if (header.version != Version)
+        {
+            throw std::runtime_error(std::format("Unsupported event recording version {}", header.version));
+        }
+
+        EventRecording recording;
+
+        for (uint32_t i = 0; i < header.typeCount; ++i)
+        {
+            const auto length = reader.ReadVarint();
+            const auto name = reinterpret_cast<const char*>(reader.Take(length));
+            recording.AddType(std::string_view(name, length));
+        }
+
+        recording.frames.reserve(header.frameCount);
+        for (uint32_t i = 0; i < header.frameCount; ++i)
+        {
+            recording.AddFrame((uint32_t)reader.ReadVarint());
+        }
+
+        recording.records.reserve(header.recordCount);
+        uint64_t update = 0;
+        for (uint32_t i = 0; i < header.recordCount; ++i)
+        {
+            update += reader.ReadVarint();
+            const auto type = reader.ReadVarint();
+            if (type >= header.typeCount)
+            {
+                throw std::runtime_error("Event recording has a record of an unknown type");
+            }
+
+            const auto size = reader.ReadVarint();
+            const auto bytes = reader.Take(size);
+
+            const auto offset = (uint32_t)recording.payload.size();
+            appendBytes(recording.payload, bytes, size);
+            recording.AddRecord(update, (uint32_t)type, offset);
+        }
+
+        if (!reader.IsAtEnd())
+        {
+            throw std::runtime_error("Event recording has trailing data");
+        }
+
+        return recording;
+    }
+
+    EventRecording EventRecording::LoadFromFile(const std::string& path)
+    {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file)
+        {
+            throw std::runtime_error(std::format("Failed to open event recording {}", path));
+        }
+
+        std::vector<std::byte> data((size_t)file.tellg());
+        file.seekg(0);
+        file.read(reinterpret_cast<char*>(data.data()), (std::streamsize)data.size());
+        if (!file)
+        {
+            throw std::runtime_error(std::format("Failed to read event recording {}", path));
+        }
+
+        return Load(data);
+    }
+
+}
@@ -0,0 +1,80 @@
+#include <helsinki/System/Utils/ObjectPool.hpp>
+#include <algorithm>
+#include <new>
+
+namespace hl
+{
+	PoolAllocator::PoolAllocator(
+		size_t slotSize,
+		size_t alignment,
+		size_t slotsPerBlock
+	) :
+		_alignment(std::max(alignment, alignof(FreeSlot))),
+		_slotsPerBlock(std::max<size_t>(1, slotsPerBlock))
+	{
+		// Every slot has to be able to hold the free list link, and be a multiple
+		// of the alignment so that consecutive slots stay aligned.
+		slotSize = std::max(slotSize, sizeof(FreeSlot));
+		_slotSize = (slotSize + _alignment - 1) & ~(_alignment - 1);
+	}
+	PoolAllocator::~PoolAllocator()
+	{
+		for (auto block : _blocks)
+		{
+			::operator delete(block, std::align_val_t{ _alignment });
+		}
+	}
+
+	void* PoolAllocator::allocate()
+	{
+		if (_free == nullptr)
+		{
+			allocateBlock();
+		}
+
+		auto slot = _free;
+		_free = slot->next;
+
+		_stats.allocations++;
+		_stats.live++;
+		_stats.peak = std::max(_stats.peak, _stats.live);
+
+		return slot;
+	}
+
+	void PoolAllocator::deallocate(void* slot)
+	{
+		auto freed = static_cast<FreeSlot*>(slot);
+		freed->next = _free;
+		_free = freed;
+
+		_stats.deallocations++;
+		_stats.live--;
+	}
+
+	void PoolAllocator::reserve(size_t slots)
+	{
+		while (getCapacity() < slots)
+		{
+			allocateBlock();
+		}
+	}
+
+	void PoolAllocator::allocateBlock()
+	{
+		const auto size = _slotSize * _slotsPerBlock;
+		auto block = static_cast<std::byte*>(::operator new(size, std::align_val_t{ _alignment }));
+		_blocks.push_back(block);
+
+		// Thread the new slots onto the front of the free list in address order.
+		for (size_t i = _slotsPerBlock; i > 0; --i)
+		{
+			auto slot = reinterpret_cast<FreeSlot*>(block + (i - 1) * _slotSize);
+			slot->next = _free;
+			_free = slot;
+		}
+
+		_stats.blockAllocations++;
+		_stats.reservedBytes += size;
+	}
+}
@@ -0,0 +1,127 @@
+#include <helsinki/System/Utils/ThreadPool.hpp>
+#include <algorithm>
+
+namespace hl
+{
+	// Pool and queue index of the worker running on this thread, if any.
+	static thread_local const ThreadPool* t_workerPool = nullptr;
+	static thread_local size_t t_workerIndex = 0;
+
+	ThreadPool::ThreadPool(size_t threadCount)
+	{
+		threadCount = std::max<size_t>(1, threadCount);
+
+		for (size_t i = 0; i < threadCount; ++i)
+		{
+			_queues.emplace_back(std::make_unique<WorkerQueue>());
+		}
+		for (size_t i = 0; i < threadCount; ++i)
+		{
+			_threads.emplace_back([this, i]() { workerLoop(i); });
+		}
+	}
+	ThreadPool::~ThreadPool()
+	{
+		{
+			std::lock_guard lock(_sleepMutex);
+			_stopping = true;
+		}
+		_wake.notify_all();
+
+		for (auto& thread : _threads)
+		{
+			thread.join();
+		}
+	}
+
+	void ThreadPool::submit(std::function<void()> task)
+	{
+		const auto index = t_workerPool == this
+			? t_workerIndex
+			: _nextQueue.fetch_add(1, std::memory_order_relaxed) % _queues.size();
+
+		{
+			auto& queue = *_queues[index];
+			std::lock_guard lock(queue.mutex);
+			queue.tasks.push_back(std::move(task));
+		}
+
+		{
+			std::lock_guard lock(_sleepMutex);
+			_queuedTasks.fetch_add(1, std::memory_order_release);
+		}
+		_wake.notify_one();
+	}
+
+	bool ThreadPool::tryRunTask()
+	{
+		std::function<void()> task;
+		if (!popTask(t_workerPool == this ? t_workerIndex : 0, task))
+		{
+			return false;
+		}
+
+		task();
+		return true;
+	}
+
+	ThreadPool& ThreadPool::getShared()
+	{
+		static ThreadPool pool(std::max(1u, std::thread::hardware_concurrency()) - 1);
+		return pool;
+	}
+
+	void ThreadPool::workerLoop(size_t index)
+	{
+		t_workerPool = this;
+		t_workerIndex = index;
+
+		while (true)
+		{
+			std::function<void()> task;
+			if (popTask(index, task))
+			{
+				task();
+				continue;
+			}
+
+			std::unique_lock lock(_sleepMutex);
+			_wake.wait(lock, [this]() { return _stopping || _queuedTasks.load(std::memory_order_acquire) > 0; });
+
+			if (_stopping && _queuedTasks.load(std::memory_order_acquire) == 0)
+			{
+				return;
+			}
+		}
+	}
+
+	bool ThreadPool::popTask(size_t preferred, std::function<void()>& task)
+	{
+		{
+			auto& own = *_queues[preferred];
+			std::lock_guard lock(own.mutex);
+			if (!own.tasks.empty())
+			{
+				task = std::move(own.tasks.back());
+				own.tasks.pop_back();
+				_queuedTasks.fetch_sub(1, std::memory_order_relaxed);
+				return true;
+			}
+		}
+
+		for (size_t offset = 1; offset < _queues.size(); ++offset)
+		{
+			auto& victim = *_queues[(preferred + offset) % _queues.size()];
+			std::lock_guard lock(victim.mutex);
+			if (!victim.tasks.empty())
+			{
+				task = std::move(victim.tasks.front());
+				victim.tasks.pop_front();
+				_queuedTasks.fetch_sub(1, std::memory_order_relaxed);
+				return true;
+			}
+		}
+
+		return false;
+	}
+}
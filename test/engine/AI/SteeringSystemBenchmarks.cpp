@@ -0,0 +1,110 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <helsinki/Engine/AI/SteeringSystem.hpp>
+#include <algorithm>
+#include <string>
+
+namespace hl
+{
+	namespace test
+	{
+		TEST_CASE("Steering agents", "[.][benchmark][Engine][AI][SteeringSystem]")
+		{
+			constexpr float Delta = 1.0f / 60.0f;
+
+			for (const auto count : { 1000, 10000 })
+			{
+				Scene scene;
+				auto ball = scene.addEntity("Ball");
+				ball->AddComponent<TransformComponent>()->SetPosition(glm::vec3(300.0f, 250.0f, 0.0f));
+				ball->AddComponent<KinematicComponent>()->velocity = glm::vec3(256.0f, 256.0f, 0.0f);
+
+				for (int i = 0; i < count; ++i)
+				{
+					auto paddle = scene.addEntity();
+					paddle->AddComponent<TransformComponent>()->SetPosition(glm::vec3((float)(i % 600), (float)(i % 500), 0.0f));
+					auto tracker = paddle->AddComponent<TrackAxisComponent>();
+					tracker->target = ball->Id;
+					tracker->maxSpeed = 512.0f;
+					tracker->min = 0.0f;
+					tracker->max = 504.0f;
+					tracker->ignoreReceding = i % 2 == 0;
+				}
+
+				const auto suffix = ", " + std::to_string(count) + " agents";
+				SteeringSystem steering(scene);
+
+				// How PaddleComputerControlSystem moved its paddles, looking the
+				// ball and each paddle's components up every update.
+				BENCHMARK("Per entity lookups" + suffix)
+				{
+					auto b = scene.getEntity("Ball");
+					const auto ballPosition = b->GetComponent<TransformComponent>()->GetPosition();
+					const auto ballVelocity = b->GetComponent<KinematicComponent>()->velocity;
+					for (auto& e : scene.getEntities())
+					{
+						if (e->HasComponents<TransformComponent, TrackAxisComponent>())
+						{
+							auto tc = e->GetComponent<TransformComponent>();
+							auto tracker = e->GetComponent<TrackAxisComponent>();
+							auto pos = tc->GetPosition();
+							if (tracker->ignoreReceding && ballVelocity.x * (pos.x - ballPosition.x) < 0.0f)
+							{
+								continue;
+							}
+							const auto step = tracker->maxSpeed * Delta;
+							pos.y = std::clamp(std::clamp(ballPosition.y, tracker->min, tracker->max), pos.y - step, pos.y + step);
+							tc->SetPosition(pos);
+						}
+					}
+				};
+
+				BENCHMARK("SteeringSystem tracking" + suffix)
+				{
+					steering.update(Delta);
+				};
+			}
+
+			{
+				// A third of the agents on each behaviour.
+				constexpr int Count = 10000;
+				Scene scene;
+				auto ball = scene.addEntity("Ball");
+				ball->AddComponent<TransformComponent>()->SetPosition(glm::vec3(300.0f, 250.0f, 0.0f));
+
+				for (int i = 0; i < Count; ++i)
+				{
+					auto agent = scene.addEntity();
+					const auto position = glm::vec3((float)(i % 600), (float)(i % 500), 0.0f);
+					agent->AddComponent<TransformComponent>()->SetPosition(position);
+					if (i % 3 == 0)
+					{
+						auto tracker = agent->AddComponent<TrackAxisComponent>();
+						tracker->target = ball->Id;
+						tracker->maxSpeed = 512.0f;
+					}
+					else if (i % 3 == 1)
+					{
+						auto seek = agent->AddComponent<SeekComponent>();
+						seek->target = ball->Id;
+						seek->maxSpeed = 128.0f;
+						seek->slowingRadius = 32.0f;
+					}
+					else
+					{
+						auto patrol = agent->AddComponent<PatrolComponent>();
+						patrol->from = position;
+						patrol->to = position + glm::vec3(64.0f, 0.0f, 0.0f);
+						patrol->speed = 96.0f;
+					}
+				}
+
+				SteeringSystem steering(scene);
+				BENCHMARK("SteeringSystem, mixed behaviours, 10000 agents")
+				{
+					steering.update(Delta);
+				};
+			}
+		}
+	}
+}
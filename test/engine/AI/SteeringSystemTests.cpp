@@ -0,0 +1,180 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <helsinki/Engine/AI/SteeringSystem.hpp>
+#include <vector>
+
+namespace hl
+{
+	namespace test
+	{
+		static Entity* addSteeringTarget(Scene& scene, const glm::vec3& position, const glm::vec3& velocity)
+		{
+			auto entity = scene.addEntity();
+			entity->AddComponent<TransformComponent>()->SetPosition(position);
+			entity->AddComponent<KinematicComponent>()->velocity = velocity;
+			return entity;
+		}
+
+		static Entity* addTracker(Scene& scene, const glm::vec3& position, int target)
+		{
+			auto entity = scene.addEntity();
+			entity->AddComponent<TransformComponent>()->SetPosition(position);
+			auto tracker = entity->AddComponent<TrackAxisComponent>();
+			tracker->target = target;
+			tracker->axis = 1;
+			tracker->maxSpeed = 60.0f;
+			return entity;
+		}
+
+		static glm::vec3 positionOf(Entity* entity)
+		{
+			return entity->GetComponent<TransformComponent>()->GetPosition();
+		}
+
+		TEST_CASE("Trackers follow their target along one axis at up to their speed", "[Engine][AI][SteeringSystem]")
+		{
+			Scene scene;
+			auto target = addSteeringTarget(scene, glm::vec3(10.0f, 3.5f, 0.0f), glm::vec3(0.0f));
+			auto tracker = addTracker(scene, glm::vec3(0.0f), target->Id);
+			auto clamped = addTracker(scene, glm::vec3(0.0f), target->Id);
+			clamped->GetComponent<TrackAxisComponent>()->max = 2.0f;
+			SteeringSystem steering(scene);
+
+			// One unit an update, the other axes are left alone.
+			steering.update(1.0f / 60.0f);
+			CHECK(positionOf(tracker) == glm::vec3(0.0f, 1.0f, 0.0f));
+
+			steering.update(1.0f / 60.0f);
+			steering.update(1.0f / 60.0f);
+			steering.update(1.0f / 60.0f);
+			// Lands on the target rather than overshooting it.
+			CHECK(positionOf(tracker) == glm::vec3(0.0f, 3.5f, 0.0f));
+			CHECK(positionOf(clamped) == glm::vec3(0.0f, 2.0f, 0.0f));
+
+			// Nothing to follow once the target has gone.
+			scene.removeEntity(target->Id);
+			scene.update();
+			steering.update(1.0f / 60.0f);
+			CHECK(positionOf(tracker) == glm::vec3(0.0f, 3.5f, 0.0f));
+		}
+
+		TEST_CASE("Trackers alternating between targets each follow their own", "[Engine][AI][SteeringSystem]")
+		{
+			Scene scene;
+			auto low = addSteeringTarget(scene, glm::vec3(10.0f, -0.5f, 0.0f), glm::vec3(0.0f));
+			auto high = addSteeringTarget(scene, glm::vec3(10.0f, 0.5f, 0.0f), glm::vec3(0.0f));
+
+			std::vector<Entity*> trackers;
+			for (int i = 0; i < 8; ++i)
+			{
+				trackers.push_back(addTracker(scene, glm::vec3(0.0f), i % 2 == 0 ? low->Id : high->Id));
+			}
+
+			SteeringSystem steering(scene);
+			steering.update(1.0f / 60.0f);
+			for (size_t i = 0; i < trackers.size(); ++i)
+			{
+				CHECK(positionOf(trackers[i]).y == (i % 2 == 0 ? -0.5f : 0.5f));
+			}
+
+			// Targets are looked up again each update, wherever they have moved.
+			scene.removeEntity(low->Id);
+			scene.update();
+			high->GetComponent<TransformComponent>()->SetPosition(glm::vec3(10.0f, 1.0f, 0.0f));
+			steering.update(1.0f / 60.0f);
+			for (size_t i = 0; i < trackers.size(); ++i)
+			{
+				CHECK(positionOf(trackers[i]).y == (i % 2 == 0 ? -0.5f : 1.0f));
+			}
+		}
+
+		TEST_CASE("Trackers rest when the target is out of sight and can ignore it heading away", "[Engine][AI][SteeringSystem]")
+		{
+			Scene scene;
+			auto target = addSteeringTarget(scene, glm::vec3(0.0f, 10.0f, 0.0f), glm::vec3(-5.0f, 0.0f, 0.0f));
+
+			auto shortSighted = addTracker(scene, glm::vec3(20.0f, 5.0f, 0.0f), target->Id);
+			auto sight = shortSighted->GetComponent<TrackAxisComponent>();
+			sight->sightRange = 15.0f;
+			sight->rest = 0.0f;
+			sight->maxSpeed = 600.0f;
+
+			auto lazy = addTracker(scene, glm::vec3(20.0f, 5.0f, 0.0f), target->Id);
+			auto receding = lazy->GetComponent<TrackAxisComponent>();
+			receding->ignoreReceding = true;
+			receding->maxSpeed = 600.0f;
+
+			SteeringSystem steering(scene);
+			steering.update(1.0f / 60.0f);
+			CHECK(positionOf(shortSighted) == glm::vec3(20.0f, 0.0f, 0.0f));
+			CHECK(positionOf(lazy) == glm::vec3(20.0f, 5.0f, 0.0f));
+
+			// Coming back and close enough to see.
+			target->GetComponent<TransformComponent>()->SetPosition(glm::vec3(10.0f, 10.0f, 0.0f));
+			target->GetComponent<KinematicComponent>()->velocity = glm::vec3(5.0f, 100.0f, 0.0f);
+			steering.update(1.0f / 60.0f);
+			CHECK(positionOf(shortSighted) == glm::vec3(20.0f, 10.0f, 0.0f));
+			CHECK(positionOf(lazy) == glm::vec3(20.0f, 10.0f, 0.0f));
+		}
+
+		TEST_CASE("Seekers head for their target or point and ease in within their slowing radius", "[Engine][AI][SteeringSystem]")
+		{
+			Scene scene;
+			auto target = addSteeringTarget(scene, glm::vec3(30.0f, 40.0f, 0.0f), glm::vec3(0.0f));
+
+			auto seeker = scene.addEntity();
+			seeker->AddComponent<TransformComponent>();
+			auto seek = seeker->AddComponent<SeekComponent>();
+			seek->target = target->Id;
+			seek->point = glm::vec3(-10.0f, 0.0f, 0.0f);
+			seek->maxSpeed = 300.0f;
+
+			auto easing = scene.addEntity();
+			easing->AddComponent<TransformComponent>();
+			auto ease = easing->AddComponent<SeekComponent>();
+			ease->point = glm::vec3(0.0f, 10.0f, 0.0f);
+			ease->maxSpeed = 600.0f;
+			ease->slowingRadius = 20.0f;
+
+			SteeringSystem steering(scene);
+			steering.update(1.0f / 60.0f);
+			// Five units along the way to (30, 40).
+			CHECK(positionOf(seeker).x == Catch::Approx(3.0f));
+			CHECK(positionOf(seeker).y == Catch::Approx(4.0f));
+			// Half speed at half the slowing radius.
+			CHECK(positionOf(easing).y == Catch::Approx(5.0f));
+
+			// Falls back to the point once the target is gone.
+			scene.removeEntity(target->Id);
+			scene.update();
+			for (int i = 0; i < 10; ++i)
+			{
+				steering.update(1.0f / 60.0f);
+			}
+			CHECK(positionOf(seeker) == glm::vec3(-10.0f, 0.0f, 0.0f));
+			CHECK(positionOf(easing).y > 9.0f);
+			CHECK(positionOf(easing).y <= 10.0f);
+		}
+
+		TEST_CASE("Patrollers turn around at each end", "[Engine][AI][SteeringSystem]")
+		{
+			Scene scene;
+			auto entity = scene.addEntity();
+			entity->AddComponent<TransformComponent>();
+			auto patrol = entity->AddComponent<PatrolComponent>();
+			patrol->to = glm::vec3(2.0f, 0.0f, 0.0f);
+			patrol->speed = 60.0f;
+
+			SteeringSystem steering(scene);
+			std::vector<float> xs;
+			for (int i = 0; i < 6; ++i)
+			{
+				steering.update(1.0f / 60.0f);
+				xs.push_back(positionOf(entity).x);
+			}
+
+			CHECK(xs == std::vector<float>{ 1.0f, 2.0f, 1.0f, 0.0f, 1.0f, 2.0f });
+			CHECK(entity->GetComponent<PatrolComponent>()->returning);
+		}
+	}
+}
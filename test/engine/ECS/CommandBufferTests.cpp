@@ -0,0 +1,245 @@
+#include <catch2/catch_test_macros.hpp>
+#include <helsinki/Engine/ECS/CommandBuffer.hpp>
+#include <helsinki/Engine/Scene/Scene.hpp>
+#include <string>
+
+namespace hl
+{
+	namespace test
+	{
+		struct CommandPositionComponent : Component
+		{
+			CommandPositionComponent() = default;
+			CommandPositionComponent(float x, float y) : x(x), y(y) {}
+
+			float x{ 0.0f };
+			float y{ 0.0f };
+		};
+
+		struct CommandLabelComponent : Component
+		{
+			std::string label;
+		};
+
+		struct CommandCountedComponent : Component
+		{
+			explicit CommandCountedComponent(int& live) : live(&live) { ++*this->live; }
+			CommandCountedComponent(CommandCountedComponent&& other) noexcept : live(other.live) { ++*live; }
+			~CommandCountedComponent() { --*live; }
+
+			int* live;
+		};
+
+		TEST_CASE("Recorded entities only exist once the buffer is played back", "[Engine][ECS][CommandBuffer]")
+		{
+			Scene scene;
+			CommandBuffer commands;
+
+			auto e = commands.createEntity("Player");
+			commands.addTag(e, "PLAYER");
+			commands.addComponent<CommandPositionComponent>(e, 1.0f, 2.0f);
+			commands.addComponent<CommandLabelComponent>(e).label = std::string(64, 'x');
+
+			CHECK(commands.size() == 4);
+			CHECK(scene.getEntities().empty());
+
+			commands.playback(scene);
+
+			CHECK(commands.empty());
+			REQUIRE(scene.getEntities().size() == 1);
+
+			auto player = scene.getEntity("Player");
+			REQUIRE(player != nullptr);
+			CHECK(player->HasTag("PLAYER"));
+			REQUIRE(player->HasComponents<CommandPositionComponent, CommandLabelComponent>());
+			CHECK(player->GetComponent<CommandPositionComponent>()->x == 1.0f);
+			CHECK(player->GetComponent<CommandPositionComponent>()->y == 2.0f);
+			CHECK(player->GetComponent<CommandLabelComponent>()->label == std::string(64, 'x'));
+			CHECK(scene.getEntitiesByTag("PLAYER").size() == 1);
+		}
+
+		TEST_CASE("Commands apply to existing entities in recorded order", "[Engine][ECS][CommandBuffer]")
+		{
+			Scene scene;
+			CommandBuffer commands;
+
+			auto e = scene.addEntity();
+			e->AddTag("ENEMY");
+			e->AddComponent<CommandLabelComponent>();
+
+			commands.clearTag(e->Id, "ENEMY");
+			commands.addTag(e->Id, "DEAD");
+			commands.removeComponent<CommandLabelComponent>(e->Id);
+			commands.addComponent<CommandPositionComponent>(e->Id, 3.0f, 4.0f);
+
+			CHECK(e->HasTag("ENEMY"));
+			CHECK(e->HasComponent<CommandLabelComponent>());
+
+			commands.playback(scene);
+
+			CHECK_FALSE(e->HasTag("ENEMY"));
+			CHECK(e->HasTag("DEAD"));
+			CHECK_FALSE(e->HasComponent<CommandLabelComponent>());
+			REQUIRE(e->HasComponent<CommandPositionComponent>());
+			CHECK(e->GetComponent<CommandPositionComponent>()->x == 3.0f);
+		}
+
+		TEST_CASE("Adding a component an entity already has keeps the existing one", "[Engine][ECS][CommandBuffer]")
+		{
+			Scene scene;
+			CommandBuffer commands;
+
+			auto e = scene.addEntity();
+			e->AddComponent<CommandPositionComponent>()->x = 5.0f;
+
+			commands.addComponent<CommandPositionComponent>(e->Id, 6.0f, 6.0f);
+			commands.playback(scene);
+
+			CHECK(e->GetComponent<CommandPositionComponent>()->x == 5.0f);
+		}
+
+		TEST_CASE("Destroying an entity is deferred to scene update", "[Engine][ECS][CommandBuffer]")
+		{
+			Scene scene;
+
+			auto e = scene.addEntity("Ball");
+			const auto id = e->Id;
+
+			scene.getCommandBuffer().destroyEntity(id);
+			CHECK(scene.isValid(id));
+
+			scene.update();
+			CHECK_FALSE(scene.isValid(id));
+			CHECK(scene.getEntity("Ball") == nullptr);
+		}
+
+		TEST_CASE("Commands for stale entities are dropped and their components destroyed", "[Engine][ECS][CommandBuffer]")
+		{
+			Scene scene;
+			CommandBuffer commands;
+			int live = 0;
+
+			auto e = scene.addEntity();
+			const auto staleId = e->Id;
+			scene.removeEntity(staleId);
+			scene.update();
+
+			commands.addTag(staleId, "ENEMY");
+			commands.addComponent<CommandCountedComponent>(staleId, live);
+			CHECK(live == 1);
+
+			commands.playback(scene);
+			CHECK(live == 0);
+			CHECK(scene.getEntities().empty());
+		}
+
+		TEST_CASE("Components of a cleared or destroyed buffer are destroyed", "[Engine][ECS][CommandBuffer]")
+		{
+			int live = 0;
+
+			{
+				CommandBuffer commands;
+				auto e = commands.createEntity();
+				commands.addComponent<CommandCountedComponent>(e, live);
+				commands.addComponent<CommandCountedComponent>(e, live);
+				CHECK(live == 2);
+
+				commands.clear();
+				CHECK(live == 0);
+				CHECK(commands.empty());
+
+				commands.addComponent<CommandCountedComponent>(commands.createEntity(), live);
+				CHECK(live == 1);
+			}
+
+			CHECK(live == 0);
+		}
+
+		TEST_CASE("Adopted components are moved into the scene", "[Engine][ECS][CommandBuffer]")
+		{
+			int live = 0;
+
+			{
+				Scene scene;
+				CommandBuffer commands;
+
+				auto e = commands.createEntity("Counted");
+				commands.addComponent<CommandCountedComponent>(e, live);
+				commands.playback(scene);
+
+				auto entity = scene.getEntity("Counted");
+				REQUIRE(entity != nullptr);
+				REQUIRE(entity->HasComponent<CommandCountedComponent>());
+				CHECK(entity->GetComponent<CommandCountedComponent>()->live == &live);
+				CHECK(live == 1);
+			}
+
+			CHECK(live == 0);
+		}
+
+		TEST_CASE("Large components spill into new arena blocks", "[Engine][ECS][CommandBuffer]")
+		{
+			Scene scene;
+			CommandBuffer commands;
+
+			for (int i = 0; i < 2000; ++i)
+			{
+				auto e = commands.createEntity();
+				commands.addComponent<CommandPositionComponent>(e, (float)i, 0.0f);
+				commands.addComponent<CommandLabelComponent>(e).label = std::to_string(i);
+			}
+
+			commands.playback(scene);
+
+			REQUIRE(scene.getEntities().size() == 2000);
+			int matching = 0;
+			scene.forEach<CommandPositionComponent, CommandLabelComponent>(
+				[&](Entity&, CommandPositionComponent& p, CommandLabelComponent& l)
+				{
+					if (std::to_string((int)p.x) == l.label)
+					{
+						matching++;
+					}
+				});
+			CHECK(matching == 2000);
+		}
+
+		struct SpawningSystem : System
+		{
+			SpawningSystem(Scene& scene, std::string tag) : scene(scene), tag(std::move(tag))
+			{
+				access().reads<CommandPositionComponent>();
+			}
+
+			void update(float) override
+			{
+				auto& commands = scene.getCommandBuffer();
+				auto e = commands.createEntity();
+				commands.addTag(e, tag);
+				commands.addComponent<CommandPositionComponent>(e);
+			}
+
+			Scene& scene;
+			std::string tag;
+		};
+
+		TEST_CASE("Systems record into their own buffers which the scene plays back", "[Engine][ECS][CommandBuffer]")
+		{
+			Scene scene;
+			scene.addSystem(new SpawningSystem(scene, "A"));
+			scene.addSystem(new SpawningSystem(scene, "B"));
+
+			scene.update(0.016f);
+
+			CHECK(scene.getEntities().empty());
+			CHECK(&scene.getCommandBuffer() != scene.getScheduler().getCommandBuffers()[0].get());
+
+			scene.update();
+
+			REQUIRE(scene.getEntities().size() == 2);
+			CHECK(scene.getEntities()[0]->HasTag("A"));
+			CHECK(scene.getEntities()[1]->HasTag("B"));
+			CHECK(scene.query<CommandPositionComponent>().size() == 2);
+		}
+	}
+}
@@ -0,0 +1,93 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <helsinki/Engine/Scene/Scene.hpp>
+#include <helsinki/Engine/ECS/Components/TransformComponent.hpp>
+#include <helsinki/Engine/ECS/Components/KinematicComponent.hpp>
+#include <helsinki/Engine/ECS/Components/SpriteComponent.hpp>
+#include <unordered_map>
+#include <memory>
+#include <vector>
+
+namespace hl
+{
+	namespace test
+	{
+		// Mirrors the previous per entity layout, every component is its own heap
+		// allocation found through a hash map, so it can be compared against.
+		struct PointerChasingEntity
+		{
+			std::vector<std::unique_ptr<Component>> components;
+			std::unordered_map<size_t, Component*> componentMap;
+
+			template<typename T>
+			T* AddComponent()
+			{
+				auto component = std::make_unique<T>();
+				T* ptr = component.get();
+				componentMap[Component::GetTypeID<T>()] = ptr;
+				components.push_back(std::move(component));
+				return ptr;
+			}
+
+			template<typename T>
+			T* GetComponent() const
+			{
+				auto it = componentMap.find(Component::GetTypeID<T>());
+				return it == componentMap.end() ? nullptr : static_cast<T*>(it->second);
+			}
+		};
+
+		static void runIterationBenchmark(int entityCount)
+		{
+			const float delta = 1.0f / 60.0f;
+
+			std::vector<std::unique_ptr<PointerChasingEntity>> pointerChasing;
+			Scene scene;
+
+			for (int i = 0; i < entityCount; ++i)
+			{
+				auto& legacy = pointerChasing.emplace_back(std::make_unique<PointerChasingEntity>());
+				legacy->AddComponent<SpriteComponent>();
+				legacy->AddComponent<TransformComponent>()->SetPosition(glm::vec3((float)i, 0.0f, 0.0f));
+				legacy->AddComponent<KinematicComponent>()->velocity = glm::vec3(1.0f, 2.0f, 0.0f);
+
+				auto e = scene.addEntity();
+				e->AddComponent<SpriteComponent>();
+				e->AddComponent<TransformComponent>()->SetPosition(glm::vec3((float)i, 0.0f, 0.0f));
+				e->AddComponent<KinematicComponent>()->velocity = glm::vec3(1.0f, 2.0f, 0.0f);
+			}
+
+			BENCHMARK("Pointer chasing components " + std::to_string(entityCount))
+			{
+				for (const auto& e : pointerChasing)
+				{
+					auto tc = e->GetComponent<TransformComponent>();
+					auto kc = e->GetComponent<KinematicComponent>();
+					if (tc != nullptr && kc != nullptr)
+					{
+						tc->SetPosition(tc->GetPosition() + kc->velocity * delta);
+					}
+				}
+				return pointerChasing.size();
+			};
+
+			BENCHMARK("Archetype chunk components " + std::to_string(entityCount))
+			{
+				size_t count = 0;
+				scene.forEach<TransformComponent, KinematicComponent>([&](Entity&, TransformComponent& tc, KinematicComponent& kc)
+					{
+						tc.SetPosition(tc.GetPosition() + kc.velocity * delta);
+						count++;
+					});
+				return count;
+			};
+		}
+
+		TEST_CASE("Transform and kinematic iteration", "[.][benchmark][Engine][ECS][ComponentStorage]")
+		{
+			runIterationBenchmark(1000);
+			runIterationBenchmark(10000);
+			runIterationBenchmark(100000);
+		}
+	}
+}
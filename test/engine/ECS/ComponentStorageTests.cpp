@@ -0,0 +1,187 @@
+#include <catch2/catch_test_macros.hpp>
+#include <helsinki/Engine/Scene/Scene.hpp>
+#include <string>
+
+namespace hl
+{
+	namespace test
+	{
+		struct PositionComponent : Component
+		{
+			PositionComponent() = default;
+			PositionComponent(float x, float y) : X(x), Y(y) {}
+			float X{ 0.0f };
+			float Y{ 0.0f };
+		};
+
+		struct VelocityComponent : Component
+		{
+			float X{ 0.0f };
+			float Y{ 0.0f };
+		};
+
+		struct NameComponent : Component
+		{
+			std::string Value;
+		};
+
+		TEST_CASE("Added components can be retrieved", "[Engine][ECS][ComponentStorage]")
+		{
+			Scene scene;
+
+			auto e = scene.addEntity();
+			e->AddComponent<PositionComponent>(1.0f, 2.0f);
+
+			REQUIRE(e->HasComponent<PositionComponent>());
+			CHECK_FALSE(e->HasComponent<VelocityComponent>());
+			CHECK(e->GetComponent<PositionComponent>()->X == 1.0f);
+			CHECK(e->GetComponent<PositionComponent>()->Y == 2.0f);
+			CHECK(e->GetComponent<VelocityComponent>() == nullptr);
+		}
+
+		TEST_CASE("Adding an existing component returns the existing instance", "[Engine][ECS][ComponentStorage]")
+		{
+			Scene scene;
+
+			auto e = scene.addEntity();
+			e->AddComponent<PositionComponent>(1.0f, 2.0f);
+			auto again = e->AddComponent<PositionComponent>(5.0f, 6.0f);
+
+			CHECK(again->X == 1.0f);
+			CHECK(e->getLocation().archetype->getSignature().size() == 1);
+		}
+
+		TEST_CASE("Component values survive archetype migration", "[Engine][ECS][ComponentStorage]")
+		{
+			Scene scene;
+
+			auto e = scene.addEntity();
+			e->AddComponent<NameComponent>()->Value = "a name long enough to not use the small string buffer";
+			e->AddComponent<PositionComponent>(3.0f, 4.0f);
+			e->AddComponent<VelocityComponent>()->X = 7.0f;
+
+			REQUIRE(e->HasComponents<NameComponent, PositionComponent, VelocityComponent>());
+			CHECK(e->GetComponent<NameComponent>()->Value == "a name long enough to not use the small string buffer");
+			CHECK(e->GetComponent<PositionComponent>()->X == 3.0f);
+			CHECK(e->GetComponent<VelocityComponent>()->X == 7.0f);
+
+			REQUIRE(e->RemoveComponent<PositionComponent>());
+			CHECK_FALSE(e->RemoveComponent<PositionComponent>());
+			CHECK_FALSE(e->HasComponent<PositionComponent>());
+			CHECK(e->GetComponent<NameComponent>()->Value == "a name long enough to not use the small string buffer");
+			CHECK(e->GetComponent<VelocityComponent>()->X == 7.0f);
+		}
+
+		TEST_CASE("Adding several components at once keeps every returned pointer valid", "[Engine][ECS][ComponentStorage]")
+		{
+			Scene scene;
+
+			auto e = scene.addEntity();
+			e->AddComponent<PositionComponent>(1.0f, 2.0f);
+			NameComponent name;
+			name.Value = "a name long enough to not use the small string buffer";
+			auto [position, velocity, named] = e->AddComponents(PositionComponent(5.0f, 6.0f), VelocityComponent(), std::move(name));
+
+			// Set through the pointers after the move, not before it.
+			velocity->X = 7.0f;
+			CHECK(position == e->GetComponent<PositionComponent>());
+			CHECK(position->X == 1.0f);
+			CHECK(e->GetComponent<VelocityComponent>()->X == 7.0f);
+			CHECK(named->Value == "a name long enough to not use the small string buffer");
+			CHECK(named->GetOwner() == e);
+			CHECK(velocity->GetOwner() == e);
+
+			auto other = scene.addEntity();
+			auto [otherVelocity, otherPosition] = other->AddComponents<VelocityComponent, PositionComponent>();
+			otherPosition->X = 3.0f;
+			otherVelocity->Y = 4.0f;
+			CHECK(other->GetComponent<PositionComponent>()->X == 3.0f);
+			CHECK(other->GetComponent<VelocityComponent>()->Y == 4.0f);
+			CHECK(other->getLocation().archetype->getSignature().size() == 2);
+		}
+
+		TEST_CASE("Entities with the same components share an archetype", "[Engine][ECS][ComponentStorage]")
+		{
+			Scene scene;
+
+			auto a = scene.addEntity();
+			a->AddComponent<PositionComponent>();
+			a->AddComponent<VelocityComponent>();
+
+			auto b = scene.addEntity();
+			b->AddComponent<VelocityComponent>();
+			b->AddComponent<PositionComponent>();
+
+			CHECK(a->getLocation().archetype == b->getLocation().archetype);
+			CHECK(a->getLocation().row != b->getLocation().row);
+		}
+
+		TEST_CASE("Removing an entity back fills its row without disturbing other entities", "[Engine][ECS][ComponentStorage]")
+		{
+			Scene scene;
+
+			std::vector<Entity*> entities;
+			for (int i = 0; i < 1000; ++i)
+			{
+				auto e = scene.addEntity();
+				e->AddComponent<PositionComponent>((float)e->Id, 0.0f);
+				e->AddComponent<VelocityComponent>();
+				entities.push_back(e);
+			}
+
+			REQUIRE(entities.front()->getLocation().archetype->getChunkCount() > 1);
+
+			for (int i = 0; i < 1000; i += 3)
+			{
+				scene.removeEntity(entities[i]->Id);
+			}
+			scene.update();
+
+			CHECK(scene.getEntities().size() == 666);
+			for (const auto& e : scene.getEntities())
+			{
+				CHECK(e->GetComponent<PositionComponent>()->X == (float)e->Id);
+				CHECK(e->getLocation().archetype->getEntity(e->getLocation().row) == e.get());
+			}
+		}
+
+		TEST_CASE("forEach visits only entities with every requested component", "[Engine][ECS][ComponentStorage]")
+		{
+			Scene scene;
+
+			for (int i = 0; i < 600; ++i)
+			{
+				auto e = scene.addEntity();
+				e->AddComponent<PositionComponent>(1.0f, 1.0f);
+				if (i % 2 == 0)
+				{
+					e->AddComponent<VelocityComponent>()->X = 2.0f;
+				}
+				if (i % 3 == 0)
+				{
+					e->AddComponent<NameComponent>();
+				}
+			}
+
+			int visited = 0;
+			scene.forEach<PositionComponent, VelocityComponent>([&](Entity& e, PositionComponent& p, VelocityComponent& v)
+				{
+					CHECK(e.GetComponent<PositionComponent>() == &p);
+					p.X += v.X;
+					visited++;
+				});
+
+			CHECK(visited == 300);
+
+			int moved = 0;
+			for (const auto& e : scene.getEntities())
+			{
+				if (e->GetComponent<PositionComponent>()->X == 3.0f)
+				{
+					moved++;
+				}
+			}
+			CHECK(moved == 300);
+		}
+	}
+}
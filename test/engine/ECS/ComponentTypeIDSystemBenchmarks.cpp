@@ -0,0 +1,68 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <helsinki/Engine/Scene/Scene.hpp>
+#include <helsinki/Engine/ECS/Components/TransformComponent.hpp>
+#include <helsinki/Engine/ECS/Components/KinematicComponent.hpp>
+#include <helsinki/Engine/ECS/Components/SpriteComponent.hpp>
+#include <unordered_map>
+#include <vector>
+
+namespace hl
+{
+	namespace test
+	{
+		TEST_CASE("Filter entities by a three component signature", "[.][benchmark][Engine][ECS][ComponentTypeIDSystem]")
+		{
+			Scene scene;
+			for (int i = 0; i < 100000; ++i)
+			{
+				auto e = scene.addEntity();
+				e->AddComponent<TransformComponent>();
+				if (i % 2 == 0)
+				{
+					e->AddComponent<KinematicComponent>();
+				}
+				if (i % 3 == 0)
+				{
+					e->AddComponent<SpriteComponent>();
+				}
+			}
+
+			// Mirrors the previous per entity component map, one hashed search per requested type.
+			std::vector<std::unordered_map<size_t, size_t>> entityColumns;
+			for (const auto& e : scene.getEntities())
+			{
+				auto& columns = entityColumns.emplace_back();
+				const auto& types = e->getLocation().archetype->getTypes();
+				for (size_t i = 0; i < types.size(); ++i)
+				{
+					columns[types[i]->id] = i;
+				}
+			}
+
+			const auto transformId = ComponentTypeIDSystem::GetTypeID<TransformComponent>();
+			const auto kinematicId = ComponentTypeIDSystem::GetTypeID<KinematicComponent>();
+			const auto spriteId = ComponentTypeIDSystem::GetTypeID<SpriteComponent>();
+
+			BENCHMARK("Hash lookup per type 100k")
+			{
+				size_t matches = 0;
+				for (const auto& columns : entityColumns)
+				{
+					matches += columns.contains(transformId) && columns.contains(kinematicId) && columns.contains(spriteId);
+				}
+				return matches;
+			};
+
+			BENCHMARK("Signature mask test 100k")
+			{
+				size_t matches = 0;
+				for (const auto& e : scene.getEntities())
+				{
+					matches += e->HasComponents<TransformComponent, KinematicComponent, SpriteComponent>();
+				}
+				return matches;
+			};
+		}
+	}
+}
@@ -0,0 +1,57 @@
+#include <catch2/catch_test_macros.hpp>
+#include <helsinki/Engine/Scene/Scene.hpp>
+
+namespace hl
+{
+	namespace test
+	{
+		struct MaskAComponent : Component {};
+		struct MaskBComponent : Component {};
+		struct MaskCComponent : Component {};
+
+		TEST_CASE("Component type ids are stable compile time hashes", "[Engine][ECS][ComponentTypeIDSystem]")
+		{
+			STATIC_REQUIRE(ComponentTypeIDSystem::GetTypeID<MaskAComponent>() == (size_t)TypeId::Get<MaskAComponent>());
+			STATIC_REQUIRE(ComponentTypeIDSystem::GetTypeID<MaskAComponent>() != ComponentTypeIDSystem::GetTypeID<MaskBComponent>());
+		}
+
+		TEST_CASE("Component type indices are dense and reused", "[Engine][ECS][ComponentTypeIDSystem]")
+		{
+			const auto a = ComponentTypeIDSystem::GetTypeIndex<MaskAComponent>();
+			const auto b = ComponentTypeIDSystem::GetTypeIndex<MaskBComponent>();
+
+			CHECK(a != b);
+			CHECK(a < ComponentTypeIDSystem::GetRegisteredTypeCount());
+			CHECK(b < ComponentTypeIDSystem::GetRegisteredTypeCount());
+			CHECK(ComponentTypeIDSystem::GetTypeIndex<MaskAComponent>() == a);
+
+			const auto& mask = GetComponentMask<MaskAComponent, MaskBComponent>();
+			CHECK(mask.count() == 2);
+			CHECK(mask.test(a));
+			CHECK(mask.test(b));
+		}
+
+		TEST_CASE("HasComponents tests the archetype signature", "[Engine][ECS][ComponentTypeIDSystem]")
+		{
+			Scene scene;
+
+			auto e = scene.addEntity();
+			CHECK(e->HasComponents<>());
+			CHECK_FALSE(e->HasComponents<MaskAComponent>());
+
+			e->AddComponent<MaskAComponent>();
+			e->AddComponent<MaskCComponent>();
+
+			CHECK(e->HasComponents<MaskAComponent>());
+			CHECK(e->HasComponents<MaskCComponent, MaskAComponent>());
+			CHECK_FALSE(e->HasComponents<MaskAComponent, MaskBComponent, MaskCComponent>());
+
+			e->AddComponent<MaskBComponent>();
+			CHECK(e->HasComponents<MaskAComponent, MaskBComponent, MaskCComponent>());
+
+			e->RemoveComponent<MaskCComponent>();
+			CHECK_FALSE(e->HasComponents<MaskAComponent, MaskBComponent, MaskCComponent>());
+			CHECK(e->HasComponents<MaskAComponent, MaskBComponent>());
+		}
+	}
+}
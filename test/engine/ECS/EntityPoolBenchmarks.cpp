@@ -0,0 +1,95 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <helsinki/Engine/Scene/Scene.hpp>
+#include <helsinki/Engine/ECS/Components/TransformComponent.hpp>
+#include <helsinki/Engine/ECS/Components/KinematicComponent.hpp>
+#include <helsinki/Engine/ECS/Components/SpriteComponent.hpp>
+#include <string>
+
+namespace hl
+{
+	namespace test
+	{
+		struct PoolBenchmarkCollisionComponent : Component
+		{
+			uint32_t layer{ 0 };
+			uint32_t mask{ 0 };
+		};
+
+		struct PoolBenchmarkSpriteNameComponent : Component
+		{
+			std::string name;
+			glm::vec2 size{ 0.0f };
+		};
+
+		TEST_CASE("Projectile spawning", "[.][benchmark][Engine][ECS][EntityPool]")
+		{
+			// A frame's worth of projectiles for a bullet hell, shaped like Hurricane's.
+			const int projectileCount = 1000;
+
+			Scene built;
+			auto builtProjectiles = built.query<TransformComponent>("PROJECTILE");
+
+			BENCHMARK("Command buffer build and remove 1k")
+			{
+				auto& commands = built.getCommandBuffer();
+				for (int i = 0; i < projectileCount; ++i)
+				{
+					auto e = commands.createEntity();
+					commands.addTag(e, "PROJECTILE");
+					commands.addTag(e, "COLLIDER");
+					commands.addTag(e, "SPRITE");
+					commands.addComponent<TransformComponent>(e).SetPosition(glm::vec3((float)i, 0.0f, 0.0f));
+					commands.addComponent<KinematicComponent>(e).velocity = { 0.0f, -384.0f, 0.0f };
+					commands.addComponent<SpriteComponent>(e);
+					auto& collision = commands.addComponent<PoolBenchmarkCollisionComponent>(e);
+					collision.layer = 4;
+					collision.mask = 2;
+					auto& sprite = commands.addComponent<PoolBenchmarkSpriteNameComponent>(e);
+					sprite.name = "laserBlue01";
+					sprite.size = { 9.0f, 54.0f };
+				}
+				built.update();
+
+				for (auto e : builtProjectiles)
+				{
+					built.removeEntity(e->Id);
+				}
+				built.update();
+				return built.getEntities().size();
+			};
+
+			Scene pooled;
+			Prefab prefab;
+			prefab.addTag("PROJECTILE").addTag("COLLIDER").addTag("SPRITE");
+			prefab.addComponent<TransformComponent>();
+			prefab.addComponent<KinematicComponent>().velocity = { 0.0f, -384.0f, 0.0f };
+			prefab.addComponent<SpriteComponent>();
+			auto& collision = prefab.addComponent<PoolBenchmarkCollisionComponent>();
+			collision.layer = 4;
+			collision.mask = 2;
+			auto& sprite = prefab.addComponent<PoolBenchmarkSpriteNameComponent>();
+			sprite.name = "laserBlue01";
+			sprite.size = { 9.0f, 54.0f };
+			auto& pool = pooled.createPool(std::move(prefab), projectileCount);
+			auto pooledProjectiles = pooled.query<TransformComponent>("PROJECTILE");
+
+			BENCHMARK("Pool spawn and remove 1k")
+			{
+				auto& commands = pooled.getCommandBuffer();
+				for (int i = 0; i < projectileCount; ++i)
+				{
+					commands.setComponent<TransformComponent>(commands.spawn(pool)).SetPosition(glm::vec3((float)i, 0.0f, 0.0f));
+				}
+				pooled.update();
+
+				for (auto e : pooledProjectiles)
+				{
+					pooled.removeEntity(e->Id);
+				}
+				pooled.update();
+				return pooled.getEntities().size();
+			};
+		}
+	}
+}
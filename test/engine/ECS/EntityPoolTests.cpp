@@ -0,0 +1,173 @@
+#include <catch2/catch_test_macros.hpp>
+#include <helsinki/Engine/Scene/Scene.hpp>
+#include <string>
+#include <vector>
+
+namespace hl
+{
+	namespace test
+	{
+		struct PoolPositionComponent : Component
+		{
+			float x{ 0.0f };
+			float y{ 0.0f };
+		};
+
+		struct PoolHealthComponent : Component
+		{
+			PoolHealthComponent() = default;
+			explicit PoolHealthComponent(int health) : health(health) {}
+
+			int health{ 0 };
+			std::string name;
+		};
+
+		struct PoolExtraComponent : Component {};
+
+		static Prefab makePoolPrefab()
+		{
+			Prefab prefab;
+			prefab.addTag("BULLET").addTag("COLLIDER");
+			prefab.addComponent<PoolPositionComponent>().y = 5.0f;
+			prefab.addComponent<PoolHealthComponent>(3).name = std::string(40, 'b');
+			return prefab;
+		}
+
+		TEST_CASE("Pooled entities only exist in the scene once spawned", "[Engine][ECS][EntityPool]")
+		{
+			Scene scene;
+			auto positions = scene.query<PoolPositionComponent>();
+
+			auto& pool = scene.createPool(makePoolPrefab(), 8);
+
+			CHECK(pool.getStats().capacity == 8);
+			CHECK(pool.getAvailable() == 8);
+			CHECK(scene.getEntities().empty());
+			CHECK(positions.size() == 0);
+			CHECK(scene.getEntitiesByTag("BULLET").empty());
+
+			auto e = scene.spawn(pool);
+
+			REQUIRE(scene.getEntity(e->Id) == e);
+			CHECK(e->HasTag("BULLET"));
+			CHECK(e->HasTag("COLLIDER"));
+			CHECK(e->GetComponent<PoolPositionComponent>()->y == 5.0f);
+			CHECK(e->GetComponent<PoolPositionComponent>()->GetOwner() == e);
+			CHECK(e->GetComponent<PoolHealthComponent>()->health == 3);
+			CHECK(e->GetComponent<PoolHealthComponent>()->name == std::string(40, 'b'));
+			CHECK(positions.size() == 1);
+			CHECK(scene.getEntitiesByTag("BULLET").size() == 1);
+			CHECK(pool.getAvailable() == 7);
+			CHECK(pool.getStats().active == 1);
+			CHECK(pool.getStats().spawns == 1);
+		}
+
+		TEST_CASE("Removing a pooled entity returns it to be spawned again from the prefab", "[Engine][ECS][EntityPool]")
+		{
+			Scene scene;
+			auto positions = scene.query<PoolPositionComponent>();
+			auto& pool = scene.createPool(makePoolPrefab(), 2);
+
+			auto first = scene.spawn(pool);
+			const auto firstId = first->Id;
+			first->GetComponent<PoolPositionComponent>()->y = 100.0f;
+			first->GetComponent<PoolHealthComponent>()->health = 0;
+			first->AddTag("HIT");
+
+			scene.removeEntity(firstId);
+			scene.update();
+
+			CHECK(scene.getEntity(firstId) == nullptr);
+			CHECK(scene.getEntities().empty());
+			CHECK(positions.size() == 0);
+			CHECK(scene.getEntitiesByTag("BULLET").empty());
+			CHECK(scene.getEntitiesByTag("HIT").empty());
+			CHECK(pool.getAvailable() == 2);
+			CHECK(pool.getStats().active == 0);
+
+			// Two spawns use both entities, whichever was returned last included.
+			auto a = scene.spawn(pool);
+			auto b = scene.spawn(pool);
+			for (auto e : { a, b })
+			{
+				CHECK(e->Id != firstId);
+				CHECK(e->GetComponent<PoolPositionComponent>()->y == 5.0f);
+				CHECK(e->GetComponent<PoolHealthComponent>()->health == 3);
+				CHECK_FALSE(e->HasTag("HIT"));
+			}
+			CHECK(scene.getEntity(firstId) == nullptr);
+			CHECK(positions.size() == 2);
+			CHECK(pool.getStats().grows == 0);
+			CHECK(pool.getStats().peak == 2);
+		}
+
+		TEST_CASE("An empty pool grows by an entity at a time", "[Engine][ECS][EntityPool]")
+		{
+			Scene scene;
+			auto& pool = scene.createPool(makePoolPrefab(), 1);
+
+			std::vector<int> ids;
+			for (int i = 0; i < 4; ++i)
+			{
+				ids.push_back(scene.spawn(pool)->Id);
+			}
+
+			CHECK(pool.getStats().capacity == 4);
+			CHECK(pool.getStats().grows == 3);
+			CHECK(pool.getStats().active == 4);
+			CHECK(pool.getAvailable() == 0);
+
+			for (auto id : ids)
+			{
+				scene.removeEntity(id);
+			}
+			scene.update();
+
+			CHECK(pool.getAvailable() == 4);
+			scene.spawn(pool);
+			CHECK(pool.getStats().grows == 3);
+		}
+
+		TEST_CASE("Entities no longer matching their prefab are destroyed rather than returned", "[Engine][ECS][EntityPool]")
+		{
+			Scene scene;
+			auto& pool = scene.createPool(makePoolPrefab(), 2);
+
+			auto e = scene.spawn(pool);
+			e->AddComponent<PoolExtraComponent>();
+			scene.removeEntity(e->Id);
+			scene.update();
+
+			CHECK(pool.getStats().capacity == 1);
+			CHECK(pool.getAvailable() == 1);
+			CHECK(scene.query<PoolExtraComponent>().size() == 0);
+		}
+
+		TEST_CASE("Command buffers spawn from pools and set the spawned components", "[Engine][ECS][EntityPool]")
+		{
+			Scene scene;
+			auto& pool = scene.createPool(makePoolPrefab(), 4);
+			CommandBuffer commands;
+
+			auto spawned = commands.spawn(pool);
+			commands.setComponent<PoolPositionComponent>(spawned).x = 7.0f;
+			commands.addTag(spawned, "AIMED");
+			commands.setComponent<PoolExtraComponent>(spawned);
+
+			CHECK(scene.getEntities().empty());
+			commands.playback(scene);
+
+			REQUIRE(scene.getEntities().size() == 1);
+			auto e = scene.getEntities().front().get();
+			CHECK(e->GetComponent<PoolPositionComponent>()->x == 7.0f);
+			// Replaced as a whole rather than merged with the prefab's value.
+			CHECK(e->GetComponent<PoolPositionComponent>()->y == 0.0f);
+			CHECK(e->GetComponent<PoolPositionComponent>()->GetOwner() == e);
+			CHECK(e->GetComponent<PoolHealthComponent>()->health == 3);
+			// Components the prefab does not have are added.
+			CHECK(e->HasComponent<PoolExtraComponent>());
+			CHECK(e->HasTag("AIMED"));
+			CHECK(e->HasTag("BULLET"));
+		}
+	}
+}
@@ -0,0 +1,243 @@
+#include <catch2/catch_test_macros.hpp>
+#include <helsinki/Engine/Scene/Scene.hpp>
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+namespace hl
+{
+	namespace test
+	{
+		struct QueryPositionComponent : Component
+		{
+			float X{ 0.0f };
+		};
+
+		struct QueryVelocityComponent : Component
+		{
+			float X{ 0.0f };
+		};
+
+		struct QueryHealthComponent : Component
+		{
+			int Value{ 0 };
+		};
+
+		TEST_CASE("Query picks up archetypes created after it was registered", "[Engine][ECS][Query]")
+		{
+			Scene scene;
+
+			const auto query = scene.query<QueryPositionComponent, QueryVelocityComponent>();
+			CHECK(query.empty());
+			CHECK(query.size() == 0);
+
+			auto a = scene.addEntity();
+			a->AddComponent<QueryPositionComponent>();
+			a->AddComponent<QueryVelocityComponent>();
+
+			auto b = scene.addEntity();
+			b->AddComponent<QueryPositionComponent>();
+
+			auto c = scene.addEntity();
+			c->AddComponent<QueryHealthComponent>();
+			c->AddComponent<QueryVelocityComponent>();
+			c->AddComponent<QueryPositionComponent>();
+
+			std::vector<Entity*> matched(query.begin(), query.end());
+			CHECK(query.size() == 2);
+			REQUIRE(matched.size() == 2);
+			CHECK(std::find(matched.begin(), matched.end(), a) != matched.end());
+			CHECK(std::find(matched.begin(), matched.end(), c) != matched.end());
+
+			b->AddComponent<QueryVelocityComponent>();
+			CHECK(query.size() == 3);
+
+			a->RemoveComponent<QueryVelocityComponent>();
+			CHECK(query.size() == 2);
+		}
+
+		TEST_CASE("Query registered after entities exist matches them", "[Engine][ECS][Query]")
+		{
+			Scene scene;
+
+			for (int i = 0; i < 10; ++i)
+			{
+				auto e = scene.addEntity();
+				e->AddComponent<QueryPositionComponent>();
+				if (i % 2 == 0)
+				{
+					e->AddComponent<QueryHealthComponent>();
+				}
+			}
+
+			CHECK(scene.query<QueryPositionComponent>().size() == 10);
+			CHECK(scene.query<QueryHealthComponent>().size() == 5);
+			CHECK(scene.getEntitiesWithComponents<QueryPositionComponent, QueryHealthComponent>().size() == 5);
+		}
+
+		TEST_CASE("Tagged query only visits entities with the tag", "[Engine][ECS][Query]")
+		{
+			Scene scene;
+
+			const auto enemies = scene.query<QueryPositionComponent>("ENEMY");
+
+			for (int i = 0; i < 9; ++i)
+			{
+				auto e = scene.addEntity();
+				e->AddComponent<QueryPositionComponent>()->X = (float)i;
+				if (i % 3 == 0)
+				{
+					e->AddTag("ENEMY");
+				}
+			}
+
+			CHECK(enemies.size() == 3);
+
+			float total = 0.0f;
+			enemies.each([&](Entity& e, QueryPositionComponent& p)
+				{
+					CHECK(e.HasTag("ENEMY"));
+					total += p.X;
+				});
+			CHECK(total == 0.0f + 3.0f + 6.0f);
+
+			scene.getEntities().front()->ClearTag("ENEMY");
+			CHECK(enemies.size() == 2);
+			CHECK(scene.getEntitiesWithComponents<QueryPositionComponent>("ENEMY").size() == 2);
+		}
+
+		TEST_CASE("Requesting the same query twice shares the registration", "[Engine][ECS][Query]")
+		{
+			Scene scene;
+
+			auto e = scene.addEntity();
+			e->AddComponent<QueryPositionComponent>();
+
+			const auto first = scene.query<QueryPositionComponent>();
+			const auto second = scene.query<QueryPositionComponent>();
+
+			CHECK(first.begin() == second.begin());
+			CHECK(first.end() == second.end());
+		}
+
+		TEST_CASE("Query reflects removed entities after the scene update", "[Engine][ECS][Query]")
+		{
+			Scene scene;
+
+			const auto query = scene.query<QueryPositionComponent, QueryVelocityComponent>();
+
+			for (int i = 0; i < 100; ++i)
+			{
+				auto e = scene.addEntity();
+				e->AddComponent<QueryPositionComponent>();
+				e->AddComponent<QueryVelocityComponent>()->X = 1.0f;
+			}
+
+			query.each([&](Entity& e, QueryPositionComponent&, QueryVelocityComponent&)
+				{
+					if (e.Id % 2 == 0)
+					{
+						scene.removeEntity(e.Id);
+					}
+				});
+
+			CHECK(query.size() == 100);
+			scene.update();
+			CHECK(query.size() == 50);
+
+			for (auto e : query.entities())
+			{
+				CHECK(e->Id % 2 != 0);
+			}
+		}
+
+		TEST_CASE("Query eachChunk hands over the packed arrays of every chunk", "[Engine][ECS][Query]")
+		{
+			Scene scene;
+
+			const auto query = scene.query<QueryPositionComponent, QueryVelocityComponent>();
+
+			std::vector<int> expected;
+			for (int i = 0; i < 1000; ++i)
+			{
+				auto e = scene.addEntity();
+				e->AddComponent<QueryPositionComponent>();
+				e->AddComponent<QueryVelocityComponent>()->X = (float)i;
+				if (i % 3 == 0)
+				{
+					e->AddComponent<QueryHealthComponent>();
+				}
+				expected.push_back(e->Id);
+			}
+
+			std::vector<int> visited;
+			query.eachChunk([&](Entity** entities, QueryPositionComponent* positions, QueryVelocityComponent* velocities, uint32_t count)
+				{
+					for (uint32_t i = 0; i < count; ++i)
+					{
+						positions[i].X += velocities[i].X;
+						visited.push_back(entities[i]->Id);
+					}
+				});
+
+			std::sort(visited.begin(), visited.end());
+			std::sort(expected.begin(), expected.end());
+			CHECK(visited == expected);
+
+			query.each([&](Entity&, QueryPositionComponent& p, QueryVelocityComponent& v)
+				{
+					CHECK(p.X == v.X);
+				});
+		}
+
+		TEST_CASE("Tagged queries match whole archetypes and follow tags as they change", "[Engine][ECS][Query]")
+		{
+			Scene scene;
+
+			const auto enemies = scene.query<QueryPositionComponent>("ENEMY");
+			const auto all = scene.query<QueryPositionComponent>();
+
+			std::vector<Entity*> entities;
+			for (int i = 0; i < 1000; ++i)
+			{
+				auto e = scene.addEntity();
+				e->AddComponent<QueryPositionComponent>()->X = (float)i;
+				if (i % 4 == 0)
+				{
+					e->AddTag("ENEMY");
+				}
+				if (i % 5 == 0)
+				{
+					e->AddTag("BOSS");
+				}
+				entities.push_back(e);
+			}
+
+			CHECK(enemies.size() == 250);
+			CHECK(all.size() == 1000);
+
+			// Every row handed over has the tag, without the query checking any.
+			uint32_t rows = 0;
+			enemies.eachChunk([&](Entity** chunkEntities, QueryPositionComponent* positions, uint32_t count)
+				{
+					for (uint32_t i = 0; i < count; ++i)
+					{
+						CHECK(chunkEntities[i]->HasTag("ENEMY"));
+						CHECK((int)positions[i].X % 4 == 0);
+					}
+					rows += count;
+				});
+			CHECK(rows == 250);
+
+			// Tagging moves the entity along with its components.
+			entities[1]->AddTag("ENEMY");
+			entities[0]->ClearTag("ENEMY");
+			entities[0]->ClearTag("ENEMY");
+			CHECK(enemies.size() == 250);
+			CHECK(entities[1]->GetComponent<QueryPositionComponent>()->X == 1.0f);
+			CHECK(entities[1]->getLocation().archetype == entities[4]->getLocation().archetype);
+			CHECK(entities[0]->getLocation().archetype == entities[5]->getLocation().archetype);
+			CHECK(entities[0]->GetComponent<QueryPositionComponent>()->X == 0.0f);
+		}
+	}
+}
@@ -0,0 +1,163 @@
+#include <catch2/catch_test_macros.hpp>
+#include <helsinki/Engine/ECS/SystemScheduler.hpp>
+#include <stdexcept>
+#include <chrono>
+#include <thread>
+#include <string>
+
+namespace hl
+{
+	namespace test
+	{
+		struct SchedulerPositionComponent : Component {};
+		struct SchedulerVelocityComponent : Component {};
+
+		struct SchedulerLog
+		{
+			std::mutex mutex;
+			std::vector<std::string> entries;
+			std::atomic<int> running{ 0 };
+			std::atomic<int> maxRunning{ 0 };
+
+			void record(const std::string& entry)
+			{
+				const auto now = ++running;
+				auto seen = maxRunning.load();
+				while (now > seen && !maxRunning.compare_exchange_weak(seen, now)) {}
+
+				std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+				{
+					std::lock_guard lock(mutex);
+					entries.push_back(entry);
+				}
+				--running;
+			}
+
+			size_t indexOf(const std::string& entry)
+			{
+				return (size_t)std::distance(entries.begin(), std::find(entries.begin(), entries.end(), entry));
+			}
+		};
+
+		struct RecordingSystem : System
+		{
+			RecordingSystem(SchedulerLog& log, std::string name) : log(log), name(std::move(name)) {}
+
+			void update(float) override { log.record(name); }
+
+			SystemAccess& declare() { return access(); }
+
+			SchedulerLog& log;
+			std::string name;
+		};
+
+		TEST_CASE("Conflicting access is detected per component", "[Engine][ECS][SystemScheduler]")
+		{
+			SystemAccess exclusive;
+
+			SystemAccess positionWriter;
+			positionWriter.writes<SchedulerPositionComponent>();
+
+			SystemAccess reader;
+			reader.reads<SchedulerPositionComponent, SchedulerVelocityComponent>();
+
+			SystemAccess velocityWriter;
+			velocityWriter.writes<SchedulerVelocityComponent>();
+
+			CHECK(exclusive.isExclusive());
+			CHECK(exclusive.conflictsWith(reader));
+			CHECK(positionWriter.conflictsWith(positionWriter));
+			CHECK(positionWriter.conflictsWith(reader));
+			CHECK_FALSE(positionWriter.conflictsWith(velocityWriter));
+			CHECK(reader.conflictsWith(velocityWriter));
+			CHECK_FALSE(reader.conflictsWith(reader));
+		}
+
+		TEST_CASE("Non conflicting systems run concurrently and conflicting ones in order", "[Engine][ECS][SystemScheduler]")
+		{
+			ThreadPool pool(4);
+			SchedulerLog log;
+
+			std::vector<std::unique_ptr<System>> systems;
+			auto add = [&](const std::string& name) -> RecordingSystem&
+				{
+					return static_cast<RecordingSystem&>(*systems.emplace_back(std::make_unique<RecordingSystem>(log, name)));
+				};
+
+			add("enemies").declare().writes<SchedulerPositionComponent>();
+			add("projectiles").declare().writes<SchedulerVelocityComponent>();
+			add("render").declare().reads<SchedulerPositionComponent, SchedulerVelocityComponent>();
+			add("spawn");
+			add("after spawn").declare().reads<SchedulerVelocityComponent>();
+
+			SystemScheduler scheduler;
+			scheduler.setThreadPool(&pool);
+
+			for (int frame = 0; frame < 5; ++frame)
+			{
+				log.entries.clear();
+				scheduler.update(systems, 1.0f / 60.0f);
+
+				REQUIRE(log.entries.size() == 5);
+				CHECK(log.indexOf("render") > log.indexOf("enemies"));
+				CHECK(log.indexOf("render") > log.indexOf("projectiles"));
+				CHECK(log.indexOf("spawn") == 3);
+				CHECK(log.indexOf("after spawn") == 4);
+			}
+
+			CHECK(log.maxRunning.load() == 2);
+
+			const auto& timings = scheduler.getTimings();
+			REQUIRE(timings.size() == 5);
+			for (const auto& timing : timings)
+			{
+				CHECK(timing.milliseconds > 0.0);
+			}
+			CHECK(scheduler.getLastUpdateMilliseconds() > 0.0);
+		}
+
+		TEST_CASE("Serial scheduling runs systems one at a time in order", "[Engine][ECS][SystemScheduler]")
+		{
+			SchedulerLog log;
+
+			std::vector<std::unique_ptr<System>> systems;
+			for (const auto name : { "a", "b", "c" })
+			{
+				auto system = std::make_unique<RecordingSystem>(log, name);
+				system->declare().reads<SchedulerPositionComponent>();
+				systems.push_back(std::move(system));
+			}
+
+			SystemScheduler scheduler;
+			scheduler.setParallel(false);
+			scheduler.update(systems, 1.0f / 60.0f);
+
+			CHECK(log.entries == std::vector<std::string>{ "a", "b", "c" });
+			CHECK(log.maxRunning.load() == 1);
+		}
+
+		struct ThrowingSystem : System
+		{
+			ThrowingSystem() { access().reads<SchedulerVelocityComponent>(); }
+			void update(float) override { throw std::runtime_error("system failed"); }
+		};
+
+		TEST_CASE("Exceptions from concurrently run systems reach the caller", "[Engine][ECS][SystemScheduler]")
+		{
+			ThreadPool pool(2);
+			SchedulerLog log;
+
+			std::vector<std::unique_ptr<System>> systems;
+			systems.push_back(std::make_unique<ThrowingSystem>());
+			auto& other = static_cast<RecordingSystem&>(*systems.emplace_back(std::make_unique<RecordingSystem>(log, "other")));
+			other.declare().reads<SchedulerVelocityComponent>();
+
+			SystemScheduler scheduler;
+			scheduler.setThreadPool(&pool);
+
+			CHECK_THROWS_AS(scheduler.update(systems, 1.0f / 60.0f), std::runtime_error);
+			CHECK(log.entries.size() == 1);
+		}
+	}
+}
@@ -0,0 +1,82 @@
+#include <catch2/catch_test_macros.hpp>
+#include <helsinki/Engine/Scene/Scene.hpp>
+#include <algorithm>
+
+namespace hl
+{
+	namespace test
+	{
+		TEST_CASE("Tags by name and by hash are the same tag", "[Engine][ECS][TagRegistry]")
+		{
+			Scene scene;
+
+			auto e = scene.addEntity();
+			e->AddTag("ENEMY");
+
+			CHECK(e->HasTag("ENEMY"));
+			CHECK(e->HasTag("ENEMY"_hash));
+			CHECK_FALSE(e->HasTag("PLAYER"_hash));
+			CHECK(e->getTags().count() == 1);
+
+			e->ClearTag("ENEMY"_hash);
+			CHECK_FALSE(e->HasTag("ENEMY"));
+			CHECK(e->getTags().none());
+		}
+
+		TEST_CASE("Entities by tag are maintained as tags change", "[Engine][ECS][TagRegistry]")
+		{
+			Scene scene;
+
+			CHECK(scene.getEntitiesByTag("ENEMY").empty());
+
+			std::vector<Entity*> entities;
+			for (int i = 0; i < 10; ++i)
+			{
+				auto e = scene.addEntity();
+				e->AddTag(i % 2 == 0 ? "ENEMY"_hash : "PROJECTILE"_hash);
+				e->AddTag("COLLIDER");
+				e->AddTag("COLLIDER");
+				entities.push_back(e);
+			}
+
+			const auto& enemies = scene.getEntitiesByTag("ENEMY");
+			CHECK(enemies.size() == 5);
+			CHECK(scene.getEntitiesByTag("COLLIDER"_hash).size() == 10);
+
+			entities[0]->ClearTag("ENEMY");
+			entities[0]->ClearTag("ENEMY");
+			CHECK(enemies.size() == 4);
+			CHECK(std::find(enemies.begin(), enemies.end(), entities[0]) == enemies.end());
+
+			scene.removeEntity(entities[2]->Id);
+			scene.removeEntity(entities[3]->Id);
+			scene.update();
+
+			CHECK(enemies.size() == 3);
+			CHECK(scene.getEntitiesByTag("PROJECTILE").size() == 4);
+			CHECK(scene.getEntitiesByTag("COLLIDER").size() == 8);
+			for (const auto e : enemies)
+			{
+				CHECK(e->HasTag("ENEMY"_hash));
+			}
+		}
+
+		TEST_CASE("Reused entity slots do not inherit tags", "[Engine][ECS][TagRegistry]")
+		{
+			Scene scene;
+
+			auto e = scene.addEntity();
+			e->AddTag("PLAYER");
+			scene.removeEntity(e->Id);
+			scene.update();
+
+			auto reused = scene.addEntity();
+			CHECK_FALSE(reused->HasTag("PLAYER"));
+			CHECK(scene.getEntitiesByTag("PLAYER").empty());
+
+			reused->AddTag("PLAYER");
+			REQUIRE(scene.getEntitiesByTag("PLAYER").size() == 1);
+			CHECK(scene.getEntitiesByTag("PLAYER").front() == reused);
+		}
+	}
+}
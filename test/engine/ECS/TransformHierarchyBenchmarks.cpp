@@ -0,0 +1,91 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <helsinki/Engine/Scene/Scene.hpp>
+#include <helsinki/Engine/ECS/Components/TransformComponent.hpp>
+#include <vector>
+
+namespace hl
+{
+	namespace test
+	{
+		// 10k transforms as ships with two levels of attachments, a tenth of the
+		// ships move every frame.
+		TEST_CASE("Transform hierarchy world matrices", "[.][benchmark][Engine][ECS][TransformHierarchy]")
+		{
+			constexpr int ShipCount = 2500;
+
+			Scene scene;
+			std::vector<Entity*> ships;
+			std::vector<Entity*> all;
+
+			for (int i = 0; i < ShipCount; ++i)
+			{
+				auto ship = scene.addEntity();
+				ship->AddComponent<TransformComponent>()->SetPosition({ (float)i, 0.0f, 0.0f });
+				ships.push_back(ship);
+				all.push_back(ship);
+
+				for (int t = 0; t < 2; ++t)
+				{
+					auto turret = scene.addEntity();
+					auto transform = turret->AddComponent<TransformComponent>();
+					transform->SetPosition({ t == 0 ? -1.0f : 1.0f, 0.0f, 0.0f });
+					transform->SetParent(ship->Id);
+					all.push_back(turret);
+
+					if (t == 0)
+					{
+						auto barrel = scene.addEntity();
+						barrel->AddComponent<TransformComponent>()->SetParent(turret->Id);
+						all.push_back(barrel);
+					}
+				}
+			}
+
+			scene.update();
+
+			int frame = 0;
+			const auto moveShips = [&]()
+				{
+					for (int i = frame % 10; i < ShipCount; i += 10)
+					{
+						ships[i]->GetComponent<TransformComponent>()->SetPosition({ (float)i, (float)frame, 0.0f });
+					}
+					frame++;
+				};
+
+			BENCHMARK("Walk the parent chain per entity")
+			{
+				moveShips();
+
+				float sum = 0.0f;
+				for (const auto entity : all)
+				{
+					auto transform = entity->GetComponent<TransformComponent>();
+					auto world = transform->GetTransformMatrix();
+					for (auto parent = scene.getEntity(transform->GetParent());
+						parent != nullptr;
+						parent = scene.getEntity(parent->GetComponent<TransformComponent>()->GetParent()))
+					{
+						world = parent->GetComponent<TransformComponent>()->GetTransformMatrix() * world;
+					}
+					sum += world[3].y;
+				}
+				return sum;
+			};
+
+			BENCHMARK("Hierarchy pass over packed arrays")
+			{
+				moveShips();
+				scene.update();
+
+				float sum = 0.0f;
+				for (const auto& world : scene.getWorldMatrices())
+				{
+					sum += world[3].y;
+				}
+				return sum;
+			};
+		}
+	}
+}
@@ -0,0 +1,183 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <helsinki/Engine/Scene/Scene.hpp>
+#include <helsinki/Engine/ECS/Components/TransformComponent.hpp>
+#include <stdexcept>
+
+namespace hl
+{
+	namespace test
+	{
+		static glm::vec3 worldPosition(const Scene& scene, const Entity* entity)
+		{
+			const auto matrix = scene.getWorldMatrix(*entity->GetComponent<TransformComponent>());
+			return glm::vec3(matrix[3].x, matrix[3].y, matrix[3].z);
+		}
+
+		static Entity* addTransform(Scene& scene, const glm::vec3& position, int parent = EntityHandle::Invalid)
+		{
+			auto e = scene.addEntity();
+			auto transform = e->AddComponent<TransformComponent>();
+			transform->SetPosition(position);
+			transform->SetParent(parent);
+			return e;
+		}
+
+		TEST_CASE("World matrices combine the parent chain", "[Engine][ECS][TransformHierarchy]")
+		{
+			Scene scene;
+
+			// Children are created before their parents so the query order has to be fixed up.
+			auto grandchild = scene.addEntity();
+			grandchild->AddComponent<TransformComponent>()->SetPosition({ 0.0f, 0.0f, 1.0f });
+			auto child = scene.addEntity();
+			child->AddComponent<TransformComponent>()->SetPosition({ 0.0f, 2.0f, 0.0f });
+			auto root = addTransform(scene, { 3.0f, 0.0f, 0.0f });
+
+			grandchild->GetComponent<TransformComponent>()->SetParent(child->Id);
+			child->GetComponent<TransformComponent>()->SetParent(root->Id);
+
+			scene.update();
+
+			const auto rootIndex = root->GetComponent<TransformComponent>()->GetWorldIndex();
+			const auto childIndex = child->GetComponent<TransformComponent>()->GetWorldIndex();
+			const auto grandchildIndex = grandchild->GetComponent<TransformComponent>()->GetWorldIndex();
+			CHECK(rootIndex < childIndex);
+			CHECK(childIndex < grandchildIndex);
+			CHECK(scene.getWorldMatrices().size() == 3);
+
+			CHECK(worldPosition(scene, root) == glm::vec3(3.0f, 0.0f, 0.0f));
+			CHECK(worldPosition(scene, child) == glm::vec3(3.0f, 2.0f, 0.0f));
+			CHECK(worldPosition(scene, grandchild) == glm::vec3(3.0f, 2.0f, 1.0f));
+		}
+
+		TEST_CASE("Parent rotation and scale apply to children", "[Engine][ECS][TransformHierarchy]")
+		{
+			Scene scene;
+
+			auto root = addTransform(scene, { 1.0f, 0.0f, 0.0f });
+			root->GetComponent<TransformComponent>()->SetRotation({ 0.0f, 0.0f, 90.0f });
+			root->GetComponent<TransformComponent>()->SetScale(glm::vec3(2.0f));
+			auto child = addTransform(scene, { 1.0f, 0.0f, 0.0f }, root->Id);
+
+			scene.update();
+
+			const auto position = worldPosition(scene, child);
+			CHECK(position.x == Catch::Approx(1.0f).margin(1e-5));
+			CHECK(position.y == Catch::Approx(2.0f).margin(1e-5));
+			CHECK(position.z == Catch::Approx(0.0f).margin(1e-5));
+		}
+
+		TEST_CASE("Only dirty transforms and their descendants are recomputed", "[Engine][ECS][TransformHierarchy]")
+		{
+			Scene scene;
+
+			auto root = addTransform(scene, { 0.0f, 0.0f, 0.0f });
+			auto child = addTransform(scene, { 1.0f, 0.0f, 0.0f }, root->Id);
+			addTransform(scene, { 1.0f, 0.0f, 0.0f }, child->Id);
+			auto other = addTransform(scene, { 5.0f, 0.0f, 0.0f });
+
+			scene.update();
+			CHECK(scene.getTransformHierarchy().getLastUpdatedCount() == 4);
+
+			scene.update();
+			CHECK(scene.getTransformHierarchy().getLastUpdatedCount() == 0);
+
+			root->GetComponent<TransformComponent>()->SetPosition({ 0.0f, 1.0f, 0.0f });
+			scene.update();
+			CHECK(scene.getTransformHierarchy().getLastUpdatedCount() == 3);
+			CHECK(worldPosition(scene, child) == glm::vec3(1.0f, 1.0f, 0.0f));
+
+			other->GetComponent<TransformComponent>()->SetPosition({ 6.0f, 0.0f, 0.0f });
+			scene.update();
+			CHECK(scene.getTransformHierarchy().getLastUpdatedCount() == 1);
+			CHECK(worldPosition(scene, other) == glm::vec3(6.0f, 0.0f, 0.0f));
+		}
+
+		TEST_CASE("Reparenting and removing parents rebuilds the hierarchy", "[Engine][ECS][TransformHierarchy]")
+		{
+			Scene scene;
+
+			auto a = addTransform(scene, { 10.0f, 0.0f, 0.0f });
+			auto b = addTransform(scene, { 20.0f, 0.0f, 0.0f });
+			auto child = addTransform(scene, { 1.0f, 0.0f, 0.0f }, a->Id);
+
+			scene.update();
+			CHECK(worldPosition(scene, child) == glm::vec3(11.0f, 0.0f, 0.0f));
+
+			child->GetComponent<TransformComponent>()->SetParent(b->Id);
+			scene.update();
+			CHECK(worldPosition(scene, child) == glm::vec3(21.0f, 0.0f, 0.0f));
+
+			scene.removeEntity(b->Id);
+			scene.update();
+			CHECK(scene.getWorldMatrices().size() == 2);
+			CHECK(worldPosition(scene, child) == glm::vec3(1.0f, 0.0f, 0.0f));
+		}
+
+		TEST_CASE("Added and removed transforms are patched in without rebuilding the order", "[Engine][ECS][TransformHierarchy]")
+		{
+			Scene scene;
+
+			auto a = addTransform(scene, { 1.0f, 0.0f, 0.0f });
+			auto b = addTransform(scene, { 2.0f, 0.0f, 0.0f });
+			auto child = addTransform(scene, { 0.0f, 1.0f, 0.0f }, b->Id);
+			scene.update();
+			CHECK(scene.getTransformHierarchy().getLastUpdatedCount() == 3);
+
+			// A rebuild would recompute every world matrix, a patch only the new ones.
+			auto c = addTransform(scene, { 3.0f, 0.0f, 0.0f });
+			auto leaf = addTransform(scene, { 0.0f, 0.0f, 1.0f }, child->Id);
+			scene.update();
+			CHECK(scene.getTransformHierarchy().getLastUpdatedCount() == 2);
+			CHECK(worldPosition(scene, c) == glm::vec3(3.0f, 0.0f, 0.0f));
+			CHECK(worldPosition(scene, leaf) == glm::vec3(2.0f, 1.0f, 1.0f));
+
+			scene.removeEntity(a->Id);
+			scene.update();
+			CHECK(scene.getTransformHierarchy().getLastUpdatedCount() == 0);
+			CHECK(scene.getWorldMatrices().size() == 4);
+			CHECK(worldPosition(scene, leaf) == glm::vec3(2.0f, 1.0f, 1.0f));
+
+			b->GetComponent<TransformComponent>()->SetPosition({ 5.0f, 0.0f, 0.0f });
+			scene.update();
+			CHECK(scene.getTransformHierarchy().getLastUpdatedCount() == 3);
+			CHECK(worldPosition(scene, leaf) == glm::vec3(5.0f, 1.0f, 1.0f));
+			CHECK(worldPosition(scene, c) == glm::vec3(3.0f, 0.0f, 0.0f));
+		}
+
+		TEST_CASE("Adding the transform a child is waiting on attaches the child", "[Engine][ECS][TransformHierarchy]")
+		{
+			Scene scene;
+
+			auto parent = scene.addEntity();
+			auto child = addTransform(scene, { 1.0f, 0.0f, 0.0f }, parent->Id);
+			scene.update();
+			CHECK(worldPosition(scene, child) == glm::vec3(1.0f, 0.0f, 0.0f));
+
+			parent->AddComponent<TransformComponent>()->SetPosition({ 0.0f, 4.0f, 0.0f });
+			scene.update();
+			CHECK(worldPosition(scene, child) == glm::vec3(1.0f, 4.0f, 0.0f));
+		}
+
+		TEST_CASE("Transforms added since the last update fall back to their local matrix", "[Engine][ECS][TransformHierarchy]")
+		{
+			Scene scene;
+
+			auto e = addTransform(scene, { 4.0f, 5.0f, 6.0f });
+			CHECK(e->GetComponent<TransformComponent>()->GetWorldIndex() == TransformComponent::NoWorldIndex);
+			CHECK(worldPosition(scene, e) == glm::vec3(4.0f, 5.0f, 6.0f));
+		}
+
+		TEST_CASE("Cycles in the hierarchy are reported", "[Engine][ECS][TransformHierarchy]")
+		{
+			Scene scene;
+
+			auto a = addTransform(scene, {});
+			auto b = addTransform(scene, {}, a->Id);
+			a->GetComponent<TransformComponent>()->SetParent(b->Id);
+
+			CHECK_THROWS_AS(scene.update(), std::runtime_error);
+		}
+	}
+}
@@ -0,0 +1,136 @@
+#include <catch2/catch_test_macros.hpp>
+#include <helsinki/Engine/HeadlessGame.hpp>
+#include <helsinki/Engine/ECS/Components/TransformComponent.hpp>
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace hl
+{
+	namespace test
+	{
+		class CountingHeadlessGame : public HeadlessGame
+		{
+		public:
+			int agents{ 0 };
+			bool fast{ false };
+			bool initialised{ false };
+			std::vector<uint64_t> updates;
+
+		protected:
+			int parseOption(std::string_view arg, const char* value) override
+			{
+				if (arg == "--fast")
+				{
+					fast = true;
+					return 1;
+				}
+				if (value != nullptr && arg == "--agents")
+				{
+					agents = std::stoi(value);
+					return 2;
+				}
+				return 0;
+			}
+
+			std::string getOptionUsage() const override
+			{
+				return "  --agents <n>        agents to add\n";
+			}
+
+			void initialise(const HeadlessOptions& /*options*/) override
+			{
+				initialised = true;
+				for (int i = 0; i < agents; ++i)
+				{
+					_scene.addEntity()->AddComponent<TransformComponent>();
+				}
+			}
+
+			EventRecording scriptInput(uint64_t /*updates*/) override
+			{
+				return {};
+			}
+
+			void update(uint64_t update, float /*delta*/) override
+			{
+				updates.push_back(update);
+			}
+
+			std::string getName() const override
+			{
+				return "Counting";
+			}
+
+			void report(std::ostream& stream) const override
+			{
+				stream << "Agents " << agents << std::endl;
+			}
+		};
+
+		static int runGame(CountingHeadlessGame& game, std::vector<std::string> args, std::string& output)
+		{
+			args.insert(args.begin(), "headless");
+			std::vector<char*> argv;
+			for (auto& arg : args)
+			{
+				argv.push_back(arg.data());
+			}
+
+			std::ostringstream stream;
+			const auto exitCode = game.run((int)argv.size(), argv.data(), stream);
+			output = stream.str();
+			return exitCode;
+		}
+
+		TEST_CASE("Headless games parse the shared options and pass the rest to the game", "[Engine][HeadlessGame]")
+		{
+			std::vector<std::string> args{ "headless", "--agents", "3", "--updates", "12", "--unknown", "--serial", "--fast", "--seed", "9", "--replay-from", "7", "--min-ups" };
+			std::vector<char*> argv;
+			for (auto& arg : args)
+			{
+				argv.push_back(arg.data());
+			}
+
+			CountingHeadlessGame game;
+			const auto options = game.parseOptions((int)argv.size(), argv.data());
+
+			CHECK(options.updates == 12);
+			CHECK(options.serial);
+			CHECK(options.seed == 9u);
+			CHECK(options.replayFrom == 7u);
+			// Missing its value, so left alone.
+			CHECK(options.minUpdatesPerSecond == 0.0);
+			CHECK_FALSE(options.help);
+			CHECK(game.agents == 3);
+			CHECK(game.fast);
+		}
+
+		TEST_CASE("Headless games run, report and fail below the minimum updates a second", "[Engine][HeadlessGame]")
+		{
+			std::string output;
+
+			CountingHeadlessGame game;
+			CHECK(runGame(game, { "--updates", "5", "--agents", "2", "--seed", "1" }, output) == EXIT_SUCCESS);
+			CHECK(game.initialised);
+			CHECK(game.updates == std::vector<uint64_t>{ 0, 1, 2, 3, 4 });
+			CHECK(output.starts_with("Counting\n5 updates in "));
+			CHECK(output.find("Agents 2\n") != std::string::npos);
+
+			CountingHeadlessGame slow;
+			CHECK(runGame(slow, { "--updates", "1", "--min-ups", "1e300" }, output) == EXIT_FAILURE);
+			CHECK(output.find("Below the minimum") != std::string::npos);
+		}
+
+		TEST_CASE("Headless games print their options with --help and do not run", "[Engine][HeadlessGame]")
+		{
+			std::string output;
+			CountingHeadlessGame game;
+			CHECK(runGame(game, { "--help" }, output) == EXIT_SUCCESS);
+			CHECK_FALSE(game.initialised);
+			CHECK(output.find("--min-ups <n>") != std::string::npos);
+			CHECK(output.find("--agents <n>        agents to add") != std::string::npos);
+		}
+	}
+}
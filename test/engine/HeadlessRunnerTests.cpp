@@ -0,0 +1,253 @@
+#include <catch2/catch_test_macros.hpp>
+#include <helsinki/Engine/HeadlessRunner.hpp>
+#include <helsinki/Engine/ECS/Components/TransformComponent.hpp>
+#include <helsinki/System/Events/EventRecorder.hpp>
+#include <helsinki/System/Events/KeyEvents.hpp>
+#include <helsinki/System/Events/EventSubscription.hpp>
+#include <sstream>
+#include <vector>
+
+namespace hl
+{
+	namespace test
+	{
+		constexpr int HeadlessTestKey = 87;
+
+		struct HeadlessMarkerComponent : Component {};
+
+		class HeadlessInputSystem : public System
+		{
+		public:
+			HeadlessInputSystem(InputManager& inputManager, Scene& scene) :
+				_inputManager(inputManager),
+				_markers(scene.query<HeadlessMarkerComponent>())
+			{
+			}
+
+			void update(float delta) override
+			{
+				keyDown.push_back(_inputManager.isKeyDown(HeadlessTestKey));
+				markers.push_back(_markers.size());
+				deltas.push_back(delta);
+			}
+
+			std::vector<bool> keyDown;
+			std::vector<size_t> markers;
+			std::vector<float> deltas;
+
+		private:
+			InputManager& _inputManager;
+			Query<HeadlessMarkerComponent> _markers;
+		};
+
+		class HeadlessScatterSystem : public System
+		{
+		public:
+			explicit HeadlessScatterSystem(Scene& scene) :
+				_scene(scene),
+				_transforms(scene.query<TransformComponent>())
+			{
+			}
+
+			void update(float delta) override
+			{
+				_transforms.each([delta](Entity&, TransformComponent& transform)
+					{
+						transform.SetPosition(transform.GetPosition() + glm::vec3(delta, 0.0f, 0.0f));
+					});
+
+				auto& commands = _scene.getCommandBuffer();
+				const auto position = glm::vec3(_scene.getRandom().nextFloat(0.0f, 100.0f), 0.0f, 0.0f);
+				commands.addComponent<TransformComponent>(commands.createEntity()).SetPosition(position);
+			}
+
+		private:
+			Scene& _scene;
+			Query<TransformComponent> _transforms;
+		};
+
+		static HeadlessResult runScattered(uint64_t seed)
+		{
+			EventBus eventBus;
+			InputManager inputManager;
+			Scene scene;
+			scene.setDeterministic(seed);
+			scene.addSystem(new HeadlessScatterSystem(scene));
+
+			HeadlessRunner runner(eventBus, inputManager, scene);
+			runner.setRecordChecksums(true);
+			return runner.run(20);
+		}
+
+		TEST_CASE("Headless runs of a seeded scene match update by update", "[Engine][HeadlessRunner]")
+		{
+			const auto first = runScattered(3);
+			const auto second = runScattered(3);
+			const auto other = runScattered(4);
+
+			REQUIRE(first.checksums.size() == 20);
+			CHECK(first.checksums == second.checksums);
+			CHECK_FALSE(first.findDivergence(second.checksums).has_value());
+
+			// The first entity is placed before the first checksum is taken.
+			CHECK(first.findDivergence(other.checksums) == std::optional<uint64_t>(0));
+
+			auto truncated = first.checksums;
+			truncated.resize(10);
+			CHECK_FALSE(first.findDivergence(truncated).has_value());
+			truncated[7]++;
+			CHECK(first.findDivergence(truncated) == std::optional<uint64_t>(7));
+		}
+
+		TEST_CASE("Headless runs replay input to the scene's systems update by update", "[Engine][HeadlessRunner]")
+		{
+			EventBus eventBus;
+			InputManager inputManager;
+			Scene scene;
+			auto system = new HeadlessInputSystem(inputManager, scene);
+			scene.addSystem(system);
+
+			EventRecorder recorder;
+			for (uint64_t update = 0; update < 6; ++update)
+			{
+				recorder.BeginUpdate(update);
+				if (update == 2)
+				{
+					recorder.Record(KeyPressEvent(HeadlessTestKey));
+				}
+				else if (update == 4)
+				{
+					recorder.Record(KeyReleaseEvent(HeadlessTestKey));
+				}
+				recorder.EndFrame();
+			}
+
+			HeadlessRunner runner(eventBus, inputManager, scene);
+			const auto result = runner.run(6, recorder.GetRecording());
+
+			CHECK(system->keyDown == std::vector<bool>{ false, false, true, true, false, false });
+			CHECK(system->deltas == std::vector<float>(6, FixedDelta));
+			CHECK(result.updates == 6);
+			REQUIRE(result.systems.size() == 1);
+			CHECK(result.systems[0].slowestMilliseconds <= result.totalMilliseconds);
+			CHECK(result.getUpdatesPerSecond() > 0.0);
+
+			// Each run starts with nothing held, whatever happened outside it.
+			eventBus.PublishEvent(KeyPressEvent(HeadlessTestKey));
+			runner.run(1);
+			CHECK(system->keyDown.back() == false);
+
+			std::stringstream report;
+			result.print(report);
+			CHECK(report.str().find("6 updates") == 0);
+		}
+
+		struct HeadlessFrameEvent
+		{
+			uint64_t update;
+		};
+
+		class HeadlessFrameSystem : public System
+		{
+		public:
+			explicit HeadlessFrameSystem(EventBus& eventBus) : _eventBus(eventBus)
+			{
+				_subscription = _eventBus.SubscribeScoped<&HeadlessFrameSystem::onFrame>(this);
+			}
+
+			void update(float) override
+			{
+				_eventBus.Publish(HeadlessFrameEvent{ .update = updates++ });
+			}
+
+			void onFrame(const HeadlessFrameEvent& /*event*/)
+			{
+				delivered.push_back(updates);
+			}
+
+			uint64_t updates{ 0 };
+			// How many updates had run when each event was dispatched.
+			std::vector<uint64_t> delivered;
+
+		private:
+			EventBus& _eventBus;
+			EventSubscription _subscription;
+		};
+
+		TEST_CASE("Headless replays run each recorded frame's updates between the event phases", "[Engine][HeadlessRunner]")
+		{
+			EventBus eventBus;
+			eventBus.SetPhase<HeadlessFrameEvent>(EventPhase::EndOfFrame);
+			InputManager inputManager;
+			Scene scene;
+			auto input = new HeadlessInputSystem(inputManager, scene);
+			scene.addSystem(input);
+			auto frames = new HeadlessFrameSystem(eventBus);
+			scene.addSystem(frames);
+
+			// Two updates on a title screen, then gameplay from update 2 with
+			// three updates in a frame, a frame with none and one with two.
+			EventRecorder recorder;
+			uint64_t update = 0;
+			for (const auto count : { 2, 3, 0, 2 })
+			{
+				for (int i = 0; i < count; ++i, ++update)
+				{
+					recorder.BeginUpdate(update);
+					if (update == 3)
+					{
+						recorder.Record(KeyPressEvent(HeadlessTestKey));
+					}
+					else if (update == 6)
+					{
+						recorder.Record(KeyReleaseEvent(HeadlessTestKey));
+					}
+				}
+				recorder.EndFrame();
+			}
+
+			HeadlessRunner runner(eventBus, inputManager, scene);
+			runner.setRecordChecksums(true);
+			const auto result = runner.run(5, recorder.GetRecording(), 2);
+
+			CHECK(result.updates == 5);
+			CHECK(result.checksums.size() == 5);
+			CHECK(input->keyDown == std::vector<bool>{ false, true, true, true, false });
+			// Queued events are dispatched once a frame, after all of its updates.
+			CHECK(frames->delivered == std::vector<uint64_t>{ 3, 3, 3, 5, 5 });
+
+			// Past the recorded frames, one update a frame.
+			frames->delivered.clear();
+			frames->updates = 0;
+			runner.run(3, recorder.GetRecording(), 6);
+			CHECK(frames->delivered == std::vector<uint64_t>{ 1, 2, 3 });
+		}
+
+		TEST_CASE("Headless update callbacks run before the systems and their changes land after", "[Engine][HeadlessRunner]")
+		{
+			EventBus eventBus;
+			InputManager inputManager;
+			Scene scene;
+			auto system = new HeadlessInputSystem(inputManager, scene);
+			scene.addSystem(system);
+
+			std::vector<uint64_t> updates;
+			HeadlessRunner runner(eventBus, inputManager, scene);
+			runner.setUpdateCallback([&](uint64_t update, float)
+				{
+					updates.push_back(update);
+					if (update == 1)
+					{
+						auto& commands = scene.getCommandBuffer();
+						commands.addComponent<HeadlessMarkerComponent>(commands.createEntity());
+					}
+				});
+
+			runner.run(4);
+
+			CHECK(updates == std::vector<uint64_t>{ 0, 1, 2, 3 });
+			// Spawned through the command buffer, so only there from the next update.
+			CHECK(system->markers == std::vector<size_t>{ 0, 0, 1, 1 });
+		}
+	}
+}
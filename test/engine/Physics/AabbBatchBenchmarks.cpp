@@ -0,0 +1,60 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <helsinki/Engine/Physics/AabbBatch.hpp>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hl
+{
+	namespace test
+	{
+		TEST_CASE("AabbBatch overlap kernels", "[.][benchmark][Engine][Physics][AabbBatch]")
+		{
+			for (const auto count : { 64, 1024, 16384 })
+			{
+				std::mt19937 random(42);
+				std::uniform_real_distribution<float> position(0.0f, 1000.0f);
+
+				AabbBatch batch;
+				std::vector<Aabb> queries;
+				for (int i = 0; i < count; ++i)
+				{
+					batch.add(Aabb::fromCentre({ position(random), position(random) }, glm::vec2(8.0f)));
+				}
+				for (int i = 0; i < 64; ++i)
+				{
+					queries.push_back(Aabb::fromCentre({ position(random), position(random) }, glm::vec2(8.0f)));
+				}
+
+				const auto suffix = ", 64 boxes against " + std::to_string(count);
+				std::vector<uint32_t> hits;
+
+				const std::pair<SimdLevel, std::string> levels[] =
+				{
+					{ SimdLevel::Scalar, "Scalar" },
+					{ SimdLevel::Sse, "SSE" },
+					{ SimdLevel::Avx2, "AVX2" }
+				};
+				for (const auto& [level, name] : levels)
+				{
+					if (level > detectSimdLevel())
+					{
+						continue;
+					}
+
+					BENCHMARK(name + suffix)
+					{
+						hits.clear();
+						for (const auto& query : queries)
+						{
+							batch.findOverlaps(query, hits, 0, level);
+						}
+						return hits.size();
+					};
+				}
+			}
+		}
+	}
+}
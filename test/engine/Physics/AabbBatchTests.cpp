@@ -0,0 +1,131 @@
+#include <catch2/catch_test_macros.hpp>
+#include <helsinki/Engine/Physics/AabbBatch.hpp>
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace hl
+{
+	namespace test
+	{
+		constexpr SimdLevel TestLevels[] = { SimdLevel::Scalar, SimdLevel::Sse, SimdLevel::Avx2 };
+
+		// Corners on a coarse grid, so plenty of boxes share or touch edges.
+		static std::vector<Aabb> createTestBoxes(std::mt19937& random, size_t count)
+		{
+			std::uniform_int_distribution<int> corner(0, 40);
+			std::uniform_int_distribution<int> size(0, 6);
+
+			std::vector<Aabb> boxes;
+			for (size_t i = 0; i < count; ++i)
+			{
+				const glm::vec2 min{ (float)corner(random) * 0.5f, (float)corner(random) * 0.5f };
+				boxes.push_back(Aabb::fromCorner(min, { (float)size(random), (float)size(random) }));
+			}
+			return boxes;
+		}
+
+		static std::vector<uint32_t> expectedOverlaps(const std::vector<Aabb>& boxes, const Aabb& bounds, uint32_t first)
+		{
+			std::vector<uint32_t> hits;
+			for (uint32_t i = first; i < boxes.size(); ++i)
+			{
+				if (boxes[i].overlaps(bounds))
+				{
+					hits.push_back(i);
+				}
+			}
+			return hits;
+		}
+
+		TEST_CASE("Every simd level finds the same boxes as Aabb::overlaps", "[Engine][Physics][AabbBatch]")
+		{
+			INFO("Detected simd level " << (int)detectSimdLevel());
+
+			std::mt19937 random(5678);
+
+			for (const size_t count : { 0, 1, 3, 4, 5, 7, 8, 9, 16, 17, 100 })
+			{
+				const auto boxes = createTestBoxes(random, count);
+				AabbBatch batch;
+				for (const auto& box : boxes)
+				{
+					batch.add(box);
+				}
+				REQUIRE(batch.size() == count);
+
+				for (const auto& query : createTestBoxes(random, 20))
+				{
+					for (const uint32_t first : { 0, 1, 3, 5, 8, 9, 50, 200 })
+					{
+						const auto expected = expectedOverlaps(boxes, query, first);
+
+						for (const auto level : TestLevels)
+						{
+							std::vector<uint32_t> hits;
+							batch.findOverlaps(query, hits, first, level);
+							REQUIRE(hits == expected);
+						}
+					}
+				}
+			}
+		}
+
+		TEST_CASE("Every simd level finds the same boxes when sorted", "[Engine][Physics][AabbBatch]")
+		{
+			std::mt19937 random(91011);
+
+			for (const size_t count : { 1, 7, 8, 9, 33, 200 })
+			{
+				auto boxes = createTestBoxes(random, count);
+				std::stable_sort(boxes.begin(), boxes.end(),
+					[](const Aabb& a, const Aabb& b) { return a.min.x < b.min.x; });
+
+				AabbBatch batch;
+				for (const auto& box : boxes)
+				{
+					batch.add(box);
+				}
+
+				// The same sweep the broadphase does, each box against the rest.
+				for (uint32_t i = 0; i < boxes.size(); ++i)
+				{
+					const auto expected = expectedOverlaps(boxes, boxes[i], i + 1);
+
+					for (const auto level : TestLevels)
+					{
+						std::vector<uint32_t> hits;
+						batch.findSortedOverlaps(batch.get(i), hits, i + 1, level);
+						REQUIRE(hits == expected);
+					}
+				}
+			}
+		}
+
+		TEST_CASE("AabbBatch padding is never reported", "[Engine][Physics][AabbBatch]")
+		{
+			constexpr auto Infinity = std::numeric_limits<float>::infinity();
+			const Aabb everything{ { -Infinity, -Infinity }, { Infinity, Infinity } };
+
+			AabbBatch batch;
+			for (int i = 0; i < 5; ++i)
+			{
+				batch.add(Aabb{ { (float)i, 0.0f }, { (float)i + 1.0f, 1.0f } });
+			}
+			CHECK(batch.get(3) == Aabb{ { 3.0f, 0.0f }, { 4.0f, 1.0f } });
+
+			for (const auto level : TestLevels)
+			{
+				std::vector<uint32_t> hits;
+				batch.findOverlaps(everything, hits, 0, level);
+				CHECK(hits == std::vector<uint32_t>{ 0, 1, 2, 3, 4 });
+			}
+
+			batch.clear();
+			std::vector<uint32_t> hits;
+			batch.findOverlaps(everything, hits);
+			CHECK(hits.empty());
+		}
+	}
+}
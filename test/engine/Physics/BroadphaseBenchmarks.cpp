@@ -0,0 +1,128 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <helsinki/Engine/Physics/UniformGridBroadphase.hpp>
+#include <helsinki/Engine/Physics/SweepAndPruneBroadphase.hpp>
+#include <helsinki/Engine/ECS/EntityHandle.hpp>
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace hl
+{
+	namespace test
+	{
+		struct BenchmarkCollider
+		{
+			int id;
+			glm::vec2 position;
+			glm::vec2 velocity;
+			glm::vec2 size;
+			CollisionFilter filter;
+		};
+
+		// Colliders 4 to 12 units across, on average one per 16x16 area, all
+		// moving up to a unit per frame. Like Hurricane, bullets only hit
+		// enemies and enemies hit both.
+		static std::vector<BenchmarkCollider> createBenchmarkColliders(int count, float& worldSize)
+		{
+			worldSize = std::sqrt((float)count) * 16.0f;
+
+			std::mt19937 random(42);
+			std::uniform_real_distribution<float> position(0.0f, worldSize);
+			std::uniform_real_distribution<float> velocity(-1.0f, 1.0f);
+			std::uniform_real_distribution<float> size(4.0f, 12.0f);
+
+			std::vector<BenchmarkCollider> colliders;
+			for (int i = 0; i < count; ++i)
+			{
+				const auto bullet = i % 4 != 0;
+				colliders.push_back(BenchmarkCollider
+					{
+						.id = EntityHandle::make((uint32_t)i + 1, 1),
+						.position = { position(random), position(random) },
+						.velocity = { velocity(random), velocity(random) },
+						.size = glm::vec2(size(random)),
+						.filter = bullet
+							? CollisionFilter{ .layer = 1, .mask = 2 }
+							: CollisionFilter{ .layer = 2, .mask = 1 | 2 }
+					});
+			}
+
+			return colliders;
+		}
+
+		static void moveBenchmarkColliders(std::vector<BenchmarkCollider>& colliders, float worldSize)
+		{
+			for (auto& collider : colliders)
+			{
+				collider.position += collider.velocity;
+				collider.position.x = std::fmod(collider.position.x + worldSize, worldSize);
+				collider.position.y = std::fmod(collider.position.y + worldSize, worldSize);
+			}
+		}
+
+		static size_t runBroadphaseFrame(Broadphase& broadphase, const std::vector<BenchmarkCollider>& colliders, std::vector<BroadphasePair>& pairs)
+		{
+			broadphase.beginUpdate();
+			for (const auto& collider : colliders)
+			{
+				broadphase.update(collider.id, Aabb::fromCentre(collider.position, collider.size), collider.filter);
+			}
+			broadphase.endUpdate();
+			broadphase.findPairs(pairs);
+			return pairs.size();
+		}
+
+		TEST_CASE("Broadphase pair finding", "[.][benchmark][Engine][Physics][Broadphase]")
+		{
+			for (const auto count : { 100, 500, 1000, 5000, 10000, 50000 })
+			{
+				float worldSize = 0.0f;
+				auto colliders = createBenchmarkColliders(count, worldSize);
+				const auto suffix = ", " + std::to_string(count) + " colliders";
+
+				std::vector<BroadphasePair> pairs;
+				UniformGridBroadphase grid(16.0f);
+				SweepAndPruneBroadphase sap;
+				runBroadphaseFrame(grid, colliders, pairs);
+				runBroadphaseFrame(sap, colliders, pairs);
+
+				if (count <= 5000)
+				{
+					BENCHMARK("Every pair" + suffix)
+					{
+						moveBenchmarkColliders(colliders, worldSize);
+
+						size_t found = 0;
+						for (size_t i = 0; i < colliders.size(); ++i)
+						{
+							const auto a = Aabb::fromCentre(colliders[i].position, colliders[i].size);
+							for (size_t j = i + 1; j < colliders.size(); ++j)
+							{
+								const auto b = Aabb::fromCentre(colliders[j].position, colliders[j].size);
+								if (colliders[i].filter.accepts(colliders[j].filter) && a.overlaps(b))
+								{
+									found++;
+								}
+							}
+						}
+						return found;
+					};
+				}
+
+				BENCHMARK("Uniform grid" + suffix)
+				{
+					moveBenchmarkColliders(colliders, worldSize);
+					return runBroadphaseFrame(grid, colliders, pairs);
+				};
+
+				BENCHMARK("Sweep and prune" + suffix)
+				{
+					moveBenchmarkColliders(colliders, worldSize);
+					return runBroadphaseFrame(sap, colliders, pairs);
+				};
+			}
+		}
+	}
+}
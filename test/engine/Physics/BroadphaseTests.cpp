@@ -0,0 +1,234 @@
+#include <catch2/catch_test_macros.hpp>
+#include <helsinki/Engine/Physics/UniformGridBroadphase.hpp>
+#include <helsinki/Engine/Physics/SweepAndPruneBroadphase.hpp>
+#include <helsinki/Engine/ECS/EntityHandle.hpp>
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace hl
+{
+	namespace test
+	{
+		constexpr CollisionFilter TestEverything{ .layer = 1, .mask = 1 };
+
+		struct TestCollider
+		{
+			int id;
+			Aabb bounds;
+			CollisionFilter filter;
+		};
+
+		static std::vector<BroadphasePair> bruteForcePairs(const std::vector<TestCollider>& colliders)
+		{
+			std::vector<BroadphasePair> pairs;
+			for (size_t i = 0; i < colliders.size(); ++i)
+			{
+				for (size_t j = i + 1; j < colliders.size(); ++j)
+				{
+					const auto& a = colliders[i];
+					const auto& b = colliders[j];
+					if (a.filter.accepts(b.filter) && a.bounds.overlaps(b.bounds))
+					{
+						pairs.push_back(BroadphasePair{ std::min(a.id, b.id), std::max(a.id, b.id) });
+					}
+				}
+			}
+			std::sort(pairs.begin(), pairs.end());
+			return pairs;
+		}
+
+		static std::vector<BroadphasePair> updateAndFind(Broadphase& broadphase, const std::vector<TestCollider>& colliders)
+		{
+			broadphase.beginUpdate();
+			for (const auto& collider : colliders)
+			{
+				broadphase.update(collider.id, collider.bounds, collider.filter);
+			}
+			broadphase.endUpdate();
+
+			std::vector<BroadphasePair> pairs;
+			broadphase.findPairs(pairs);
+			return pairs;
+		}
+
+		TEST_CASE("Broadphases find overlapping colliders once each", "[Engine][Physics][Broadphase]")
+		{
+			const std::vector<TestCollider> colliders =
+			{
+				{ EntityHandle::make(1, 1), Aabb{ { 0.0f, 0.0f }, { 10.0f, 10.0f } }, TestEverything },
+				{ EntityHandle::make(2, 1), Aabb{ { 5.0f, 5.0f }, { 30.0f, 30.0f } }, TestEverything },
+				// Touches the first along its right edge.
+				{ EntityHandle::make(3, 1), Aabb{ { 10.0f, 0.0f }, { 12.0f, 2.0f } }, TestEverything },
+				{ EntityHandle::make(4, 1), Aabb{ { 100.0f, 100.0f }, { 110.0f, 110.0f } }, TestEverything }
+			};
+			const std::vector<BroadphasePair> expected =
+			{
+				{ colliders[0].id, colliders[1].id },
+				{ colliders[0].id, colliders[2].id }
+			};
+
+			SECTION("Uniform grid")
+			{
+				UniformGridBroadphase grid(4.0f);
+				CHECK(updateAndFind(grid, colliders) == expected);
+			}
+
+			SECTION("Sweep and prune")
+			{
+				SweepAndPruneBroadphase sap;
+				CHECK(updateAndFind(sap, colliders) == expected);
+			}
+		}
+
+		TEST_CASE("Broadphases only pair colliders whose filters accept each other", "[Engine][Physics][Broadphase]")
+		{
+			constexpr uint32_t Player = 1 << 0;
+			constexpr uint32_t Enemy = 1 << 1;
+			constexpr uint32_t PlayerBullet = 1 << 2;
+
+			const Aabb bounds{ { 0.0f, 0.0f }, { 1.0f, 1.0f } };
+			const std::vector<TestCollider> colliders =
+			{
+				{ EntityHandle::make(1, 1), bounds, { .layer = Player, .mask = Enemy } },
+				{ EntityHandle::make(2, 1), bounds, { .layer = Enemy, .mask = Player | PlayerBullet } },
+				{ EntityHandle::make(3, 1), bounds, { .layer = PlayerBullet, .mask = Enemy } },
+				// Wants to hit the player, but the player does not want to hit it.
+				{ EntityHandle::make(4, 1), bounds, { .layer = PlayerBullet, .mask = Player } }
+			};
+			const std::vector<BroadphasePair> expected =
+			{
+				{ colliders[0].id, colliders[1].id },
+				{ colliders[1].id, colliders[2].id }
+			};
+
+			UniformGridBroadphase grid(1.0f);
+			SweepAndPruneBroadphase sap;
+			CHECK(updateAndFind(grid, colliders) == expected);
+			CHECK(updateAndFind(sap, colliders) == expected);
+		}
+
+		TEST_CASE("Colliders not updated in a round are removed", "[Engine][Physics][Broadphase]")
+		{
+			UniformGridBroadphase grid(4.0f);
+			SweepAndPruneBroadphase sap;
+
+			std::vector<TestCollider> colliders =
+			{
+				{ EntityHandle::make(1, 1), Aabb{ { 0.0f, 0.0f }, { 2.0f, 2.0f } }, TestEverything },
+				{ EntityHandle::make(2, 1), Aabb{ { 1.0f, 1.0f }, { 3.0f, 3.0f } }, TestEverything },
+				{ EntityHandle::make(3, 1), Aabb{ { 1.0f, 0.0f }, { 2.0f, 3.0f } }, TestEverything }
+			};
+
+			for (Broadphase* broadphase : { (Broadphase*)&grid, (Broadphase*)&sap })
+			{
+				CHECK(updateAndFind(*broadphase, colliders).size() == 3);
+				CHECK(broadphase->getColliderCount() == 3);
+			}
+
+			colliders.erase(colliders.begin() + 1);
+			for (Broadphase* broadphase : { (Broadphase*)&grid, (Broadphase*)&sap })
+			{
+				CHECK(updateAndFind(*broadphase, colliders) == std::vector<BroadphasePair>{ { colliders[0].id, colliders[1].id } });
+				CHECK(broadphase->getColliderCount() == 2);
+			}
+
+			for (Broadphase* broadphase : { (Broadphase*)&grid, (Broadphase*)&sap })
+			{
+				broadphase->remove(colliders[0].id);
+				std::vector<BroadphasePair> pairs;
+				broadphase->findPairs(pairs);
+				CHECK(pairs.empty());
+				CHECK(broadphase->getColliderCount() == 1);
+			}
+		}
+
+		TEST_CASE("A reused entity slot replaces the collider of the removed entity", "[Engine][Physics][Broadphase]")
+		{
+			const auto removed = EntityHandle::make(1, 1);
+			const auto reused = EntityHandle::make(1, 2);
+			const auto other = EntityHandle::make(2, 1);
+
+			for (const auto useGrid : { true, false })
+			{
+				UniformGridBroadphase grid(4.0f);
+				SweepAndPruneBroadphase sap;
+				Broadphase& broadphase = useGrid ? (Broadphase&)grid : (Broadphase&)sap;
+
+				broadphase.update(removed, Aabb{ { 0.0f, 0.0f }, { 1.0f, 1.0f } }, TestEverything);
+				broadphase.update(other, Aabb{ { 20.0f, 20.0f }, { 21.0f, 21.0f } }, TestEverything);
+				broadphase.update(reused, Aabb{ { 20.0f, 20.0f }, { 21.0f, 21.0f } }, TestEverything);
+
+				std::vector<BroadphasePair> pairs;
+				broadphase.findPairs(pairs);
+				CHECK(pairs == std::vector<BroadphasePair>{ { std::min(reused, other), std::max(reused, other) } });
+				CHECK(broadphase.getColliderCount() == 2);
+
+				// Ids of removed entities no longer reach the new one.
+				broadphase.remove(removed);
+				CHECK(broadphase.getColliderCount() == 2);
+			}
+		}
+
+		TEST_CASE("Broadphases agree with testing every pair as colliders move", "[Engine][Physics][Broadphase]")
+		{
+			constexpr int ColliderCount = 400;
+			constexpr float WorldSize = 200.0f;
+
+			std::mt19937 random(1234);
+			std::uniform_real_distribution<float> position(0.0f, WorldSize);
+			std::uniform_real_distribution<float> size(0.5f, 8.0f);
+			std::uniform_real_distribution<float> step(-3.0f, 3.0f);
+			std::uniform_int_distribution<uint32_t> layer(0, 2);
+
+			std::vector<TestCollider> colliders;
+			uint32_t nextSlot = 1;
+			const auto spawn = [&]()
+				{
+					const glm::vec2 corner{ position(random), position(random) };
+					const auto bit = 1u << layer(random);
+					colliders.push_back(TestCollider
+						{
+							EntityHandle::make(nextSlot++, 1),
+							Aabb::fromCorner(corner, { size(random), size(random) }),
+							{ .layer = bit, .mask = 0b111u & ~(bit == 4u ? 4u : 0u) }
+						});
+				};
+
+			for (int i = 0; i < ColliderCount; ++i)
+			{
+				spawn();
+			}
+
+			UniformGridBroadphase grid(8.0f);
+			SweepAndPruneBroadphase sap;
+
+			for (int frame = 0; frame < 30; ++frame)
+			{
+				const auto expected = bruteForcePairs(colliders);
+				REQUIRE(updateAndFind(grid, colliders) == expected);
+				REQUIRE(updateAndFind(sap, colliders) == expected);
+
+				// Most move a little, some are destroyed and replaced.
+				for (auto& collider : colliders)
+				{
+					const glm::vec2 offset{ step(random), step(random) };
+					collider.bounds.min += offset;
+					collider.bounds.max += offset;
+				}
+				for (int i = 0; i < 10; ++i)
+				{
+					colliders.erase(colliders.begin() + (frame * 7 + i * 13) % colliders.size());
+					spawn();
+				}
+			}
+		}
+
+		TEST_CASE("Uniform grid cell size has to be positive", "[Engine][Physics][Broadphase]")
+		{
+			CHECK_THROWS_AS(UniformGridBroadphase(0.0f), std::runtime_error);
+			CHECK_THROWS_AS(UniformGridBroadphase(-1.0f), std::runtime_error);
+		}
+	}
+}
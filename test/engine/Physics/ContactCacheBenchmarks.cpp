@@ -0,0 +1,75 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <helsinki/Engine/Physics/ContactCache.hpp>
+#include <random>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace hl
+{
+	namespace test
+	{
+		TEST_CASE("Contact tracking", "[.][benchmark][Engine][Physics][ContactCache]")
+		{
+			constexpr int Updates = 16;
+
+			for (const auto count : { 1000, 10000, 100000 })
+			{
+				// Mostly the same pairs from one update to the next, with a few
+				// percent starting and ending each update.
+				std::mt19937 random(5);
+				std::uniform_int_distribution<int> entity(1, count * 4);
+				std::vector<std::vector<BroadphasePair>> updates(Updates);
+				for (auto& pairs : updates)
+				{
+					for (int i = 0; i < count; ++i)
+					{
+						const auto a = (i % 97 == 0) ? entity(random) : i * 2 + 1;
+						pairs.push_back({ a, a + 1 });
+					}
+				}
+
+				const auto suffix = ", " + std::to_string(count) + " pairs";
+
+				ContactCache contacts;
+				size_t update = 0;
+				BENCHMARK("ContactCache" + suffix)
+				{
+					contacts.update(updates[update++ % Updates]);
+					return contacts.getEntered().size() + contacts.getExited().size();
+				};
+
+				// A node based set rebuilt each update.
+				std::unordered_set<uint64_t> previous;
+				std::unordered_set<uint64_t> current;
+				std::vector<BroadphasePair> entered;
+				std::vector<uint64_t> exited;
+				update = 0;
+				BENCHMARK("std::unordered_set" + suffix)
+				{
+					entered.clear();
+					exited.clear();
+					current.clear();
+					for (const auto& pair : updates[update++ % Updates])
+					{
+						const auto key = (uint64_t)(uint32_t)pair.entityA << 32 | (uint32_t)pair.entityB;
+						if (current.insert(key).second && !previous.contains(key))
+						{
+							entered.push_back(pair);
+						}
+					}
+					for (const auto key : previous)
+					{
+						if (!current.contains(key))
+						{
+							exited.push_back(key);
+						}
+					}
+					std::swap(previous, current);
+					return entered.size() + exited.size();
+				};
+			}
+		}
+	}
+}
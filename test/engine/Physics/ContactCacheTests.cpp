@@ -0,0 +1,136 @@
+#include <catch2/catch_test_macros.hpp>
+#include <helsinki/Engine/Physics/ContactCache.hpp>
+#include <algorithm>
+#include <random>
+#include <set>
+#include <vector>
+
+namespace hl
+{
+	namespace test
+	{
+		using ContactPairs = std::vector<BroadphasePair>;
+
+		TEST_CASE("Contacts are reported when they start and end", "[Engine][Physics][ContactCache]")
+		{
+			ContactCache contacts;
+
+			contacts.update({ { 1, 2 }, { 3, 4 } });
+			CHECK(contacts.getEntered() == ContactPairs{ { 1, 2 }, { 3, 4 } });
+			CHECK(contacts.getExited().empty());
+
+			// Still touching is not news.
+			contacts.update({ { 1, 2 }, { 3, 4 } });
+			CHECK(contacts.getEntered().empty());
+			CHECK(contacts.getStayed().empty());
+			CHECK(contacts.getExited().empty());
+			CHECK(contacts.getContactCount() == 2);
+
+			contacts.update({ { 3, 4 }, { 5, 6 } });
+			CHECK(contacts.getEntered() == ContactPairs{ { 5, 6 } });
+			CHECK(contacts.getExited() == ContactPairs{ { 1, 2 } });
+			CHECK_FALSE(contacts.contains(1, 2));
+			CHECK(contacts.contains(6, 5));
+
+			contacts.update({});
+			CHECK(contacts.getExited() == ContactPairs{ { 3, 4 }, { 5, 6 } });
+			CHECK(contacts.getContactCount() == 0);
+
+			// Touching again starts a new contact.
+			contacts.update({ { 1, 2 } });
+			CHECK(contacts.getEntered() == ContactPairs{ { 1, 2 } });
+		}
+
+		TEST_CASE("Contacts are the same pair either way round and added once an update", "[Engine][Physics][ContactCache]")
+		{
+			ContactCache contacts;
+			contacts.setReportStays(true);
+
+			contacts.beginUpdate();
+			contacts.add(7, 3);
+			contacts.add(3, 7);
+			contacts.add(7, 3);
+			contacts.endUpdate();
+			CHECK(contacts.getEntered() == ContactPairs{ { 3, 7 } });
+			CHECK(contacts.getStayed().empty());
+
+			contacts.beginUpdate();
+			contacts.add(3, 7);
+			contacts.add(7, 3);
+			contacts.endUpdate();
+			CHECK(contacts.getEntered().empty());
+			CHECK(contacts.getStayed() == ContactPairs{ { 3, 7 } });
+			CHECK(contacts.getContactCount() == 1);
+
+			contacts.clear();
+			contacts.update({ { 3, 7 } });
+			CHECK(contacts.getEntered() == ContactPairs{ { 3, 7 } });
+			CHECK(contacts.getExited().empty());
+		}
+
+		TEST_CASE("Contacts match a set of pairs however many come and go", "[Engine][Physics][ContactCache]")
+		{
+			std::mt19937 random(99);
+			std::uniform_int_distribution<int> entity(1, 300);
+			std::uniform_int_distribution<int> chance(0, 99);
+
+			ContactCache contacts;
+			contacts.setReportStays(true);
+			std::set<BroadphasePair> touching;
+
+			for (int update = 0; update < 200; ++update)
+			{
+				// Keeps most pairs, drops some and adds new ones, growing then
+				// shrinking so the table rehashes and empties out.
+				const auto keep = update < 100 ? 90 : 60;
+				ContactPairs pairs;
+				for (const auto& pair : touching)
+				{
+					if (chance(random) < keep)
+					{
+						pairs.push_back(pair);
+					}
+				}
+				for (int i = 0; i < (update < 100 ? 40 : 5); ++i)
+				{
+					const auto a = entity(random);
+					const auto b = entity(random);
+					if (a != b)
+					{
+						pairs.push_back({ std::min(a, b), std::max(a, b) });
+					}
+				}
+				std::shuffle(pairs.begin(), pairs.end(), random);
+
+				contacts.update(pairs);
+
+				const std::set<BroadphasePair> next(pairs.begin(), pairs.end());
+				std::set<BroadphasePair> entered, stayed, exited;
+				for (const auto& pair : next)
+				{
+					(touching.contains(pair) ? stayed : entered).insert(pair);
+				}
+				for (const auto& pair : touching)
+				{
+					if (!next.contains(pair))
+					{
+						exited.insert(pair);
+					}
+				}
+
+				REQUIRE(std::set<BroadphasePair>(contacts.getEntered().begin(), contacts.getEntered().end()) == entered);
+				REQUIRE(std::set<BroadphasePair>(contacts.getStayed().begin(), contacts.getStayed().end()) == stayed);
+				REQUIRE(std::set<BroadphasePair>(contacts.getExited().begin(), contacts.getExited().end()) == exited);
+				REQUIRE(contacts.getEntered().size() + contacts.getStayed().size() == next.size());
+				REQUIRE(contacts.getContactCount() == next.size());
+
+				touching = next;
+			}
+
+			for (const auto& pair : touching)
+			{
+				REQUIRE(contacts.contains(pair.entityB, pair.entityA));
+			}
+		}
+	}
+}
@@ -0,0 +1,45 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <helsinki/Engine/Physics/KinematicSystem.hpp>
+#include <string>
+
+namespace hl
+{
+	namespace test
+	{
+		TEST_CASE("Kinematic integration", "[.][benchmark][Engine][Physics][KinematicSystem]")
+		{
+			for (const auto count : { 1000, 10000, 100000 })
+			{
+				Scene scene;
+				for (int i = 0; i < count; ++i)
+				{
+					auto body = scene.addEntity();
+					body->AddComponent<TransformComponent>();
+					auto kinematic = body->AddComponent<KinematicComponent>();
+					kinematic->velocity = glm::vec3((float)(i % 7), 1.0f, 0.0f);
+					kinematic->acceleration = glm::vec3(0.0f, 9.8f, 0.0f);
+				}
+
+				const auto suffix = ", " + std::to_string(count) + " bodies";
+				const auto query = scene.query<TransformComponent, KinematicComponent>();
+				KinematicSystem kinematics(scene);
+
+				// How the apps moved their entities before there was a system for it.
+				BENCHMARK("Per entity through each" + suffix)
+				{
+					query.each([](Entity&, TransformComponent& transform, KinematicComponent& kinematic)
+						{
+							kinematic.velocity += kinematic.acceleration * (1.0f / 60.0f);
+							transform.SetPosition(transform.GetPosition() + kinematic.velocity * (1.0f / 60.0f));
+						});
+				};
+
+				BENCHMARK("KinematicSystem" + suffix)
+				{
+					kinematics.update(1.0f / 60.0f);
+				};
+			}
+		}
+	}
+}
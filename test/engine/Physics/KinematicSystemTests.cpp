@@ -0,0 +1,105 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <helsinki/Engine/Physics/KinematicSystem.hpp>
+#include <helsinki/Engine/Physics/PhysicsSystem.hpp>
+
+namespace hl
+{
+	namespace test
+	{
+		static Entity* addKinematicBody(Scene& scene, const glm::vec3& velocity, const glm::vec3& acceleration)
+		{
+			auto entity = scene.addEntity();
+			entity->AddComponent<TransformComponent>();
+			auto kinematic = entity->AddComponent<KinematicComponent>();
+			kinematic->velocity = velocity;
+			kinematic->acceleration = acceleration;
+			return entity;
+		}
+
+		TEST_CASE("Integration schemes differ in when velocity picks up acceleration", "[Engine][Physics][KinematicSystem]")
+		{
+			const glm::vec3 acceleration{ 0.0f, 4.0f, -2.0f };
+
+			glm::vec3 velocity{ 1.0f, 0.0f, 0.0f };
+			CHECK(integrateKinematic<IntegrationScheme::ExplicitEuler>(velocity, acceleration, 0.5f) == glm::vec3(0.5f, 0.0f, 0.0f));
+			CHECK(velocity == glm::vec3(1.0f, 2.0f, -1.0f));
+
+			velocity = { 1.0f, 0.0f, 0.0f };
+			CHECK(integrateKinematic<IntegrationScheme::SemiImplicitEuler>(velocity, acceleration, 0.5f) == glm::vec3(0.5f, 1.0f, -0.5f));
+			CHECK(velocity == glm::vec3(1.0f, 2.0f, -1.0f));
+
+			velocity = { 1.0f, 0.0f, 0.0f };
+			CHECK(integrateKinematic<IntegrationScheme::Verlet>(velocity, acceleration, 0.5f) == glm::vec3(0.5f, 0.5f, -0.25f));
+			CHECK(velocity == glm::vec3(1.0f, 2.0f, -1.0f));
+		}
+
+		TEST_CASE("Verlet lands falling bodies where constant acceleration puts them", "[Engine][Physics][KinematicSystem]")
+		{
+			constexpr float Gravity = 9.8f;
+			constexpr int Steps = 120;
+			constexpr float Delta = 1.0f / 60.0f;
+			// Two seconds of falling from rest, gt^2 / 2.
+			constexpr double Exact = 0.5 * Gravity * 2.0 * 2.0;
+
+			const auto fall = [&](IntegrationScheme scheme)
+				{
+					Scene scene;
+					auto body = addKinematicBody(scene, glm::vec3(0.0f), glm::vec3(0.0f, Gravity, 0.0f));
+					KinematicSystem kinematics(scene, scheme);
+					for (int step = 0; step < Steps; ++step)
+					{
+						kinematics.update(Delta);
+					}
+					return body->GetComponent<TransformComponent>()->GetPosition().y;
+				};
+
+			CHECK(fall(IntegrationScheme::Verlet) == Catch::Approx(Exact).margin(0.0001));
+			CHECK(fall(IntegrationScheme::SemiImplicitEuler) > Exact + 0.1);
+			CHECK(fall(IntegrationScheme::ExplicitEuler) < Exact - 0.1);
+		}
+
+		TEST_CASE("KinematicSystem moves every kinematic entity in every archetype", "[Engine][Physics][KinematicSystem]")
+		{
+			Scene scene;
+
+			std::vector<Entity*> bodies;
+			for (int i = 0; i < 600; ++i)
+			{
+				auto body = addKinematicBody(scene, glm::vec3((float)i, 1.0f, 0.0f), glm::vec3(0.0f));
+				if (i % 2 == 0)
+				{
+					body->AddComponent<ColliderComponent>();
+				}
+				bodies.push_back(body);
+			}
+
+			auto still = scene.addEntity();
+			still->AddComponent<TransformComponent>()->SetPosition(glm::vec3(5.0f));
+
+			KinematicSystem kinematics(scene);
+			kinematics.update(0.5f);
+
+			for (int i = 0; i < 600; ++i)
+			{
+				REQUIRE(bodies[i]->GetComponent<TransformComponent>()->GetPosition() == glm::vec3((float)i * 0.5f, 0.5f, 0.0f));
+			}
+			CHECK(still->GetComponent<TransformComponent>()->GetPosition() == glm::vec3(5.0f));
+		}
+
+		TEST_CASE("PhysicsSystem integrates with the scheme it is given", "[Engine][Physics][KinematicSystem]")
+		{
+			Scene scene;
+			auto body = addKinematicBody(scene, glm::vec3(2.0f, 0.0f, 0.0f), glm::vec3(0.0f, 4.0f, 0.0f));
+			body->AddComponent<ColliderComponent>()->size = glm::vec2(1.0f);
+
+			PhysicsSystem physics(scene, IntegrationScheme::Verlet);
+			physics.update(0.5f);
+			CHECK(body->GetComponent<TransformComponent>()->GetPosition() == glm::vec3(1.0f, 0.5f, 0.0f));
+
+			physics.setIntegrationScheme(IntegrationScheme::ExplicitEuler);
+			physics.update(0.5f);
+			CHECK(body->GetComponent<TransformComponent>()->GetPosition() == glm::vec3(2.0f, 1.5f, 0.0f));
+		}
+	}
+}
@@ -0,0 +1,60 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <helsinki/Engine/Physics/PhysicsSystem.hpp>
+#include <cmath>
+#include <random>
+#include <string>
+
+namespace hl
+{
+	namespace test
+	{
+		// Bodies 4 to 12 units across bouncing around a walled arena with, on
+		// average, one per 32x32 area, some fast enough to cross it in a few steps.
+		static void createPhysicsBenchmarkScene(Scene& scene, int count)
+		{
+			const auto arenaSize = std::sqrt((float)count) * 32.0f;
+
+			const auto addWall = [&](const glm::vec2& position, const glm::vec2& size)
+				{
+					auto wall = scene.addEntity();
+					wall->AddComponent<TransformComponent>()->SetPosition(glm::vec3(position.x, position.y, 0.0f));
+					wall->AddComponent<ColliderComponent>()->size = size;
+				};
+			addWall({ -10.0f, -10.0f }, { arenaSize + 20.0f, 10.0f });
+			addWall({ -10.0f, arenaSize }, { arenaSize + 20.0f, 10.0f });
+			addWall({ -10.0f, 0.0f }, { 10.0f, arenaSize });
+			addWall({ arenaSize, 0.0f }, { 10.0f, arenaSize });
+
+			std::mt19937 random(42);
+			std::uniform_real_distribution<float> position(0.0f, arenaSize - 12.0f);
+			std::uniform_real_distribution<float> velocity(-600.0f, 600.0f);
+			std::uniform_real_distribution<float> size(4.0f, 12.0f);
+
+			for (int i = 0; i < count; ++i)
+			{
+				auto body = scene.addEntity();
+				body->AddComponent<TransformComponent>()->SetPosition(glm::vec3(position(random), position(random), 0.0f));
+				body->AddComponent<KinematicComponent>()->velocity = glm::vec3(velocity(random), velocity(random), 0.0f) * (i % 10 == 0 ? 20.0f : 1.0f);
+				body->AddComponent<ColliderComponent>()->size = glm::vec2(size(random));
+			}
+		}
+
+		TEST_CASE("Physics step", "[.][benchmark][Engine][Physics][PhysicsSystem]")
+		{
+			for (const auto count : { 100, 1000, 5000, 10000 })
+			{
+				Scene scene;
+				createPhysicsBenchmarkScene(scene, count);
+				PhysicsSystem physics(scene);
+				physics.update(1.0f / 60.0f);
+
+				BENCHMARK("Physics step, " + std::to_string(count) + " bodies")
+				{
+					physics.update(1.0f / 60.0f);
+					return physics.getContacts().size();
+				};
+			}
+		}
+	}
+}
@@ -0,0 +1,190 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <helsinki/Engine/Physics/PhysicsSystem.hpp>
+#include <helsinki/Engine/Physics/SweptAabb.hpp>
+#include <random>
+#include <vector>
+
+namespace hl
+{
+	namespace test
+	{
+		constexpr float PhysicsTestDelta = 1.0f / 60.0f;
+
+		static Entity* addPhysicsBody(Scene& scene, const glm::vec2& position, const glm::vec2& velocity, const glm::vec2& size, float restitution = 1.0f)
+		{
+			auto entity = scene.addEntity();
+			entity->AddComponent<TransformComponent>()->SetPosition(glm::vec3(position.x, position.y, 0.0f));
+			entity->AddComponent<KinematicComponent>()->velocity = glm::vec3(velocity.x, velocity.y, 0.0f);
+			auto collider = entity->AddComponent<ColliderComponent>();
+			collider->size = size;
+			collider->restitution = restitution;
+			return entity;
+		}
+
+		static Entity* addPhysicsWall(Scene& scene, const glm::vec2& position, const glm::vec2& size)
+		{
+			auto entity = scene.addEntity();
+			entity->AddComponent<TransformComponent>()->SetPosition(glm::vec3(position.x, position.y, 0.0f));
+			entity->AddComponent<ColliderComponent>()->size = size;
+			return entity;
+		}
+
+		TEST_CASE("Swept boxes hit the side they run into", "[Engine][Physics][PhysicsSystem]")
+		{
+			const Aabb wall{ { 10.0f, 0.0f }, { 12.0f, 10.0f } };
+			SweepHit hit;
+
+			REQUIRE(sweepAabb(Aabb{ { 0.0f, 4.0f }, { 2.0f, 6.0f } }, { 16.0f, 0.0f }, wall, hit));
+			CHECK(hit.time == 0.5f);
+			CHECK(hit.normal == glm::vec2(-1.0f, 0.0f));
+
+			// Stopping short, sliding along the top and moving away while touching.
+			CHECK_FALSE(sweepAabb(Aabb{ { 0.0f, 4.0f }, { 2.0f, 6.0f } }, { 7.0f, 0.0f }, wall, hit));
+			CHECK_FALSE(sweepAabb(Aabb{ { 0.0f, -2.0f }, { 2.0f, 0.0f } }, { 20.0f, 0.0f }, wall, hit));
+			CHECK_FALSE(sweepAabb(Aabb{ { 8.0f, 4.0f }, { 10.0f, 6.0f } }, { -5.0f, 0.0f }, wall, hit));
+
+			// Touching and pushing in, or barely inside, still stops.
+			REQUIRE(sweepAabb(Aabb{ { 8.0f, 4.0f }, { 10.0f, 6.0f } }, { 5.0f, 1.0f }, wall, hit));
+			CHECK(hit.time == 0.0f);
+			REQUIRE(sweepAabb(Aabb{ { 8.0f, 4.0f }, { 10.0001f, 6.0f } }, { 5.0f, 0.0f }, wall, hit));
+			CHECK(hit.time == 0.0f);
+			CHECK_FALSE(sweepAabb(Aabb{ { 9.0f, 4.0f }, { 11.0f, 6.0f } }, { 5.0f, 0.0f }, wall, hit));
+
+			REQUIRE(sweepAabb(Aabb{ { 10.0f, 20.0f }, { 11.0f, 21.0f } }, { 0.0f, -20.0f }, wall, hit));
+			CHECK(hit.time == 0.5f);
+			CHECK(hit.normal == glm::vec2(0.0f, 1.0f));
+		}
+
+		TEST_CASE("Bodies without colliders follow their velocity and acceleration", "[Engine][Physics][PhysicsSystem]")
+		{
+			Scene scene;
+			auto entity = scene.addEntity();
+			entity->AddComponent<TransformComponent>();
+			auto kinematic = entity->AddComponent<KinematicComponent>();
+			kinematic->velocity = glm::vec3(1.0f, 2.0f, 3.0f);
+			kinematic->acceleration = glm::vec3(0.0f, 10.0f, 0.0f);
+
+			PhysicsSystem physics(scene);
+			physics.update(0.5f);
+
+			CHECK(entity->GetComponent<KinematicComponent>()->velocity == glm::vec3(1.0f, 7.0f, 3.0f));
+			CHECK(entity->GetComponent<TransformComponent>()->GetPosition() == glm::vec3(0.5f, 3.5f, 1.5f));
+			CHECK(physics.getContacts().empty());
+		}
+
+		TEST_CASE("Fast bodies bounce off thin walls instead of passing through", "[Engine][Physics][PhysicsSystem]")
+		{
+			Scene scene;
+			// Would cover 1000 units a step past a wall 1 unit thick.
+			auto body = addPhysicsBody(scene, { 0.0f, 0.0f }, { 60000.0f, 0.0f }, { 10.0f, 10.0f });
+			auto wall = addPhysicsWall(scene, { 100.0f, -50.0f }, { 1.0f, 100.0f });
+
+			PhysicsSystem physics(scene);
+			physics.update(PhysicsTestDelta);
+
+			const auto position = body->GetComponent<TransformComponent>()->GetPosition();
+			CHECK(position.x + 10.0f <= 100.0f);
+			CHECK(body->GetComponent<KinematicComponent>()->velocity.x < 0.0f);
+
+			REQUIRE(physics.getContacts().size() == 1);
+			const auto& contact = physics.getContacts()[0];
+			CHECK(contact.entityA == body->Id);
+			CHECK(contact.entityB == wall->Id);
+			CHECK(contact.normal == glm::vec2(-1.0f, 0.0f));
+			CHECK(contact.time == Catch::Approx(0.09).margin(0.0001));
+			// 910 of the 1000 units were left after the bounce.
+			CHECK(position.x == Catch::Approx(90.0 - 910.0).margin(0.01));
+		}
+
+		TEST_CASE("Bodies resting on a surface do not sink into it", "[Engine][Physics][PhysicsSystem]")
+		{
+			Scene scene;
+			auto body = addPhysicsBody(scene, { 0.3f, 0.0f }, { 25.0f, 0.0f }, { 1.7f, 1.3f }, 0.0f);
+			body->GetComponent<KinematicComponent>()->acceleration = glm::vec3(0.0f, 98.0f, 0.0f);
+			addPhysicsWall(scene, { -1000.0f, 10.1f }, { 2000.0f, 1.0f });
+
+			PhysicsSystem physics(scene);
+			for (int step = 0; step < 600; ++step)
+			{
+				physics.update(PhysicsTestDelta);
+			}
+
+			const auto position = body->GetComponent<TransformComponent>()->GetPosition();
+			CHECK(position.y + 1.3f == Catch::Approx(10.1).margin(0.0001));
+			// Still sliding along it.
+			CHECK(position.x == Catch::Approx(0.3 + 250.0).margin(0.01));
+			CHECK(body->GetComponent<KinematicComponent>()->velocity.y == 0.0f);
+		}
+
+		TEST_CASE("Moving bodies that cross paths are reported", "[Engine][Physics][PhysicsSystem]")
+		{
+			Scene scene;
+			auto a = addPhysicsBody(scene, { 0.0f, 0.0f }, { 6000.0f, 0.0f }, { 2.0f, 2.0f });
+			auto b = addPhysicsBody(scene, { 60.0f, 0.0f }, { -6000.0f, 0.0f }, { 2.0f, 2.0f });
+			auto far = addPhysicsBody(scene, { 0.0f, 50.0f }, { 0.0f, 0.0f }, { 2.0f, 2.0f });
+
+			PhysicsSystem physics(scene);
+			physics.update(PhysicsTestDelta);
+
+			// They swap sides, passing through each other, but are reported.
+			CHECK(a->GetComponent<TransformComponent>()->GetPosition().x == Catch::Approx(100.0).margin(0.001));
+			REQUIRE(physics.getContacts().size() == 1);
+			CHECK(physics.getContacts()[0].entityA == std::min(a->Id, b->Id));
+			CHECK(physics.getContacts()[0].entityB == std::max(a->Id, b->Id));
+			CHECK(physics.getContacts()[0].time == Catch::Approx(58.0 / 200.0).margin(0.0001));
+			(void)far;
+		}
+
+		TEST_CASE("Physics steps are repeatable and nothing escapes its walls", "[Engine][Physics][PhysicsSystem]")
+		{
+			constexpr float ArenaSize = 1000.0f;
+
+			const auto createArena = [](Scene& scene)
+				{
+					addPhysicsWall(scene, { -10.0f, -10.0f }, { ArenaSize + 20.0f, 10.0f });
+					addPhysicsWall(scene, { -10.0f, ArenaSize }, { ArenaSize + 20.0f, 10.0f });
+					addPhysicsWall(scene, { -10.0f, 0.0f }, { 10.0f, ArenaSize });
+					addPhysicsWall(scene, { ArenaSize, 0.0f }, { 10.0f, ArenaSize });
+
+					std::mt19937 random(2024);
+					std::uniform_real_distribution<float> position(0.0f, ArenaSize - 8.0f);
+					std::uniform_real_distribution<float> velocity(-30000.0f, 30000.0f);
+
+					std::vector<Entity*> bodies;
+					for (int i = 0; i < 500; ++i)
+					{
+						bodies.push_back(addPhysicsBody(scene,
+							{ position(random), position(random) },
+							{ velocity(random), velocity(random) },
+							{ 8.0f, 8.0f }));
+					}
+					return bodies;
+				};
+
+			Scene first;
+			Scene second;
+			const auto firstBodies = createArena(first);
+			const auto secondBodies = createArena(second);
+			PhysicsSystem firstPhysics(first);
+			PhysicsSystem secondPhysics(second);
+
+			for (int step = 0; step < 120; ++step)
+			{
+				firstPhysics.update(PhysicsTestDelta);
+				secondPhysics.update(PhysicsTestDelta);
+				REQUIRE(firstPhysics.getContacts().size() == secondPhysics.getContacts().size());
+			}
+
+			for (size_t i = 0; i < firstBodies.size(); ++i)
+			{
+				const auto position = firstBodies[i]->GetComponent<TransformComponent>()->GetPosition();
+				REQUIRE(position == secondBodies[i]->GetComponent<TransformComponent>()->GetPosition());
+				REQUIRE(position.x >= 0.0f);
+				REQUIRE(position.y >= 0.0f);
+				REQUIRE(position.x + 8.0f <= ArenaSize);
+				REQUIRE(position.y + 8.0f <= ArenaSize);
+			}
+		}
+	}
+}
@@ -0,0 +1,195 @@
+#include <catch2/catch_test_macros.hpp>
+#include <helsinki/Engine/Scene/Scene.hpp>
+#include <vector>
+
+namespace hl
+{
+	namespace test
+	{
+		struct AllocationPositionComponent : Component
+		{
+			float x{ 0.0f };
+			float y{ 0.0f };
+		};
+
+		struct AllocationVelocityComponent : Component
+		{
+			float x{ 0.0f };
+			float y{ 0.0f };
+		};
+
+		struct AllocationHealthComponent : Component
+		{
+			int health{ 10 };
+		};
+
+		// Spawns and despawns a wave of short lived entities through the command
+		// buffer each frame, the same churn Hurricane's enemies and projectiles cause.
+		static void simulateFrame(Scene& scene, Query<AllocationPositionComponent, AllocationVelocityComponent>& moving, int frame)
+		{
+			auto& commands = scene.getCommandBuffer();
+			for (int i = 0; i < 32; ++i)
+			{
+				auto e = commands.createEntity();
+				commands.addTag(e, "ENEMY");
+				commands.addTag(e, "COLLIDER");
+				commands.addComponent<AllocationPositionComponent>(e);
+				commands.addComponent<AllocationVelocityComponent>(e).y = 1.0f;
+				if (i % 2 == 0)
+				{
+					commands.addComponent<AllocationHealthComponent>(e);
+				}
+			}
+
+			moving.each([&](Entity& entity, AllocationPositionComponent& position, AllocationVelocityComponent& velocity)
+				{
+					position.y += velocity.y;
+					if (position.y > 8.0f || (entity.Id + frame) % 7 == 0)
+					{
+						scene.removeEntity(entity.Id);
+					}
+				});
+
+			scene.update();
+		}
+
+		// The same churn as simulateFrame, spawning from a pool instead of
+		// building each entity up component by component.
+		static void simulatePooledFrame(Scene& scene, EntityPool& pool, Query<AllocationPositionComponent, AllocationVelocityComponent>& moving, int frame)
+		{
+			auto& commands = scene.getCommandBuffer();
+			for (int i = 0; i < 32; ++i)
+			{
+				commands.setComponent<AllocationPositionComponent>(commands.spawn(pool)).x = (float)i;
+			}
+
+			moving.each([&](Entity& entity, AllocationPositionComponent& position, AllocationVelocityComponent& velocity)
+				{
+					position.y += velocity.y;
+					if (position.y > 8.0f || (entity.Id + frame) % 7 == 0)
+					{
+						scene.removeEntity(entity.Id);
+					}
+				});
+
+			scene.update();
+		}
+
+		TEST_CASE("Entity and chunk pools recycle removed entities", "[Engine][Scene][Allocation]")
+		{
+			Scene scene;
+
+			std::vector<int> ids;
+			for (int i = 0; i < 1000; ++i)
+			{
+				auto e = scene.addEntity();
+				e->AddComponent<AllocationPositionComponent>();
+				ids.push_back(e->Id);
+			}
+
+			const auto warm = scene.getAllocationStats();
+			CHECK(warm.entities.live == 1000);
+			CHECK(warm.chunks.live > 0);
+
+			for (auto id : ids)
+			{
+				scene.removeEntity(id);
+			}
+			scene.removeEntity(ids[0]);
+			scene.update();
+
+			const auto empty = scene.getAllocationStats();
+			CHECK(empty.entities.live == 0);
+			CHECK(empty.entities.deallocations == 1000);
+			CHECK(empty.chunks.live < warm.chunks.live);
+
+			for (int i = 0; i < 1000; ++i)
+			{
+				scene.addEntity()->AddComponent<AllocationPositionComponent>();
+			}
+
+			const auto refilled = scene.getAllocationStats();
+			CHECK(refilled.entities.live == 1000);
+			CHECK(refilled.entities.blockAllocations == warm.entities.blockAllocations);
+			CHECK(refilled.chunks.blockAllocations == warm.chunks.blockAllocations);
+		}
+
+		TEST_CASE("Reserving a scene pre-allocates its entity pool", "[Engine][Scene][Allocation]")
+		{
+			Scene scene;
+			scene.reserve(5000);
+
+			const auto reserved = scene.getAllocationStats().entities.blockAllocations;
+			for (int i = 0; i < 5000; ++i)
+			{
+				scene.addEntity();
+			}
+
+			CHECK(scene.getAllocationStats().entities.blockAllocations == reserved);
+			CHECK(scene.getAllocationStats().entities.peak == 5000);
+		}
+
+		TEST_CASE("Steady state spawning and despawning allocates no new pool blocks", "[Engine][Scene][Allocation]")
+		{
+			Scene scene;
+			auto moving = scene.query<AllocationPositionComponent, AllocationVelocityComponent>();
+
+			for (int frame = 0; frame < 200; ++frame)
+			{
+				simulateFrame(scene, moving, frame);
+			}
+
+			const auto before = scene.getAllocationStats();
+
+			for (int frame = 200; frame < 400; ++frame)
+			{
+				simulateFrame(scene, moving, frame);
+			}
+
+			const auto after = scene.getAllocationStats();
+
+			CHECK(after.entities.blockAllocations == before.entities.blockAllocations);
+			CHECK(after.chunks.blockAllocations == before.chunks.blockAllocations);
+			CHECK(after.entities.reservedBytes == before.entities.reservedBytes);
+			CHECK(after.chunks.reservedBytes == before.chunks.reservedBytes);
+			CHECK(after.entities.allocations > before.entities.allocations);
+			CHECK_FALSE(scene.getEntities().empty());
+		}
+
+		TEST_CASE("Spawning from an entity pool builds no new entities", "[Engine][Scene][Allocation]")
+		{
+			Scene scene;
+			auto moving = scene.query<AllocationPositionComponent, AllocationVelocityComponent>();
+
+			Prefab prefab;
+			prefab.addTag("ENEMY").addTag("COLLIDER");
+			prefab.addComponent<AllocationPositionComponent>();
+			prefab.addComponent<AllocationVelocityComponent>().y = 1.0f;
+			prefab.addComponent<AllocationHealthComponent>();
+			auto& pool = scene.createPool(std::move(prefab), 256);
+
+			for (int frame = 0; frame < 200; ++frame)
+			{
+				simulatePooledFrame(scene, pool, moving, frame);
+			}
+
+			const auto before = scene.getAllocationStats();
+			const auto poolBefore = pool.getStats();
+
+			for (int frame = 200; frame < 400; ++frame)
+			{
+				simulatePooledFrame(scene, pool, moving, frame);
+			}
+
+			const auto after = scene.getAllocationStats();
+
+			CHECK(after.entities.blockAllocations == before.entities.blockAllocations);
+			CHECK(after.chunks.blockAllocations == before.chunks.blockAllocations);
+			CHECK(pool.getStats().grows == poolBefore.grows);
+			CHECK(pool.getStats().spawns == poolBefore.spawns + 200 * 32);
+			CHECK(after.prefabPools.grows == before.prefabPools.grows);
+			CHECK(after.prefabPools.spawns == pool.getStats().spawns);
+			CHECK_FALSE(scene.getEntities().empty());
+		}
+	}
+}
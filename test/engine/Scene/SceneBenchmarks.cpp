@@ -0,0 +1,79 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <helsinki/Engine/Scene/Scene.hpp>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace hl
+{
+	namespace test
+	{
+		TEST_CASE("Entity lookup", "[.][benchmark][Engine][Scene]")
+		{
+			const int entityCount = 10000;
+
+			Scene scene;
+			std::vector<int> ids;
+			std::vector<std::string> names;
+			for (int i = 0; i < entityCount; ++i)
+			{
+				names.push_back("Entity" + std::to_string(i));
+				ids.push_back(scene.addEntity(names.back())->Id);
+			}
+
+			// Sample lookups spread across the whole scene, as collision events would.
+			std::vector<size_t> lookups;
+			for (size_t i = 0; i < 1000; ++i)
+			{
+				lookups.push_back((i * 7919) % entityCount);
+			}
+
+			const auto& entities = scene.getEntities();
+
+			BENCHMARK("Linear getEntity(id) 10k")
+			{
+				size_t found = 0;
+				for (const auto l : lookups)
+				{
+					const auto id = ids[l];
+					auto it = std::find_if(entities.begin(), entities.end(), [id](const Scene::EntityPointer& e) { return e->Id == id; });
+					found += it != entities.end();
+				}
+				return found;
+			};
+
+			BENCHMARK("Slot map getEntity(id) 10k")
+			{
+				size_t found = 0;
+				for (const auto l : lookups)
+				{
+					found += scene.getEntity(ids[l]) != nullptr;
+				}
+				return found;
+			};
+
+			BENCHMARK("Linear getEntity(name) 10k")
+			{
+				size_t found = 0;
+				for (const auto l : lookups)
+				{
+					const auto& name = names[l];
+					auto it = std::find_if(entities.begin(), entities.end(), [&name](const Scene::EntityPointer& e) { return e->getName() == name; });
+					found += it != entities.end();
+				}
+				return found;
+			};
+
+			BENCHMARK("Hashed getEntity(name) 10k")
+			{
+				size_t found = 0;
+				for (const auto l : lookups)
+				{
+					found += scene.getEntity(names[l]) != nullptr;
+				}
+				return found;
+			};
+		}
+	}
+}
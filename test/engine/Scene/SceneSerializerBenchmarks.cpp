@@ -0,0 +1,59 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <helsinki/Engine/Scene/SceneSerializer.hpp>
+#include <helsinki/Engine/ECS/Components/TransformComponent.hpp>
+#include <helsinki/Engine/ECS/Components/KinematicComponent.hpp>
+#include <helsinki/Engine/ECS/Components/SpriteComponent.hpp>
+#include <string>
+
+namespace hl
+{
+	namespace test
+	{
+		static void populateScene(Scene& scene, int entityCount)
+		{
+			for (int i = 0; i < entityCount; ++i)
+			{
+				auto e = scene.addEntity("Entity" + std::to_string(i));
+				e->AddTag(i % 2 == 0 ? "ENEMY" : "BULLET");
+				e->AddComponent<TransformComponent>()->SetPosition({ (float)i, 0.0f, 0.0f });
+				e->AddComponent<SpriteComponent>()->setFrameDataIndex(i % 16);
+				if (i % 4 == 0)
+				{
+					e->AddComponent<KinematicComponent>()->velocity = { 1.0f, 0.0f, 0.0f };
+				}
+			}
+		}
+
+		TEST_CASE("Scene loading", "[.][benchmark][Engine][Scene][SceneSerializer]")
+		{
+			constexpr int EntityCount = 100000;
+
+			SceneSerializer serializer;
+			serializer.registerEngineComponents();
+
+			Scene source;
+			populateScene(source, EntityCount);
+			const auto data = serializer.save(source);
+
+			BENCHMARK("Build 100k entities in code")
+			{
+				Scene scene;
+				populateScene(scene, EntityCount);
+				return scene.getEntities().size();
+			};
+
+			BENCHMARK("Load 100k entities from binary")
+			{
+				Scene scene;
+				serializer.load(scene, data);
+				return scene.getEntities().size();
+			};
+
+			BENCHMARK("Save 100k entities to binary")
+			{
+				return serializer.save(source).size();
+			};
+		}
+	}
+}
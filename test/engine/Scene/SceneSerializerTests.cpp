@@ -0,0 +1,299 @@
+#include <catch2/catch_test_macros.hpp>
+#include <helsinki/Engine/Scene/SceneSerializer.hpp>
+#include <helsinki/Engine/ECS/Components/TransformComponent.hpp>
+#include <helsinki/Engine/ECS/Components/KinematicComponent.hpp>
+#include <helsinki/Engine/ECS/Components/SpriteComponent.hpp>
+#include <stdexcept>
+
+namespace hl
+{
+	namespace test
+	{
+		class SerializerTestComponent : public Component
+		{
+		public:
+			int32_t count{ 0 };
+			uint32_t flags{ 0 };
+			bool enabled{ false };
+			glm::vec2 size{};
+			glm::vec4 colour{};
+			std::string label;
+			int target{ EntityHandle::Invalid };
+
+			int getTarget() const { return target; }
+			void setTarget(int id) { target = id; }
+		};
+
+		class SerializerUnregisteredComponent : public Component
+		{
+		public:
+			int value{ 0 };
+		};
+
+		static SceneSerializer createSerializer()
+		{
+			SceneSerializer serializer;
+			serializer.registerEngineComponents();
+			serializer.registerComponent<SerializerTestComponent>("Test")
+				.field<&SerializerTestComponent::count>("count")
+				.field<&SerializerTestComponent::flags>("flags")
+				.field<&SerializerTestComponent::enabled>("enabled")
+				.field<&SerializerTestComponent::size>("size")
+				.field<&SerializerTestComponent::colour>("colour")
+				.field<&SerializerTestComponent::label>("label")
+				.entityField<&SerializerTestComponent::getTarget, &SerializerTestComponent::setTarget>("target");
+			return serializer;
+		}
+
+		TEST_CASE("Saved scenes load with their names, tags and components", "[Engine][Scene][SceneSerializer]")
+		{
+			const auto serializer = createSerializer();
+
+			Scene source;
+			auto parent = source.addEntity("Parent");
+			parent->AddTag("PLAYER");
+			auto parentTransform = parent->AddComponent<TransformComponent>();
+			parentTransform->SetPosition({ 1.0f, 2.0f, 3.0f });
+			parentTransform->SetScale({ 2.0f, 2.0f, 2.0f });
+			parent->AddComponent<KinematicComponent>()->velocity = { 4.0f, 5.0f, 6.0f };
+
+			auto child = source.addEntity("Child");
+			child->AddTag("ENEMY");
+			child->AddTag("PLAYER");
+			child->AddComponent<TransformComponent>()->SetParent(parent->Id);
+			child->AddComponent<SpriteComponent>()->setFrameDataIndex(7);
+			auto test = child->AddComponent<SerializerTestComponent>();
+			test->count = -3;
+			test->flags = 0xF0F0u;
+			test->enabled = true;
+			test->size = { 8.0f, 9.0f };
+			test->colour = { 0.1f, 0.2f, 0.3f, 0.4f };
+			test->label = "Child";
+			test->target = parent->Id;
+
+			source.addEntity();
+
+			const auto data = serializer.save(source);
+
+			Scene loaded;
+			// Pre-existing content shifts ids and tag indices, references have to be remapped.
+			loaded.addEntity("Existing")->AddTag("ENEMY");
+			serializer.load(loaded, data);
+
+			REQUIRE(loaded.getEntities().size() == 4);
+
+			auto loadedParent = loaded.getEntity("Parent");
+			auto loadedChild = loaded.getEntity("Child");
+			REQUIRE(loadedParent != nullptr);
+			REQUIRE(loadedChild != nullptr);
+
+			CHECK(loadedParent->HasTag("PLAYER"));
+			CHECK_FALSE(loadedParent->HasTag("ENEMY"));
+			CHECK(loadedChild->HasTag("PLAYER"));
+			CHECK(loadedChild->HasTag("ENEMY"));
+			CHECK(loaded.getEntitiesByTag("ENEMY").size() == 2);
+
+			REQUIRE(loadedParent->HasComponent<TransformComponent>());
+			CHECK(loadedParent->GetComponent<TransformComponent>()->GetPosition() == glm::vec3(1.0f, 2.0f, 3.0f));
+			CHECK(loadedParent->GetComponent<TransformComponent>()->GetScale() == glm::vec3(2.0f, 2.0f, 2.0f));
+			CHECK(loadedParent->GetComponent<KinematicComponent>()->velocity == glm::vec3(4.0f, 5.0f, 6.0f));
+			CHECK_FALSE(loadedParent->HasComponent<SerializerTestComponent>());
+
+			CHECK(loadedChild->GetComponent<TransformComponent>()->GetParent() == loadedParent->Id);
+			CHECK(loadedChild->GetComponent<SpriteComponent>()->getFrameDataIndex() == 7);
+
+			auto loadedTest = loadedChild->GetComponent<SerializerTestComponent>();
+			REQUIRE(loadedTest != nullptr);
+			CHECK(loadedTest->count == -3);
+			CHECK(loadedTest->flags == 0xF0F0u);
+			CHECK(loadedTest->enabled);
+			CHECK(loadedTest->size == glm::vec2(8.0f, 9.0f));
+			CHECK(loadedTest->colour == glm::vec4(0.1f, 0.2f, 0.3f, 0.4f));
+			CHECK(loadedTest->label == "Child");
+			CHECK(loadedTest->target == loadedParent->Id);
+
+			loaded.update();
+			const auto world = loaded.getWorldMatrix(*loadedChild->GetComponent<TransformComponent>());
+			CHECK(world[3].x == 1.0f);
+			CHECK(world[3].y == 2.0f);
+			CHECK(world[3].z == 3.0f);
+		}
+
+		TEST_CASE("Tagged entities are loaded straight into their tagged archetype", "[Engine][Scene][SceneSerializer]")
+		{
+			const auto serializer = createSerializer();
+
+			Scene source;
+			for (int i = 0; i < 3; ++i)
+			{
+				auto e = source.addEntity();
+				e->AddTag("ENEMY");
+				e->AddTag("BOSS");
+				e->AddComponent<TransformComponent>()->SetPosition({ (float)i, 0.0f, 0.0f });
+			}
+			const auto data = serializer.save(source);
+
+			Scene loaded;
+			const auto archetypes = loaded.getStorage().getArchetypes().size();
+			serializer.load(loaded, data);
+
+			// No archetypes for the entities on their way to having both tags.
+			CHECK(loaded.getStorage().getArchetypes().size() == archetypes + 1);
+			REQUIRE(loaded.getEntities().size() == 3);
+			for (const auto& e : loaded.getEntities())
+			{
+				CHECK(e->HasTag("ENEMY"));
+				CHECK(e->HasTag("BOSS"));
+				CHECK(e->getLocation().archetype == loaded.getEntities().front()->getLocation().archetype);
+				CHECK(e->getLocation().archetype->getTags() == e->getTags());
+				CHECK(e->GetComponent<TransformComponent>()->GetPosition().x == (float)e->getLocation().row);
+			}
+			CHECK(loaded.getEntitiesByTag("BOSS").size() == 3);
+			CHECK(loaded.query<TransformComponent>("ENEMY").size() == 3);
+		}
+
+		TEST_CASE("Entity fields referring to entities outside the save are cleared", "[Engine][Scene][SceneSerializer]")
+		{
+			const auto serializer = createSerializer();
+
+			Scene source;
+			auto removed = source.addEntity();
+			auto e = source.addEntity();
+			e->AddComponent<TransformComponent>()->SetParent(removed->Id);
+			source.removeEntity(removed->Id);
+			source.update();
+
+			Scene loaded;
+			serializer.load(loaded, serializer.save(source));
+
+			REQUIRE(loaded.getEntities().size() == 1);
+			CHECK(loaded.getEntities()[0]->GetComponent<TransformComponent>()->GetParent() == EntityHandle::Invalid);
+		}
+
+		TEST_CASE("Unregistered components are not saved", "[Engine][Scene][SceneSerializer]")
+		{
+			const auto serializer = createSerializer();
+
+			Scene source;
+			auto e = source.addEntity("E");
+			e->AddComponent<SerializerUnregisteredComponent>()->value = 5;
+			e->AddComponent<SpriteComponent>()->setFrameDataIndex(2);
+
+			Scene loaded;
+			serializer.load(loaded, serializer.save(source));
+
+			auto loadedEntity = loaded.getEntity("E");
+			REQUIRE(loadedEntity != nullptr);
+			CHECK_FALSE(loadedEntity->HasComponent<SerializerUnregisteredComponent>());
+			CHECK(loadedEntity->GetComponent<SpriteComponent>()->getFrameDataIndex() == 2);
+		}
+
+		TEST_CASE("Components and fields missing from the loading serializer are skipped", "[Engine][Scene][SceneSerializer]")
+		{
+			const auto writer = createSerializer();
+
+			Scene source;
+			auto e = source.addEntity("E");
+			auto test = e->AddComponent<SerializerTestComponent>();
+			test->count = 11;
+			test->label = "Skipped";
+			e->AddComponent<KinematicComponent>()->acceleration = { 1.0f, 1.0f, 1.0f };
+			e->AddComponent<SpriteComponent>()->setFrameDataIndex(3);
+
+			// An older build that knows fewer fields and no kinematic component.
+			SceneSerializer reader;
+			reader.registerComponent<SerializerTestComponent>("Test")
+				.field<&SerializerTestComponent::count>("count");
+			reader.registerComponent<SpriteComponent>("Sprite")
+				.field<&SpriteComponent::getFrameDataIndex, &SpriteComponent::setFrameDataIndex>("frameDataIndex");
+
+			Scene loaded;
+			reader.load(loaded, writer.save(source));
+
+			auto loadedEntity = loaded.getEntity("E");
+			REQUIRE(loadedEntity != nullptr);
+			CHECK_FALSE(loadedEntity->HasComponent<KinematicComponent>());
+			CHECK(loadedEntity->GetComponent<SerializerTestComponent>()->count == 11);
+			CHECK(loadedEntity->GetComponent<SerializerTestComponent>()->label.empty());
+			CHECK(loadedEntity->GetComponent<SpriteComponent>()->getFrameDataIndex() == 3);
+		}
+
+		TEST_CASE("Invalid scene data is rejected", "[Engine][Scene][SceneSerializer]")
+		{
+			const auto serializer = createSerializer();
+
+			Scene source;
+			for (int i = 0; i < 10; ++i)
+			{
+				source.addEntity("Entity" + std::to_string(i))->AddComponent<TransformComponent>();
+			}
+			const auto data = serializer.save(source);
+
+			SECTION("Wrong magic")
+			{
+				auto copy = data;
+				copy[0] = std::byte{ 'X' };
+
+				Scene loaded;
+				CHECK_THROWS_AS(serializer.load(loaded, copy), std::runtime_error);
+				CHECK(loaded.getEntities().empty());
+			}
+
+			SECTION("Newer version")
+			{
+				auto copy = data;
+				const uint32_t version = SceneSerializer::Version + 1;
+				std::memcpy(copy.data() + 4, &version, sizeof(version));
+
+				Scene loaded;
+				CHECK_THROWS_AS(serializer.load(loaded, copy), std::runtime_error);
+			}
+
+			SECTION("Truncated")
+			{
+				// Drop the string table and the end of the component data.
+				Scene loaded;
+				const auto truncated = std::span<const std::byte>(data).first(data.size() / 2);
+				CHECK_THROWS_AS(serializer.load(loaded, truncated), std::runtime_error);
+				CHECK(loaded.getEntities().empty());
+
+				loaded.update();
+				CHECK(loaded.getEntity("Entity0") == nullptr);
+			}
+
+			SECTION("Counts larger than the data")
+			{
+				// Component count, then entity count.
+				for (const size_t offset : { 8, 20 })
+				{
+					auto copy = data;
+					const uint32_t count = 0xFFFFFFF0u;
+					std::memcpy(copy.data() + offset, &count, sizeof(count));
+
+					Scene loaded;
+					CHECK_THROWS_AS(serializer.load(loaded, copy), std::runtime_error);
+					CHECK(loaded.getEntities().empty());
+				}
+			}
+		}
+
+		TEST_CASE("Scenes can be exported as JSON", "[Engine][Scene][SceneSerializer]")
+		{
+			const auto serializer = createSerializer();
+
+			Scene scene;
+			auto e = scene.addEntity("Player");
+			e->AddTag("PLAYER");
+			e->AddComponent<SpriteComponent>()->setFrameDataIndex(4);
+			e->AddComponent<SerializerTestComponent>()->label = "Hello";
+
+			const auto json = serializer.toJson(scene);
+
+			CHECK(json.find("\"name\": \"Player\"") != std::string::npos);
+			CHECK(json.find("\"Sprite\": {") != std::string::npos);
+			CHECK(json.find("\"frameDataIndex\": 4") != std::string::npos);
+			CHECK(json.find("\"label\": \"Hello\"") != std::string::npos);
+			CHECK(json.find(std::format("{:#010x}", "PLAYER"_hash)) != std::string::npos);
+		}
+	}
+}
@@ -0,0 +1,160 @@
+#include <catch2/catch_test_macros.hpp>
+#include <helsinki/Engine/Scene/Scene.hpp>
+#include <helsinki/Engine/ECS/Components/TransformComponent.hpp>
+#include <vector>
+
+namespace hl
+{
+	namespace test
+	{
+		// Left out of checksums, like anything only used for drawing.
+		struct SceneUnchecksummedComponent : Component
+		{
+			int frame{ 0 };
+		};
+
+		static Scene& buildChecksumScene(Scene& scene)
+		{
+			for (int i = 0; i < 3; ++i)
+			{
+				auto e = scene.addEntity();
+				e->AddTag("Enemy");
+				e->AddComponent<TransformComponent>()->SetPosition(glm::vec3((float)i, 2.0f, 0.0f));
+				e->AddComponent<SceneUnchecksummedComponent>();
+			}
+			return scene;
+		}
+
+		TEST_CASE("Entities can be looked up by id and name", "[Engine][Scene]")
+		{
+			Scene scene;
+
+			auto a = scene.addEntity();
+			auto b = scene.addEntity("Player");
+
+			CHECK(a->Id != EntityHandle::Invalid);
+			CHECK(a->Id != b->Id);
+			CHECK(scene.getEntity(a->Id) == a);
+			CHECK(scene.getEntity(b->Id) == b);
+			CHECK(scene.getEntity("Player") == b);
+			CHECK(scene.getEntity("Enemy") == nullptr);
+			CHECK(scene.addEntity("Player") == b);
+		}
+
+		TEST_CASE("Removed entity ids become stale once their slot is reused", "[Engine][Scene]")
+		{
+			Scene scene;
+
+			auto e = scene.addEntity("Ball");
+			const auto staleId = e->Id;
+
+			CHECK_FALSE(scene.isPendingRemoval(staleId));
+			scene.removeEntity(staleId);
+			CHECK(scene.getEntity(staleId) == e);
+			CHECK(scene.isPendingRemoval(staleId));
+
+			scene.update();
+			CHECK_FALSE(scene.isValid(staleId));
+			CHECK_FALSE(scene.isPendingRemoval(staleId));
+			CHECK(scene.getEntity(staleId) == nullptr);
+			CHECK(scene.getEntity("Ball") == nullptr);
+
+			auto reused = scene.addEntity("Ball");
+			CHECK(EntityHandle::index(reused->Id) == EntityHandle::index(staleId));
+			CHECK(EntityHandle::generation(reused->Id) != EntityHandle::generation(staleId));
+			CHECK(scene.getEntity(staleId) == nullptr);
+			CHECK(scene.getEntity(reused->Id) == reused);
+			CHECK(scene.getEntity("Ball") == reused);
+
+			scene.removeEntity(staleId);
+			scene.update();
+			CHECK(scene.getEntity(reused->Id) == reused);
+		}
+
+		TEST_CASE("Lookups stay correct after removing entities from the middle", "[Engine][Scene]")
+		{
+			Scene scene;
+
+			std::vector<int> ids;
+			for (int i = 0; i < 100; ++i)
+			{
+				ids.push_back(scene.addEntity()->Id);
+			}
+
+			for (int i = 0; i < 100; i += 2)
+			{
+				scene.removeEntity(ids[i]);
+			}
+			scene.update();
+
+			REQUIRE(scene.getEntities().size() == 50);
+			for (int i = 0; i < 100; ++i)
+			{
+				const auto e = scene.getEntity(ids[i]);
+				if (i % 2 == 0)
+				{
+					CHECK(e == nullptr);
+				}
+				else
+				{
+					REQUIRE(e != nullptr);
+					CHECK(e->Id == ids[i]);
+				}
+			}
+
+			// Surviving entities keep their relative order.
+			for (size_t i = 0; i < scene.getEntities().size(); ++i)
+			{
+				CHECK(scene.getEntities()[i]->Id == ids[i * 2 + 1]);
+			}
+		}
+
+		TEST_CASE("Entity handle packs index and generation", "[Engine][Scene][EntityHandle]")
+		{
+			constexpr auto handle = EntityHandle::make(1234, 56);
+
+			STATIC_REQUIRE(EntityHandle::index(handle) == 1234);
+			STATIC_REQUIRE(EntityHandle::generation(handle) == 56);
+			STATIC_REQUIRE(EntityHandle::nextGeneration(EntityHandle::GenerationMask) == 1);
+			STATIC_REQUIRE(EntityHandle::index(EntityHandle::make(EntityHandle::IndexMask, EntityHandle::GenerationMask)) == EntityHandle::IndexMask);
+		}
+
+		TEST_CASE("Scene checksums match for the same state and change with it", "[Engine][Scene]")
+		{
+			Scene first;
+			Scene second;
+			buildChecksumScene(first);
+			buildChecksumScene(second);
+			CHECK(first.checksum() == second.checksum());
+
+			// Only checksummed components count.
+			second.getEntities()[0]->GetComponent<SceneUnchecksummedComponent>()->frame = 5;
+			CHECK(first.checksum() == second.checksum());
+
+			auto transform = second.getEntities()[1]->GetComponent<TransformComponent>();
+			transform->SetPosition(transform->GetPosition() + glm::vec3(0.0f, 0.0001f, 0.0f));
+			CHECK(first.checksum() != second.checksum());
+			transform->SetPosition(first.getEntities()[1]->GetComponent<TransformComponent>()->GetPosition());
+			CHECK(first.checksum() == second.checksum());
+
+			second.getRandom().next();
+			CHECK(first.checksum() != second.checksum());
+			first.getRandom().next();
+			CHECK(first.checksum() == second.checksum());
+
+			second.getEntities()[2]->AddTag("Boss");
+			CHECK(first.checksum() != second.checksum());
+		}
+
+		TEST_CASE("Deterministic scenes reseed their random numbers and update serially", "[Engine][Scene]")
+		{
+			Scene scene;
+			scene.getRandom().next();
+			CHECK_FALSE(scene.isDeterministic());
+
+			scene.setDeterministic(99);
+			CHECK(scene.isDeterministic());
+			CHECK(scene.getRandom().getState() == Random(99).getState());
+		}
+	}
+}
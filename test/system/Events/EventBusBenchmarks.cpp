@@ -0,0 +1,420 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <helsinki/System/Events/EventBus.hpp>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace hl
+{
+	namespace test
+	{
+		// Mirrors the shape of Hurricane's collision event, once as a broadcast
+		// event and once as a plain typed event.
+		class BenchmarkLegacyCollisionEvent : public Event
+		{
+		public:
+			BenchmarkLegacyCollisionEvent(int a, int b) : _a(a), _b(b) {}
+
+			int getEntityAId() const { return _a; }
+			int getEntityBId() const { return _b; }
+
+			DEFINE_EVENT_TYPE(BenchmarkLegacyCollisionEvent)
+
+		private:
+			int _a;
+			int _b;
+		};
+
+		class BenchmarkLegacyOtherEvent : public Event
+		{
+		public:
+			DEFINE_EVENT_TYPE(BenchmarkLegacyOtherEvent)
+		};
+
+		struct BenchmarkCollisionEvent
+		{
+			int entityAId;
+			int entityBId;
+		};
+
+		struct BenchmarkOtherEvent
+		{
+			int value;
+		};
+
+		class BenchmarkLegacyCollisionListener : public EventListener
+		{
+		public:
+			void OnEvent(const Event& event) override
+			{
+				if (auto ce = dynamic_cast<const BenchmarkLegacyCollisionEvent*>(&event))
+				{
+					sum += ce->getEntityAId() + ce->getEntityBId();
+				}
+			}
+
+			long long sum{ 0 };
+		};
+
+		class BenchmarkLegacyOtherListener : public EventListener
+		{
+		public:
+			void OnEvent(const Event& event) override
+			{
+				if (dynamic_cast<const BenchmarkLegacyOtherEvent*>(&event) != nullptr)
+				{
+					count++;
+				}
+			}
+
+			int count{ 0 };
+		};
+
+		class BenchmarkCollisionListener
+		{
+		public:
+			void OnCollision(const BenchmarkCollisionEvent& event)
+			{
+				sum += event.entityAId + event.entityBId;
+			}
+
+			long long sum{ 0 };
+		};
+
+		class BenchmarkOtherListener
+		{
+		public:
+			void OnOther(const BenchmarkOtherEvent&)
+			{
+				count++;
+			}
+
+			int count{ 0 };
+		};
+
+		TEST_CASE("Publishing collision events", "[.][benchmark][Events][EventBus]")
+		{
+			constexpr int EventCount = 100000;
+			constexpr int UnrelatedListenerCount = 10;
+
+			std::vector<BenchmarkLegacyOtherListener> legacyOthers(UnrelatedListenerCount);
+			std::vector<BenchmarkOtherListener> others(UnrelatedListenerCount);
+			BenchmarkLegacyCollisionListener legacyCollisions;
+			BenchmarkCollisionListener collisions;
+
+			for (const auto immediate : { true, false })
+			{
+				EventBus bus;
+				bus.SetImmediateMode(immediate);
+
+				for (auto& other : legacyOthers)
+				{
+					bus.AddListener(&other);
+				}
+				bus.AddListener(&legacyCollisions);
+
+				for (auto& other : others)
+				{
+					bus.Subscribe<&BenchmarkOtherListener::OnOther>(&other);
+				}
+				bus.Subscribe<&BenchmarkCollisionListener::OnCollision>(&collisions);
+
+				BENCHMARK(immediate ? "Broadcast + dynamic_cast, immediate" : "Broadcast + dynamic_cast, queued")
+				{
+					for (int i = 0; i < EventCount; ++i)
+					{
+						bus.PublishEvent(BenchmarkLegacyCollisionEvent(i, i + 1));
+					}
+					bus.ProcessEvents();
+					return legacyCollisions.sum;
+				};
+
+				BENCHMARK(immediate ? "Typed channel, immediate" : "Typed channel, queued")
+				{
+					for (int i = 0; i < EventCount; ++i)
+					{
+						bus.Publish(BenchmarkCollisionEvent{ i, i + 1 });
+					}
+					bus.ProcessEvents();
+					return collisions.sum;
+				};
+			}
+		}
+
+		// The engine's old ECS EventSystem, a vector of listeners each sent
+		// every event.
+		class BenchmarkEventSystem
+		{
+		public:
+			void AddListener(EventListener* listener)
+			{
+				_listeners.push_back(listener);
+			}
+
+			void DispatchEvent(const Event& event)
+			{
+				for (auto listener : _listeners)
+				{
+					listener->OnEvent(event);
+				}
+			}
+
+		private:
+			std::vector<EventListener*> _listeners;
+		};
+
+		TEST_CASE("Dispatching through the old EventSystem and the EventBus", "[.][benchmark][Events][EventBus]")
+		{
+			constexpr int EventCount = 100000;
+			constexpr int UnrelatedListenerCount = 10;
+
+			std::vector<BenchmarkLegacyOtherListener> legacyOthers(UnrelatedListenerCount);
+			std::vector<BenchmarkOtherListener> others(UnrelatedListenerCount);
+			BenchmarkLegacyCollisionListener legacyCollisions;
+			BenchmarkCollisionListener collisions;
+
+			BenchmarkEventSystem eventSystem;
+			for (auto& other : legacyOthers)
+			{
+				eventSystem.AddListener(&other);
+			}
+			eventSystem.AddListener(&legacyCollisions);
+
+			EventBus bus;
+			std::vector<EventSubscription> subscriptions;
+			for (auto& other : legacyOthers)
+			{
+				subscriptions.push_back(bus.AddScopedListener(&other));
+			}
+			subscriptions.push_back(bus.AddScopedListener(&legacyCollisions));
+			for (auto& other : others)
+			{
+				subscriptions.push_back(bus.SubscribeScoped<&BenchmarkOtherListener::OnOther>(&other));
+			}
+			subscriptions.push_back(bus.SubscribeScoped<&BenchmarkCollisionListener::OnCollision>(&collisions));
+
+			BENCHMARK("EventSystem")
+			{
+				for (int i = 0; i < EventCount; ++i)
+				{
+					eventSystem.DispatchEvent(BenchmarkLegacyCollisionEvent(i, i + 1));
+				}
+				return legacyCollisions.sum;
+			};
+
+			BENCHMARK("EventBus listeners")
+			{
+				for (int i = 0; i < EventCount; ++i)
+				{
+					bus.PublishEvent(BenchmarkLegacyCollisionEvent(i, i + 1));
+				}
+				return legacyCollisions.sum;
+			};
+
+			BENCHMARK("EventBus typed subscribers")
+			{
+				for (int i = 0; i < EventCount; ++i)
+				{
+					bus.Publish(BenchmarkCollisionEvent{ i, i + 1 });
+				}
+				return collisions.sum;
+			};
+		}
+
+		TEST_CASE("Dispatching collision events in a phase", "[.][benchmark][Events][EventBus]")
+		{
+			constexpr int EventCount = 100000;
+
+			BenchmarkCollisionListener collisions;
+
+			EventBus immediate;
+			immediate.Subscribe<&BenchmarkCollisionListener::OnCollision>(&collisions);
+
+			EventBus phased;
+			phased.Subscribe<&BenchmarkCollisionListener::OnCollision>(&collisions);
+			phased.SetPhase<BenchmarkCollisionEvent>(EventPhase::PostPhysics);
+
+			BENCHMARK("Dispatched as published")
+			{
+				for (int i = 0; i < EventCount; ++i)
+				{
+					immediate.Publish(BenchmarkCollisionEvent{ i, i + 1 });
+				}
+				return collisions.sum;
+			};
+
+			BENCHMARK("Batched into the post physics phase")
+			{
+				for (int i = 0; i < EventCount; ++i)
+				{
+					phased.Publish(BenchmarkCollisionEvent{ i, i + 1 });
+				}
+				phased.ProcessEvents(EventPhase::PostPhysics);
+				return collisions.sum;
+			};
+		}
+
+		// The deferred queue EventBus used before, a mutex around a queue of
+		// heap allocated clones.
+		class BenchmarkLockedEventQueue
+		{
+		public:
+			void Publish(const Event& event)
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+				_queue.push(std::unique_ptr<Event>(event.Clone()));
+			}
+
+			void Process(EventListener& listener)
+			{
+				std::queue<std::unique_ptr<Event>> current;
+				{
+					std::lock_guard<std::mutex> lock(_mutex);
+					std::swap(current, _queue);
+				}
+
+				while (!current.empty())
+				{
+					listener.OnEvent(*current.front());
+					current.pop();
+				}
+			}
+
+		private:
+			std::mutex _mutex;
+			std::queue<std::unique_ptr<Event>> _queue;
+		};
+
+		// Threads kept alive across benchmark runs, so what is measured is the
+		// publishing rather than starting threads.
+		class BenchmarkProducers
+		{
+		public:
+			explicit BenchmarkProducers(int count)
+			{
+				for (int i = 0; i < count; ++i)
+				{
+					_threads.emplace_back([this, i]() { Run(i); });
+				}
+			}
+
+			~BenchmarkProducers()
+			{
+				_stopping = true;
+				_generation.fetch_add(1, std::memory_order_release);
+				for (auto& thread : _threads)
+				{
+					thread.join();
+				}
+			}
+
+			// Runs work(producer) on every thread and waits for them all.
+			void RunAll(std::function<void(int)> work)
+			{
+				_work = std::move(work);
+				_finished.store(0, std::memory_order_relaxed);
+				_generation.fetch_add(1, std::memory_order_release);
+				while (_finished.load(std::memory_order_acquire) < (int)_threads.size())
+				{
+					std::this_thread::yield();
+				}
+			}
+
+		private:
+			void Run(int producer)
+			{
+				uint64_t seen = 0;
+				while (true)
+				{
+					while (_generation.load(std::memory_order_acquire) == seen)
+					{
+						std::this_thread::yield();
+					}
+					seen++;
+
+					if (_stopping)
+					{
+						return;
+					}
+
+					_work(producer);
+					_finished.fetch_add(1, std::memory_order_release);
+				}
+			}
+
+		private:
+			std::vector<std::thread> _threads;
+			std::function<void(int)> _work;
+			std::atomic<uint64_t> _generation{ 0 };
+			std::atomic<int> _finished{ 0 };
+			bool _stopping{ false };
+		};
+
+		TEST_CASE("Publishing queued events from several threads", "[.][benchmark][Events][EventBus]")
+		{
+			constexpr int EventCount = 100000;
+
+			for (const auto producerCount : { 1, 2, 4, 8, 16 })
+			{
+				const auto eventsPerProducer = EventCount / producerCount;
+				const auto suffix = ", " + std::to_string(producerCount) + " producers";
+				BenchmarkProducers producers(producerCount);
+
+				BenchmarkLockedEventQueue locked;
+				BenchmarkLegacyCollisionListener lockedListener;
+
+				EventBus bus;
+				bus.SetImmediateMode(false);
+				BenchmarkLegacyCollisionListener legacyListener;
+				BenchmarkCollisionListener typedListener;
+				bus.AddListener(&legacyListener);
+				bus.Subscribe<&BenchmarkCollisionListener::OnCollision>(&typedListener);
+
+				BENCHMARK("Mutex + queue of clones" + suffix)
+				{
+					producers.RunAll([&](int)
+						{
+							for (int i = 0; i < eventsPerProducer; ++i)
+							{
+								locked.Publish(BenchmarkLegacyCollisionEvent(i, i + 1));
+							}
+						});
+					locked.Process(lockedListener);
+					return lockedListener.sum;
+				};
+
+				BENCHMARK("Staging buffers, broadcast event" + suffix)
+				{
+					producers.RunAll([&](int)
+						{
+							for (int i = 0; i < eventsPerProducer; ++i)
+							{
+								bus.PublishEvent(BenchmarkLegacyCollisionEvent(i, i + 1));
+							}
+						});
+					bus.ProcessEvents();
+					return legacyListener.sum;
+				};
+
+				BENCHMARK("Staging buffers, typed event" + suffix)
+				{
+					producers.RunAll([&](int)
+						{
+							for (int i = 0; i < eventsPerProducer; ++i)
+							{
+								bus.Publish(BenchmarkCollisionEvent{ i, i + 1 });
+							}
+						});
+					bus.ProcessEvents();
+					return typedListener.sum;
+				};
+			}
+		}
+	}
+}
@@ -0,0 +1,332 @@
+#include <catch2/catch_test_macros.hpp>
+#include <helsinki/System/Events/EventBus.hpp>
+#include <vector>
+
+namespace hl
+{
+	namespace test
+	{
+		struct TestHitEvent
+		{
+			int a;
+			int b;
+		};
+
+		struct TestScoreEvent
+		{
+			int amount;
+		};
+
+		struct TestLegacyEvent : public Event
+		{
+			DEFINE_EVENT_TYPE(TestLegacyEvent)
+		};
+
+		class TestHitListener
+		{
+		public:
+			explicit TestHitListener(EventBus& bus) : _bus(bus)
+			{
+				_bus.Subscribe<&TestHitListener::OnHit>(this);
+			}
+			~TestHitListener()
+			{
+				_bus.Unsubscribe<&TestHitListener::OnHit>(this);
+			}
+
+			void OnHit(const TestHitEvent& event)
+			{
+				hits.push_back(event.a * 100 + event.b);
+				if (scoreOnHit)
+				{
+					_bus.Publish(TestScoreEvent{ event.a });
+				}
+				if (unsubscribeOnHit)
+				{
+					_bus.Unsubscribe<&TestHitListener::OnHit>(this);
+				}
+			}
+
+			std::vector<int> hits;
+			bool scoreOnHit{ false };
+			bool unsubscribeOnHit{ false };
+
+		private:
+			EventBus& _bus;
+		};
+
+		class TestScoreListener
+		{
+		public:
+			void OnScore(const TestScoreEvent& event) { total += event.amount; }
+
+			int total{ 0 };
+		};
+
+		class TestLegacyListener : public EventListener
+		{
+		public:
+			void OnEvent(const Event&) override { count++; }
+
+			int count{ 0 };
+		};
+
+		TEST_CASE("Typed events only reach subscribers of their type", "[Events][EventBus]")
+		{
+			EventBus bus;
+			TestHitListener hits(bus);
+			TestScoreListener score;
+			TestLegacyListener legacy;
+			bus.Subscribe<&TestScoreListener::OnScore>(&score);
+			bus.AddListener(&legacy);
+
+			bus.Publish(TestHitEvent{ 1, 2 });
+			bus.Publish(TestScoreEvent{ 5 });
+			bus.Publish(TestScoreEvent{ 6 });
+
+			CHECK(hits.hits == std::vector<int>{ 102 });
+			CHECK(score.total == 11);
+			CHECK(legacy.count == 0);
+
+			bus.PublishEvent(TestLegacyEvent());
+			CHECK(legacy.count == 1);
+			CHECK(hits.hits.size() == 1);
+		}
+
+		TEST_CASE("Unsubscribed handlers stop receiving events", "[Events][EventBus]")
+		{
+			EventBus bus;
+			TestScoreListener first;
+			TestScoreListener second;
+			bus.Subscribe<&TestScoreListener::OnScore>(&first);
+			bus.Subscribe<&TestScoreListener::OnScore>(&second);
+			CHECK(bus.GetChannel<TestScoreEvent>().GetSubscriberCount() == 2);
+
+			bus.Publish(TestScoreEvent{ 1 });
+			bus.Unsubscribe<&TestScoreListener::OnScore>(&first);
+			bus.Publish(TestScoreEvent{ 2 });
+
+			CHECK(first.total == 1);
+			CHECK(second.total == 3);
+			CHECK(bus.GetChannel<TestScoreEvent>().GetSubscriberCount() == 1);
+		}
+
+		TEST_CASE("Handlers can unsubscribe while being dispatched to", "[Events][EventBus]")
+		{
+			EventBus bus;
+			TestHitListener first(bus);
+			TestHitListener second(bus);
+			first.unsubscribeOnHit = true;
+
+			bus.Publish(TestHitEvent{ 0, 1 });
+			bus.Publish(TestHitEvent{ 0, 2 });
+
+			CHECK(first.hits == std::vector<int>{ 1 });
+			CHECK(second.hits == std::vector<int>{ 1, 2 });
+		}
+
+		TEST_CASE("Queued typed events are dispatched by ProcessEvents in publish order", "[Events][EventBus]")
+		{
+			EventBus bus;
+			bus.SetImmediateMode(false);
+
+			TestHitListener hits(bus);
+			TestScoreListener score;
+			bus.Subscribe<&TestScoreListener::OnScore>(&score);
+			hits.scoreOnHit = true;
+
+			bus.Publish(TestHitEvent{ 1, 0 });
+			bus.Publish(TestHitEvent{ 2, 0 });
+			bus.Publish(TestHitEvent{ 3, 0 });
+			CHECK(hits.hits.empty());
+
+			bus.ProcessEvents();
+			CHECK(hits.hits == std::vector<int>{ 100, 200, 300 });
+			// Score events published while dispatching wait for the next call.
+			CHECK(score.total == 0);
+
+			bus.ProcessEvents();
+			CHECK(hits.hits.size() == 3);
+			CHECK(score.total == 6);
+		}
+
+		TEST_CASE("Events published while dispatching a queue wait for the next ProcessEvents", "[Events][EventBus]")
+		{
+			struct Republisher
+			{
+				EventBus* bus;
+				int received{ 0 };
+
+				void OnScore(const TestScoreEvent& event)
+				{
+					received++;
+					if (event.amount > 0)
+					{
+						bus->Publish(TestScoreEvent{ event.amount - 1 });
+					}
+				}
+			};
+
+			EventBus bus;
+			bus.SetImmediateMode(false);
+
+			Republisher republisher{ &bus };
+			bus.Subscribe<&Republisher::OnScore>(&republisher);
+
+			bus.Publish(TestScoreEvent{ 2 });
+			bus.ProcessEvents();
+			CHECK(republisher.received == 1);
+			bus.ProcessEvents();
+			CHECK(republisher.received == 2);
+			bus.ProcessEvents();
+			CHECK(republisher.received == 3);
+			bus.ProcessEvents();
+			CHECK(republisher.received == 3);
+		}
+
+		TEST_CASE("Queued typed and broadcast events keep their publish order", "[Events][EventBus]")
+		{
+			struct Recorder : public EventListener
+			{
+				std::vector<int> received;
+
+				void OnEvent(const Event&) override { received.push_back(-1); }
+				void OnScore(const TestScoreEvent& event) { received.push_back(event.amount); }
+			};
+
+			EventBus bus;
+			bus.SetImmediateMode(false);
+
+			Recorder recorder;
+			bus.AddListener(&recorder);
+			bus.Subscribe<&Recorder::OnScore>(&recorder);
+
+			bus.Publish(TestScoreEvent{ 1 });
+			bus.PublishEvent(TestLegacyEvent());
+			bus.Publish(TestScoreEvent{ 2 });
+			bus.PublishEvent(TestLegacyEvent());
+			bus.ProcessEvents();
+
+			CHECK(recorder.received == std::vector<int>{ 1, -1, 2, -1 });
+		}
+
+		TEST_CASE("Typed events without subscribers are dropped", "[Events][EventBus]")
+		{
+			EventBus bus;
+			bus.SetImmediateMode(false);
+
+			bus.Publish(TestScoreEvent{ 1 });
+
+			TestScoreListener score;
+			bus.Subscribe<&TestScoreListener::OnScore>(&score);
+			bus.ProcessEvents();
+
+			CHECK(score.total == 0);
+		}
+
+		TEST_CASE("Free function handlers receive their instance", "[Events][EventBus]")
+		{
+			EventBus bus;
+			int total = 0;
+
+			const auto handler = [](void* instance, const TestScoreEvent& event) { *static_cast<int*>(instance) += event.amount; };
+			bus.Subscribe<TestScoreEvent>(&total, handler);
+			bus.Publish(TestScoreEvent{ 4 });
+			bus.Unsubscribe<TestScoreEvent>(&total, handler);
+			bus.Publish(TestScoreEvent{ 4 });
+
+			CHECK(total == 4);
+		}
+
+		TEST_CASE("Scoped subscriptions unsubscribe when they go", "[Events][EventBus]")
+		{
+			EventBus bus;
+			TestScoreListener score;
+			TestLegacyListener legacy;
+
+			{
+				const auto subscription = bus.SubscribeScoped<&TestScoreListener::OnScore>(&score);
+				const auto listener = bus.AddScopedListener(&legacy);
+				CHECK(subscription.IsActive());
+
+				bus.Publish(TestScoreEvent{ 3 });
+				bus.PublishEvent(TestLegacyEvent());
+			}
+
+			bus.Publish(TestScoreEvent{ 3 });
+			bus.PublishEvent(TestLegacyEvent());
+
+			CHECK(score.total == 3);
+			CHECK(legacy.count == 1);
+			CHECK(bus.GetChannel<TestScoreEvent>().GetSubscriberCount() == 0);
+		}
+
+		TEST_CASE("Scoped subscriptions can be moved and reset", "[Events][EventBus]")
+		{
+			EventBus bus;
+			TestScoreListener score;
+
+			EventSubscription moved;
+			CHECK_FALSE(moved.IsActive());
+			{
+				auto subscription = bus.SubscribeScoped<&TestScoreListener::OnScore>(&score);
+				moved = std::move(subscription);
+				CHECK_FALSE(subscription.IsActive());
+			}
+
+			bus.Publish(TestScoreEvent{ 1 });
+			CHECK(score.total == 1);
+
+			moved.Reset();
+			CHECK_FALSE(moved.IsActive());
+			bus.Publish(TestScoreEvent{ 1 });
+			CHECK(score.total == 1);
+
+			// Assigning over a live subscription ends it.
+			moved = bus.SubscribeScoped<&TestScoreListener::OnScore>(&score);
+			moved = EventSubscription();
+			CHECK(bus.GetChannel<TestScoreEvent>().GetSubscriberCount() == 0);
+		}
+
+		TEST_CASE("Listeners can be removed while events are broadcast", "[Events][EventBus]")
+		{
+			class RemovingListener : public EventListener
+			{
+			public:
+				explicit RemovingListener(EventBus& bus) : _bus(bus) {}
+
+				void OnEvent(const Event&) override
+				{
+					count++;
+					_bus.RemoveListener(this);
+				}
+
+				int count{ 0 };
+
+			private:
+				EventBus& _bus;
+			};
+
+			EventBus bus;
+			RemovingListener removing(bus);
+			TestLegacyListener legacy;
+			bus.AddListener(&removing, 1);
+			bus.AddListener(&legacy);
+
+			bus.PublishEvent(TestLegacyEvent());
+			bus.PublishEvent(TestLegacyEvent());
+
+			CHECK(removing.count == 1);
+			CHECK(legacy.count == 2);
+		}
+
+		TEST_CASE("Event types get distinct dense indices", "[Events][EventBus]")
+		{
+			const auto hit = EventTypeIndex::Get<TestHitEvent>();
+			const auto score = EventTypeIndex::Get<TestScoreEvent>();
+
+			CHECK(hit != score);
+			CHECK(EventTypeIndex::Get<TestHitEvent>() == hit);
+		}
+	}
+}
@@ -0,0 +1,251 @@
+#include <catch2/catch_test_macros.hpp>
+#include <helsinki/System/Events/EventBus.hpp>
+#include <helsinki/System/Events/WindowResizeEvent.hpp>
+#include <vector>
+
+namespace hl
+{
+	namespace test
+	{
+		struct TestPairEvent
+		{
+			int a;
+			int b;
+		};
+
+		struct TestDamageEvent
+		{
+			int target;
+			int amount;
+
+			TestDamageEvent& operator+=(const TestDamageEvent& other)
+			{
+				amount += other.amount;
+				return *this;
+			}
+		};
+
+		struct TestPositionEvent
+		{
+			int id;
+			int position;
+		};
+	}
+
+	template<>
+	struct EventCoalescing<test::TestPairEvent>
+	{
+		static constexpr EventMergePolicy Policy = EventMergePolicy::UniqueSet;
+		static uint64_t Key(const test::TestPairEvent& event) { return (uint64_t)event.a << 32 | (uint32_t)event.b; }
+	};
+
+	template<>
+	struct EventCoalescing<test::TestDamageEvent>
+	{
+		static constexpr EventMergePolicy Policy = EventMergePolicy::Sum;
+		static uint64_t Key(const test::TestDamageEvent& event) { return (uint64_t)event.target; }
+	};
+
+	template<>
+	struct EventCoalescing<test::TestPositionEvent>
+	{
+		static constexpr EventMergePolicy Policy = EventMergePolicy::LastWins;
+		static uint64_t Key(const test::TestPositionEvent& event) { return (uint64_t)event.id; }
+	};
+
+	namespace test
+	{
+		struct TestCoalescedRecorder
+		{
+			std::vector<int> pairs;
+			std::vector<std::pair<int, int>> damage;
+			std::vector<std::pair<int, int>> positions;
+
+			void OnPair(const TestPairEvent& event) { pairs.push_back(event.a * 10 + event.b); }
+			void OnDamage(const TestDamageEvent& event) { damage.emplace_back(event.target, event.amount); }
+			void OnPosition(const TestPositionEvent& event) { positions.emplace_back(event.id, event.position); }
+		};
+
+		class TestResizeListener : public EventListener
+		{
+		public:
+			void OnEvent(const Event& event) override
+			{
+				if (auto resize = dynamic_cast<const WindowResizeEvent*>(&event))
+				{
+					sizes.emplace_back(resize->GetWidth(), resize->GetHeight());
+				}
+			}
+
+			std::vector<std::pair<int, int>> sizes;
+		};
+
+		TEST_CASE("Coalesced events are held until ProcessEvents in immediate mode", "[Events][EventCoalescer]")
+		{
+			EventBus bus;
+			TestCoalescedRecorder recorder;
+			bus.Subscribe<&TestCoalescedRecorder::OnPair>(&recorder);
+			bus.Coalesce<TestPairEvent>();
+
+			bus.Publish(TestPairEvent{ 1, 2 });
+			CHECK(recorder.pairs.empty());
+			CHECK(bus.GetCoalescer<TestPairEvent>()->GetPendingCount() == 1);
+
+			bus.ProcessEvents();
+			CHECK(recorder.pairs == std::vector<int>{ 12 });
+			CHECK(bus.GetCoalescer<TestPairEvent>()->GetPendingCount() == 0);
+		}
+
+		TEST_CASE("Unique set coalescing keeps the first event per key", "[Events][EventCoalescer]")
+		{
+			EventBus bus;
+			TestCoalescedRecorder recorder;
+			bus.Subscribe<&TestCoalescedRecorder::OnPair>(&recorder);
+			bus.Coalesce<TestPairEvent>();
+
+			bus.Publish(TestPairEvent{ 1, 2 });
+			bus.Publish(TestPairEvent{ 3, 4 });
+			bus.Publish(TestPairEvent{ 1, 2 });
+			bus.Publish(TestPairEvent{ 1, 3 });
+			bus.Publish(TestPairEvent{ 3, 4 });
+			bus.ProcessEvents();
+
+			CHECK(recorder.pairs == std::vector<int>{ 12, 34, 13 });
+
+			// Keys only last until the flush.
+			bus.Publish(TestPairEvent{ 1, 2 });
+			bus.ProcessEvents();
+			CHECK(recorder.pairs == std::vector<int>{ 12, 34, 13, 12 });
+		}
+
+		TEST_CASE("Sum coalescing adds events with the same key together", "[Events][EventCoalescer]")
+		{
+			EventBus bus;
+			TestCoalescedRecorder recorder;
+			bus.Subscribe<&TestCoalescedRecorder::OnDamage>(&recorder);
+			bus.Coalesce<TestDamageEvent>();
+
+			bus.Publish(TestDamageEvent{ 7, 3 });
+			bus.Publish(TestDamageEvent{ 9, 1 });
+			bus.Publish(TestDamageEvent{ 7, 5 });
+			bus.ProcessEvents();
+
+			CHECK(recorder.damage == std::vector<std::pair<int, int>>{ { 7, 8 }, { 9, 1 } });
+		}
+
+		TEST_CASE("Coalescing keeps keys apart as the key table grows and across flushes", "[Events][EventCoalescer]")
+		{
+			EventBus bus;
+			TestCoalescedRecorder recorder;
+			bus.Subscribe<&TestCoalescedRecorder::OnDamage>(&recorder);
+			bus.Coalesce<TestDamageEvent>();
+
+			for (int flush = 0; flush < 3; ++flush)
+			{
+				// Key zero included, and far more keys than the table starts with.
+				for (int repeat = 0; repeat < 2; ++repeat)
+				{
+					for (int target = 0; target < 100; ++target)
+					{
+						bus.Publish(TestDamageEvent{ target, target + 1 });
+					}
+				}
+				CHECK(bus.GetCoalescer<TestDamageEvent>()->GetPendingCount() == 100);
+				bus.ProcessEvents();
+
+				REQUIRE(recorder.damage.size() == 100);
+				for (int target = 0; target < 100; ++target)
+				{
+					CHECK(recorder.damage[target] == std::pair<int, int>{ target, (target + 1) * 2 });
+				}
+				recorder.damage.clear();
+			}
+		}
+
+		TEST_CASE("Last wins coalescing keeps the most recent event per key", "[Events][EventCoalescer]")
+		{
+			EventBus bus;
+			TestCoalescedRecorder recorder;
+			bus.Subscribe<&TestCoalescedRecorder::OnPosition>(&recorder);
+			bus.Coalesce<TestPositionEvent>();
+
+			bus.Publish(TestPositionEvent{ 1, 10 });
+			bus.Publish(TestPositionEvent{ 2, 20 });
+			bus.Publish(TestPositionEvent{ 1, 11 });
+			bus.Publish(TestPositionEvent{ 1, 12 });
+			bus.ProcessEvents();
+
+			CHECK(recorder.positions == std::vector<std::pair<int, int>>{ { 1, 12 }, { 2, 20 } });
+		}
+
+		TEST_CASE("Coalesced events published from the queue are merged before dispatch", "[Events][EventCoalescer]")
+		{
+			EventBus bus;
+			bus.SetImmediateMode(false);
+			TestCoalescedRecorder recorder;
+			bus.Subscribe<&TestCoalescedRecorder::OnPair>(&recorder);
+			bus.Subscribe<&TestCoalescedRecorder::OnPosition>(&recorder);
+			bus.Coalesce<TestPairEvent>();
+
+			bus.Publish(TestPairEvent{ 1, 2 });
+			bus.Publish(TestPositionEvent{ 1, 1 });
+			bus.Publish(TestPairEvent{ 1, 2 });
+			bus.Publish(TestPositionEvent{ 1, 2 });
+			bus.ProcessEvents();
+
+			CHECK(recorder.pairs == std::vector<int>{ 12 });
+			// Not coalesced, so every event still arrives.
+			CHECK(recorder.positions == std::vector<std::pair<int, int>>{ { 1, 1 }, { 1, 2 } });
+		}
+
+		TEST_CASE("Coalesced events published while flushing wait for the next ProcessEvents", "[Events][EventCoalescer]")
+		{
+			struct Republisher
+			{
+				EventBus* bus;
+				int received{ 0 };
+
+				void OnPair(const TestPairEvent& event)
+				{
+					received++;
+					bus->Publish(event);
+				}
+			};
+
+			EventBus bus;
+			Republisher republisher{ &bus };
+			bus.Subscribe<&Republisher::OnPair>(&republisher);
+			bus.Coalesce<TestPairEvent>();
+
+			bus.Publish(TestPairEvent{ 1, 2 });
+			bus.ProcessEvents();
+			CHECK(republisher.received == 1);
+			bus.ProcessEvents();
+			CHECK(republisher.received == 2);
+		}
+
+		TEST_CASE("Window resizes are coalesced to the last size", "[Events][EventCoalescer]")
+		{
+			EventBus bus;
+			TestResizeListener listener;
+			bus.AddListener(&listener);
+
+			bus.PublishEvent(WindowResizeEvent(100, 100));
+			CHECK(listener.sizes.size() == 1);
+
+			bus.Coalesce<WindowResizeEvent>();
+			bus.PublishEvent(WindowResizeEvent(200, 100));
+			bus.PublishEvent(WindowResizeEvent(300, 150));
+			bus.PublishEvent(WindowResizeEvent(400, 200));
+			CHECK(listener.sizes.size() == 1);
+
+			bus.ProcessEvents();
+			CHECK(listener.sizes == std::vector<std::pair<int, int>>{ { 100, 100 }, { 400, 200 } });
+
+			// Sent as a plain Event the type is unknown, so it goes straight out.
+			const Event& event = WindowResizeEvent(500, 250);
+			bus.PublishEvent(event);
+			CHECK(listener.sizes.size() == 3);
+		}
+	}
+}
@@ -0,0 +1,243 @@
+#include <catch2/catch_test_macros.hpp>
+#include <helsinki/System/Events/EventBus.hpp>
+#include <string>
+#include <vector>
+
+namespace hl
+{
+	namespace test
+	{
+		struct TestMovedEvent
+		{
+			int id;
+		};
+
+		struct TestDestroyedEvent
+		{
+			int id;
+		};
+
+		struct TestPhaseLegacyEvent : public Event
+		{
+			explicit TestPhaseLegacyEvent(int value) : value(value) {}
+
+			int value;
+
+			DEFINE_EVENT_TYPE(TestPhaseLegacyEvent)
+		};
+
+		struct TestPhaseRecorder : public EventListener
+		{
+			EventBus* bus{ nullptr };
+			std::vector<std::string> received;
+
+			void OnEvent(const Event& event) override
+			{
+				if (auto legacy = dynamic_cast<const TestPhaseLegacyEvent*>(&event))
+				{
+					received.push_back("legacy " + std::to_string(legacy->value));
+				}
+			}
+
+			void OnMoved(const TestMovedEvent& event)
+			{
+				received.push_back("moved " + std::to_string(event.id));
+				if (bus != nullptr)
+				{
+					bus->Publish(TestDestroyedEvent{ event.id });
+				}
+			}
+
+			void OnDestroyed(const TestDestroyedEvent& event)
+			{
+				received.push_back("destroyed " + std::to_string(event.id));
+			}
+
+			void OnMovedFirst(const TestMovedEvent& event)
+			{
+				received.push_back("first " + std::to_string(event.id));
+			}
+		};
+
+		TEST_CASE("Events with a phase wait for it in immediate mode", "[Events][EventPhase]")
+		{
+			EventBus bus;
+			TestPhaseRecorder recorder;
+			bus.Subscribe<&TestPhaseRecorder::OnMoved>(&recorder);
+			bus.Subscribe<&TestPhaseRecorder::OnDestroyed>(&recorder);
+			bus.SetPhase<TestMovedEvent>(EventPhase::PostPhysics);
+
+			CHECK(bus.GetPhase<TestMovedEvent>() == EventPhase::PostPhysics);
+			CHECK_FALSE(bus.GetPhase<TestDestroyedEvent>().has_value());
+
+			bus.Publish(TestMovedEvent{ 1 });
+			bus.Publish(TestDestroyedEvent{ 2 });
+			CHECK(recorder.received == std::vector<std::string>{ "destroyed 2" });
+
+			bus.ProcessEvents(EventPhase::PreUpdate);
+			CHECK(recorder.received.size() == 1);
+
+			bus.ProcessEvents(EventPhase::PostPhysics);
+			CHECK(recorder.received == std::vector<std::string>{ "destroyed 2", "moved 1" });
+		}
+
+		TEST_CASE("Events published for a later phase are dispatched in the same sweep", "[Events][EventPhase]")
+		{
+			EventBus bus;
+			TestPhaseRecorder recorder;
+			recorder.bus = &bus;
+			bus.Subscribe<&TestPhaseRecorder::OnMoved>(&recorder);
+			bus.Subscribe<&TestPhaseRecorder::OnDestroyed>(&recorder);
+			bus.SetPhase<TestMovedEvent>(EventPhase::PostPhysics);
+			bus.SetPhase<TestDestroyedEvent>(EventPhase::EndOfFrame);
+
+			bus.Publish(TestMovedEvent{ 1 });
+			bus.Publish(TestMovedEvent{ 2 });
+			bus.ProcessEvents();
+
+			CHECK(recorder.received == std::vector<std::string>{ "moved 1", "moved 2", "destroyed 1", "destroyed 2" });
+		}
+
+		TEST_CASE("Events published for the phase being processed wait for the next one", "[Events][EventPhase]")
+		{
+			EventBus bus;
+			TestPhaseRecorder recorder;
+			recorder.bus = &bus;
+			bus.Subscribe<&TestPhaseRecorder::OnMoved>(&recorder);
+			bus.Subscribe<&TestPhaseRecorder::OnDestroyed>(&recorder);
+			bus.SetPhase<TestMovedEvent>(EventPhase::EndOfFrame);
+			bus.SetPhase<TestDestroyedEvent>(EventPhase::PreUpdate);
+
+			bus.Publish(TestMovedEvent{ 1 });
+			bus.ProcessEvents();
+			CHECK(recorder.received == std::vector<std::string>{ "moved 1" });
+
+			bus.ProcessEvents(EventPhase::PreUpdate);
+			CHECK(recorder.received == std::vector<std::string>{ "moved 1", "destroyed 1" });
+		}
+
+		TEST_CASE("Broadcast events can be given a phase", "[Events][EventPhase]")
+		{
+			EventBus bus;
+			TestPhaseRecorder recorder;
+			bus.AddListener(&recorder);
+			bus.SetPhase<TestPhaseLegacyEvent>(EventPhase::PreUpdate);
+
+			bus.PublishEvent(TestPhaseLegacyEvent(1));
+			CHECK(recorder.received.empty());
+
+			bus.ProcessEvents(EventPhase::PreUpdate);
+			CHECK(recorder.received == std::vector<std::string>{ "legacy 1" });
+		}
+
+		TEST_CASE("Queued events without a phase belong to the end of the frame", "[Events][EventPhase]")
+		{
+			EventBus bus;
+			bus.SetImmediateMode(false);
+			TestPhaseRecorder recorder;
+			bus.Subscribe<&TestPhaseRecorder::OnDestroyed>(&recorder);
+
+			bus.Publish(TestDestroyedEvent{ 1 });
+			bus.ProcessEvents(EventPhase::PreUpdate);
+			bus.ProcessEvents(EventPhase::PostPhysics);
+			CHECK(recorder.received.empty());
+
+			bus.ProcessEvents(EventPhase::EndOfFrame);
+			CHECK(recorder.received == std::vector<std::string>{ "destroyed 1" });
+		}
+
+		TEST_CASE("Phase timings count the events dispatched", "[Events][EventPhase]")
+		{
+			EventBus bus;
+			TestPhaseRecorder recorder;
+			bus.Subscribe<&TestPhaseRecorder::OnMoved>(&recorder);
+			bus.SetPhase<TestMovedEvent>(EventPhase::PostPhysics);
+
+			for (int i = 0; i < 5; ++i)
+			{
+				bus.Publish(TestMovedEvent{ i });
+			}
+			bus.ProcessEvents();
+
+			CHECK(bus.GetPhaseTiming(EventPhase::PreUpdate).eventCount == 0);
+			CHECK(bus.GetPhaseTiming(EventPhase::PostPhysics).eventCount == 5);
+			CHECK(bus.GetPhaseTiming(EventPhase::PostPhysics).milliseconds >= 0.0);
+			CHECK(bus.GetPhaseTiming(EventPhase::EndOfFrame).eventCount == 0);
+		}
+
+		TEST_CASE("Higher priority subscribers are called first", "[Events][EventPhase]")
+		{
+			EventBus bus;
+			TestPhaseRecorder recorder;
+			bus.Subscribe<&TestPhaseRecorder::OnMoved>(&recorder);
+			bus.Subscribe<&TestPhaseRecorder::OnMovedFirst>(&recorder, 10);
+
+			bus.Publish(TestMovedEvent{ 1 });
+
+			CHECK(recorder.received == std::vector<std::string>{ "first 1", "moved 1" });
+		}
+
+		TEST_CASE("Subscribers added while dispatching are sorted afterwards", "[Events][EventPhase]")
+		{
+			struct LateSubscriber
+			{
+				EventBus* bus;
+				TestPhaseRecorder* recorder;
+				bool subscribed{ false };
+
+				void OnMoved(const TestMovedEvent&)
+				{
+					if (!subscribed)
+					{
+						subscribed = true;
+						bus->Subscribe<&TestPhaseRecorder::OnMovedFirst>(recorder, 10);
+					}
+				}
+			};
+
+			EventBus bus;
+			TestPhaseRecorder recorder;
+			LateSubscriber late{ &bus, &recorder };
+			bus.Subscribe<&LateSubscriber::OnMoved>(&late);
+			bus.Subscribe<&TestPhaseRecorder::OnMoved>(&recorder);
+
+			bus.Publish(TestMovedEvent{ 1 });
+			// Added at the back for the event being dispatched.
+			CHECK(recorder.received == std::vector<std::string>{ "moved 1", "first 1" });
+
+			recorder.received.clear();
+			bus.Publish(TestMovedEvent{ 2 });
+			CHECK(recorder.received == std::vector<std::string>{ "first 2", "moved 2" });
+		}
+
+		TEST_CASE("Higher priority listeners receive broadcast events first", "[Events][EventPhase]")
+		{
+			struct OrderListener : public EventListener
+			{
+				std::vector<int>* order;
+				int id;
+
+				OrderListener(std::vector<int>* order, int id) : order(order), id(id) {}
+				void OnEvent(const Event&) override { order->push_back(id); }
+			};
+
+			std::vector<int> order;
+			OrderListener low(&order, 1);
+			OrderListener high(&order, 2);
+			OrderListener same(&order, 3);
+
+			EventBus bus;
+			bus.AddListener(&low);
+			bus.AddListener(&high, 5);
+			bus.AddListener(&same);
+
+			bus.PublishEvent(TestPhaseLegacyEvent(0));
+			CHECK(order == std::vector<int>{ 2, 1, 3 });
+
+			bus.RemoveListener(&high);
+			order.clear();
+			bus.PublishEvent(TestPhaseLegacyEvent(0));
+			CHECK(order == std::vector<int>{ 1, 3 });
+		}
+	}
+}
@@ -0,0 +1,242 @@
+#include <catch2/catch_test_macros.hpp>
+#include <helsinki/System/Events/EventQueue.hpp>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace hl
+{
+	namespace test
+	{
+		struct TestQueuedEvent
+		{
+			int producer;
+			int sequence;
+		};
+
+		struct TestQueueContext
+		{
+			std::vector<TestQueuedEvent> received;
+		};
+
+		static void recordQueuedEvent(void* context, void*, std::byte* memory)
+		{
+			auto event = reinterpret_cast<TestQueuedEvent*>(memory);
+			if (context != nullptr)
+			{
+				static_cast<TestQueueContext*>(context)->received.push_back(*event);
+			}
+			event->~TestQueuedEvent();
+		}
+
+		TEST_CASE("Events are drained in the order they were pushed", "[Events][EventQueue]")
+		{
+			EventQueue queue;
+			TestQueueContext context;
+
+			constexpr int EventCount = 10000;
+			for (int i = 0; i < EventCount; ++i)
+			{
+				queue.Push(&recordQueuedEvent, nullptr, TestQueuedEvent{ 0, i });
+			}
+			queue.Drain(&context);
+
+			REQUIRE(context.received.size() == EventCount);
+			for (int i = 0; i < EventCount; ++i)
+			{
+				CHECK(context.received[i].sequence == i);
+			}
+			CHECK(queue.GetProducerCount() == 1);
+
+			context.received.clear();
+			queue.Drain(&context);
+			CHECK(context.received.empty());
+		}
+
+		TEST_CASE("Events from each producer thread keep their order", "[Events][EventQueue]")
+		{
+			constexpr int ProducerCount = 4;
+			constexpr int EventsPerProducer = 20000;
+
+			EventQueue queue;
+			TestQueueContext context;
+
+			std::vector<std::thread> producers;
+			for (int p = 0; p < ProducerCount; ++p)
+			{
+				producers.emplace_back([&queue, p]()
+					{
+						for (int i = 0; i < EventsPerProducer; ++i)
+						{
+							queue.Push(&recordQueuedEvent, nullptr, TestQueuedEvent{ p, i });
+						}
+					});
+			}
+
+			// Drained while the producers are still going, nothing should be
+			// lost or reordered between drains.
+			while (context.received.size() < ProducerCount * EventsPerProducer)
+			{
+				queue.Drain(&context);
+				if (context.received.size() < ProducerCount * EventsPerProducer)
+				{
+					std::this_thread::yield();
+				}
+			}
+
+			for (auto& producer : producers)
+			{
+				producer.join();
+			}
+			queue.Drain(&context);
+
+			REQUIRE(context.received.size() == ProducerCount * EventsPerProducer);
+			CHECK(queue.GetProducerCount() == ProducerCount);
+
+			std::array<int, ProducerCount> expected{};
+			for (const auto& event : context.received)
+			{
+				REQUIRE(event.producer >= 0);
+				REQUIRE(event.producer < ProducerCount);
+				CHECK(event.sequence == expected[event.producer]);
+				expected[event.producer] = event.sequence + 1;
+			}
+		}
+
+		TEST_CASE("Events larger than a block can be queued", "[Events][EventQueue]")
+		{
+			struct LargeEvent
+			{
+				std::array<int, EventQueue::BlockSize> values;
+			};
+
+			EventQueue queue;
+			std::vector<int> received;
+
+			const auto process = [](void* context, void*, std::byte* memory)
+				{
+					auto event = reinterpret_cast<LargeEvent*>(memory);
+					if (context != nullptr)
+					{
+						static_cast<std::vector<int>*>(context)->push_back(event->values.front() + event->values.back());
+					}
+				};
+
+			const auto smallProcess = [](void* context, void*, std::byte* memory)
+				{
+					if (context != nullptr)
+					{
+						static_cast<std::vector<int>*>(context)->push_back(*reinterpret_cast<int*>(memory));
+					}
+				};
+
+			auto event = std::make_unique<LargeEvent>();
+			for (int i = 0; i < 3; ++i)
+			{
+				event->values.front() = i;
+				event->values.back() = i * 10;
+				queue.Push(process, nullptr, *event);
+				queue.Push(smallProcess, nullptr, -i);
+			}
+
+			queue.Drain(&received);
+
+			CHECK(received == std::vector<int>{ 0, 0, 11, -1, 22, -2 });
+		}
+
+		TEST_CASE("Events still queued are destroyed with the queue", "[Events][EventQueue]")
+		{
+			struct Counted
+			{
+				int* destroyed;
+			};
+
+			int destroyed = 0;
+			int processed = 0;
+
+			const auto process = [](void* context, void* target, std::byte* memory)
+				{
+					auto event = reinterpret_cast<Counted*>(memory);
+					if (context != nullptr)
+					{
+						(*static_cast<int*>(target))++;
+					}
+					(*event->destroyed)++;
+				};
+
+			{
+				EventQueue queue;
+				for (int i = 0; i < 5; ++i)
+				{
+					queue.Push(process, &processed, Counted{ &destroyed });
+				}
+				queue.Drain(&queue);
+				CHECK(processed == 5);
+				CHECK(destroyed == 5);
+
+				for (int i = 0; i < 3; ++i)
+				{
+					queue.Push(process, &processed, Counted{ &destroyed });
+				}
+			}
+
+			CHECK(processed == 5);
+			CHECK(destroyed == 8);
+		}
+
+		TEST_CASE("Threads forget the queues they published to once they are destroyed", "[Events][EventQueue]")
+		{
+			const auto before = EventQueue::GetThreadQueueCount();
+			for (int i = 0; i < 100; ++i)
+			{
+				EventQueue queue;
+				queue.Push(&recordQueuedEvent, nullptr, TestQueuedEvent{ 0, i });
+				CHECK(EventQueue::GetThreadQueueCount() == before + 1);
+			}
+			CHECK(EventQueue::GetThreadQueueCount() == before);
+
+			// Destroyed on another thread, so only dropped when the publishing
+			// thread next looks for a queue it has no buffer for.
+			auto first = std::make_unique<EventQueue>();
+			auto second = std::make_unique<EventQueue>();
+			std::atomic<int> stage{ 0 };
+			std::array<size_t, 2> counts{};
+			std::thread publisher([&]()
+				{
+					first->Push(&recordQueuedEvent, nullptr, TestQueuedEvent{ 1, 0 });
+					counts[0] = EventQueue::GetThreadQueueCount();
+					stage = 1;
+					while (stage != 2)
+					{
+						std::this_thread::yield();
+					}
+
+					second->Push(&recordQueuedEvent, nullptr, TestQueuedEvent{ 1, 1 });
+					counts[1] = EventQueue::GetThreadQueueCount();
+				});
+
+			while (stage != 1)
+			{
+				std::this_thread::yield();
+			}
+			first.reset();
+			stage = 2;
+			publisher.join();
+
+			CHECK(counts == std::array<size_t, 2>{ 1, 1 });
+		}
+
+		TEST_CASE("Over aligned events are rejected", "[Events][EventQueue]")
+		{
+			struct alignas(64) OverAligned
+			{
+				int value;
+			};
+
+			EventQueue queue;
+			CHECK_THROWS(queue.Push(&recordQueuedEvent, nullptr, OverAligned{ 1 }));
+		}
+	}
+}
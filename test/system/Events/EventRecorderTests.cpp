@@ -0,0 +1,248 @@
+#include <catch2/catch_test_macros.hpp>
+#include <helsinki/System/Events/EventBus.hpp>
+#include <helsinki/System/Events/EventRecorder.hpp>
+#include <helsinki/System/Events/EventReplayer.hpp>
+#include <helsinki/System/Events/KeyEvents.hpp>
+#include <helsinki/System/Events/WindowResizeEvent.hpp>
+#include <stdexcept>
+#include <vector>
+
+namespace hl
+{
+	namespace test
+	{
+		struct TestRecordedMoveEvent
+		{
+			int id;
+			float x;
+		};
+
+		struct TestRecordedOtherEvent
+		{
+			int value;
+		};
+
+		struct TestReplayReceiver
+		{
+			std::vector<std::pair<int, float>> moves;
+			std::vector<int> others;
+
+			void OnMove(const TestRecordedMoveEvent& event) { moves.emplace_back(event.id, event.x); }
+			void OnOther(const TestRecordedOtherEvent& event) { others.push_back(event.value); }
+		};
+
+		class TestKeyReplayListener : public EventListener
+		{
+		public:
+			void OnEvent(const Event& event) override
+			{
+				if (auto press = dynamic_cast<const KeyPressEvent*>(&event))
+				{
+					keys.push_back(press->GetKeyCode());
+				}
+				else if (auto release = dynamic_cast<const KeyReleaseEvent*>(&event))
+				{
+					keys.push_back(-release->GetKeyCode());
+				}
+			}
+
+			std::vector<int> keys;
+		};
+
+		// Two frames, the first with updates 0 and 1, the second with update 2.
+		static EventRecording RecordTestSession()
+		{
+			EventBus bus;
+			EventRecorder recorder;
+			bus.SetRecorder(&recorder);
+
+			recorder.BeginUpdate(0);
+			bus.Publish(TestRecordedMoveEvent{ 1, 1.5f });
+			bus.PublishEvent(KeyPressEvent(65));
+			recorder.BeginUpdate(1);
+			bus.Publish(TestRecordedOtherEvent{ 7 });
+			recorder.EndFrame();
+
+			recorder.BeginUpdate(2);
+			bus.Publish(TestRecordedMoveEvent{ 2, -3.0f });
+			bus.PublishEvent(KeyReleaseEvent(65));
+			recorder.EndFrame();
+
+			bus.SetRecorder(nullptr);
+			return recorder.GetRecording();
+		}
+
+		TEST_CASE("Published events are recorded with the update they were published in", "[Events][EventRecorder]")
+		{
+			const auto recording = RecordTestSession();
+
+			CHECK(recording.GetFrames() == std::vector<uint32_t>{ 2, 1 });
+			CHECK(recording.GetTypes().size() == 4);
+
+			const auto& records = recording.GetRecords();
+			REQUIRE(records.size() == 5);
+			CHECK(records[0].update == 0);
+			CHECK(records[1].update == 0);
+			CHECK(records[2].update == 1);
+			CHECK(records[3].update == 2);
+			CHECK(records[4].update == 2);
+			CHECK(records[0].type == records[3].type);
+			CHECK(records[0].size == sizeof(TestRecordedMoveEvent));
+		}
+
+		TEST_CASE("Events published without a recorder or as a plain Event are not recorded", "[Events][EventRecorder]")
+		{
+			EventBus bus;
+			EventRecorder recorder;
+
+			bus.Publish(TestRecordedOtherEvent{ 1 });
+			bus.SetRecorder(&recorder);
+
+			// The type is unknown, so there is nothing to record it with.
+			const Event& event = KeyPressEvent(1);
+			bus.PublishEvent(event);
+			CHECK(recorder.GetRecording().GetRecords().empty());
+
+			// Recorded even though nothing listens to it.
+			bus.Publish(TestRecordedOtherEvent{ 2 });
+			CHECK(recorder.GetRecording().GetRecords().size() == 1);
+		}
+
+		TEST_CASE("Event recordings are the same after saving and loading", "[Events][EventRecorder]")
+		{
+			const auto recording = RecordTestSession();
+			const auto loaded = EventRecording::Load(recording.Save());
+
+			CHECK(loaded.GetTypes() == recording.GetTypes());
+			CHECK(loaded.GetFrames() == recording.GetFrames());
+			REQUIRE(loaded.GetRecords().size() == recording.GetRecords().size());
+			for (size_t i = 0; i < loaded.GetRecords().size(); ++i)
+			{
+				const auto& expected = recording.GetRecords()[i];
+				const auto& actual = loaded.GetRecords()[i];
+				CHECK(actual.update == expected.update);
+				CHECK(actual.type == expected.type);
+
+				const auto expectedPayload = recording.GetPayload(expected);
+				const auto actualPayload = loaded.GetPayload(actual);
+				CHECK(std::vector<std::byte>(actualPayload.begin(), actualPayload.end()) ==
+					std::vector<std::byte>(expectedPayload.begin(), expectedPayload.end()));
+			}
+		}
+
+		TEST_CASE("Replaying publishes the registered events in the update they were recorded in", "[Events][EventRecorder]")
+		{
+			const auto recording = RecordTestSession();
+
+			EventBus bus;
+			TestReplayReceiver receiver;
+			TestKeyReplayListener listener;
+			bus.Subscribe<&TestReplayReceiver::OnMove>(&receiver);
+			bus.Subscribe<&TestReplayReceiver::OnOther>(&receiver);
+			bus.AddListener(&listener);
+
+			EventReplayer replayer(bus, recording);
+			replayer.Register<TestRecordedMoveEvent>();
+			replayer.Register<KeyPressEvent>();
+			replayer.Register<KeyReleaseEvent>();
+
+			replayer.ReplayUpdate(0);
+			CHECK(receiver.moves == std::vector<std::pair<int, float>>{ { 1, 1.5f } });
+			CHECK(listener.keys == std::vector<int>{ 65 });
+
+			replayer.ReplayUpdate(1);
+			// Not registered, so left to whatever published it originally.
+			CHECK(receiver.others.empty());
+			CHECK_FALSE(replayer.IsFinished());
+
+			replayer.ReplayUpdate(2);
+			CHECK(receiver.moves == std::vector<std::pair<int, float>>{ { 1, 1.5f }, { 2, -3.0f } });
+			CHECK(listener.keys == std::vector<int>{ 65, -65 });
+			CHECK(replayer.IsFinished());
+		}
+
+		TEST_CASE("Replaying skips updates that were passed over", "[Events][EventRecorder]")
+		{
+			const auto recording = RecordTestSession();
+
+			EventBus bus;
+			TestReplayReceiver receiver;
+			bus.Subscribe<&TestReplayReceiver::OnMove>(&receiver);
+
+			EventReplayer replayer(bus, recording);
+			replayer.Register<TestRecordedMoveEvent>();
+
+			replayer.ReplayUpdate(2);
+			CHECK(receiver.moves == std::vector<std::pair<int, float>>{ { 2, -3.0f } });
+		}
+
+		TEST_CASE("Replayed window resizes keep their size", "[Events][EventRecorder]")
+		{
+			EventBus bus;
+			EventRecorder recorder;
+			bus.SetRecorder(&recorder);
+			recorder.BeginUpdate(0);
+			bus.PublishEvent(WindowResizeEvent(640, 480));
+			bus.SetRecorder(nullptr);
+
+			const auto loaded = EventRecording::Load(recorder.GetRecording().Save());
+
+			struct ResizeListener : EventListener
+			{
+				int width{ 0 };
+				int height{ 0 };
+
+				void OnEvent(const Event& event) override
+				{
+					if (auto resize = dynamic_cast<const WindowResizeEvent*>(&event))
+					{
+						width = resize->GetWidth();
+						height = resize->GetHeight();
+					}
+				}
+			} listener;
+			bus.AddListener(&listener);
+
+			EventReplayer replayer(bus, loaded);
+			replayer.Register<WindowResizeEvent>();
+			replayer.ReplayUpdate(0);
+
+			CHECK(listener.width == 640);
+			CHECK(listener.height == 480);
+		}
+
+		TEST_CASE("Loading data that is not a whole event recording throws", "[Events][EventRecorder]")
+		{
+			auto data = RecordTestSession().Save();
+
+			SECTION("Truncated")
+			{
+				data.resize(data.size() - 1);
+				CHECK_THROWS_AS(EventRecording::Load(data), std::runtime_error);
+			}
+
+			SECTION("Trailing data")
+			{
+				data.push_back(std::byte{ 0 });
+				CHECK_THROWS_AS(EventRecording::Load(data), std::runtime_error);
+			}
+
+			SECTION("Wrong magic")
+			{
+				data[0] = std::byte{ 'X' };
+				CHECK_THROWS_AS(EventRecording::Load(data), std::runtime_error);
+			}
+
+			SECTION("Wrong version")
+			{
+				data[4] = std::byte{ 99 };
+				CHECK_THROWS_AS(EventRecording::Load(data), std::runtime_error);
+			}
+
+			SECTION("Empty")
+			{
+				CHECK_THROWS_AS(EventRecording::Load(std::span<const std::byte>{}), std::runtime_error);
+			}
+		}
+	}
+}
@@ -0,0 +1,102 @@
+#include <catch2/catch_test_macros.hpp>
+#include <helsinki/System/Utils/ObjectPool.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace hl
+{
+	namespace test
+	{
+		struct PooledObject
+		{
+			PooledObject(int value, int& live) : value(value), live(live) { ++live; }
+			~PooledObject() { --live; }
+
+			int value;
+			int& live;
+		};
+
+		struct alignas(64) AlignedObject
+		{
+			char data[8];
+		};
+
+		TEST_CASE("Freed slots are reused before new blocks are allocated", "[Utility][ObjectPool]")
+		{
+			PoolAllocator allocator(24, 8, 4);
+
+			std::vector<void*> slots;
+			for (int i = 0; i < 4; ++i)
+			{
+				slots.push_back(allocator.allocate());
+			}
+
+			CHECK(allocator.getStats().blockAllocations == 1);
+			CHECK(allocator.getCapacity() == 4);
+
+			auto freed = slots[2];
+			allocator.deallocate(freed);
+			CHECK(allocator.allocate() == freed);
+			CHECK(allocator.getStats().blockAllocations == 1);
+
+			allocator.allocate();
+			CHECK(allocator.getStats().blockAllocations == 2);
+			CHECK(allocator.getStats().live == 5);
+			CHECK(allocator.getStats().peak == 5);
+			CHECK(allocator.getStats().allocations == 6);
+			CHECK(allocator.getStats().deallocations == 1);
+		}
+
+		TEST_CASE("Reserving allocates every block up front", "[Utility][ObjectPool]")
+		{
+			PoolAllocator allocator(16, 16, 8);
+			allocator.reserve(20);
+
+			CHECK(allocator.getCapacity() == 24);
+			CHECK(allocator.getStats().blockAllocations == 3);
+			CHECK(allocator.getStats().reservedBytes == 24 * 16);
+
+			for (int i = 0; i < 24; ++i)
+			{
+				allocator.allocate();
+			}
+			CHECK(allocator.getStats().blockAllocations == 3);
+		}
+
+		TEST_CASE("Slots respect the requested alignment", "[Utility][ObjectPool]")
+		{
+			ObjectPool<AlignedObject> pool(3);
+
+			CHECK(sizeof(AlignedObject) == 64);
+			for (int i = 0; i < 10; ++i)
+			{
+				CHECK(reinterpret_cast<std::uintptr_t>(pool.create()) % 64 == 0);
+			}
+		}
+
+		TEST_CASE("Pooled objects are constructed and destroyed in place", "[Utility][ObjectPool]")
+		{
+			int live = 0;
+			ObjectPool<PooledObject> pool(16);
+
+			{
+				auto a = pool.make(1, live);
+				auto b = pool.make(2, live);
+
+				CHECK(live == 2);
+				CHECK(a->value == 1);
+				CHECK(b->value == 2);
+				CHECK(pool.getStats().live == 2);
+			}
+
+			CHECK(live == 0);
+			CHECK(pool.getStats().live == 0);
+
+			auto raw = pool.create(3, live);
+			CHECK(live == 1);
+			pool.destroy(raw);
+			CHECK(live == 0);
+			CHECK(pool.getStats().blockAllocations == 1);
+		}
+	}
+}
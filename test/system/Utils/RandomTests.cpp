@@ -0,0 +1,69 @@
+#include <catch2/catch_test_macros.hpp>
+#include <helsinki/System/Utils/Random.hpp>
+#include <vector>
+
+namespace hl
+{
+	namespace test
+	{
+		static std::vector<uint32_t> draw(Random& random, size_t count)
+		{
+			std::vector<uint32_t> values;
+			for (size_t i = 0; i < count; ++i)
+			{
+				values.push_back(random.next());
+			}
+			return values;
+		}
+
+		TEST_CASE("Random sequences are pinned for a seed", "[Utility][Random]")
+		{
+			// Any change to these breaks every saved checksum, whatever the platform.
+			Random random(42);
+			CHECK(draw(random, 4) == std::vector<uint32_t>{ 3270867926u, 1795671209u, 1924641435u, 1143034755u });
+		}
+
+		TEST_CASE("Random reseeding restarts the sequence", "[Utility][Random]")
+		{
+			Random first(7);
+			Random second(8);
+			const auto sequence = draw(first, 16);
+			CHECK(draw(second, 16) != sequence);
+
+			second.seed(7);
+			CHECK(second.getState() == Random(7).getState());
+			CHECK(draw(second, 16) == sequence);
+		}
+
+		TEST_CASE("Random ranges stay within their bounds", "[Utility][Random]")
+		{
+			Random random;
+			bool sawMin = false;
+			bool sawMax = false;
+			for (int i = 0; i < 10000; ++i)
+			{
+				const auto below = random.nextBelow(10);
+				CHECK(below < 10);
+
+				const auto value = random.nextInt(-3, 3);
+				CHECK(value >= -3);
+				CHECK(value <= 3);
+				sawMin |= value == -3;
+				sawMax |= value == 3;
+
+				const auto unit = random.nextFloat();
+				CHECK(unit >= 0.0f);
+				CHECK(unit < 1.0f);
+
+				const auto ranged = random.nextFloat(5.0f, 6.0f);
+				CHECK(ranged >= 5.0f);
+				CHECK(ranged < 6.0f);
+			}
+
+			CHECK(sawMin);
+			CHECK(sawMax);
+			CHECK(random.nextBelow(0) == 0);
+			CHECK(random.nextInt(4, 4) == 4);
+		}
+	}
+}
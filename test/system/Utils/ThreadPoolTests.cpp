@@ -0,0 +1,51 @@
+#include <catch2/catch_test_macros.hpp>
+#include <helsinki/System/Utils/ThreadPool.hpp>
+#include <atomic>
+
+namespace hl
+{
+	namespace test
+	{
+		TEST_CASE("Thread pool runs every submitted task", "[Utility][ThreadPool]")
+		{
+			ThreadPool pool(4);
+
+			std::atomic<int> count{ 0 };
+			for (int i = 0; i < 1000; ++i)
+			{
+				pool.submit([&count]() { count++; });
+			}
+
+			while (count.load() < 1000)
+			{
+				pool.tryRunTask();
+			}
+
+			CHECK(count.load() == 1000);
+		}
+
+		TEST_CASE("Tasks submitted from a worker are run", "[Utility][ThreadPool]")
+		{
+			ThreadPool pool(2);
+
+			std::atomic<int> count{ 0 };
+			for (int i = 0; i < 10; ++i)
+			{
+				pool.submit([&pool, &count]()
+					{
+						for (int j = 0; j < 10; ++j)
+						{
+							pool.submit([&count]() { count++; });
+						}
+					});
+			}
+
+			while (count.load() < 100)
+			{
+				pool.tryRunTask();
+			}
+
+			CHECK(count.load() == 100);
+		}
+	}
+}
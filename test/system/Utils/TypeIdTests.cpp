@@ -0,0 +1,26 @@
+#include <catch2/catch_test_macros.hpp>
+#include <helsinki/System/Utils/TypeId.hpp>
+#include <vector>
+
+namespace hl
+{
+	namespace test
+	{
+		struct TypeIdSample {};
+		template<typename T> struct TypeIdWrapper {};
+
+		TEST_CASE("Type names are resolved at compile time", "[Utility][TypeId]")
+		{
+			STATIC_REQUIRE(TypeId::Name<TypeIdSample>().ends_with("TypeIdSample"));
+			STATIC_REQUIRE(TypeId::Name<TypeIdWrapper<TypeIdSample>>().find("TypeIdWrapper<") != std::string_view::npos);
+		}
+
+		TEST_CASE("Type ids are the hash of the type name", "[Utility][TypeId]")
+		{
+			STATIC_REQUIRE(TypeId::Get<TypeIdSample>() == String::fnv1a_64(TypeId::Name<TypeIdSample>()));
+			STATIC_REQUIRE(TypeId::Get<TypeIdSample>() != TypeId::Get<TypeIdWrapper<TypeIdSample>>());
+			STATIC_REQUIRE(TypeId::Get<int>() != TypeId::Get<unsigned int>());
+			STATIC_REQUIRE(TypeId::Get<std::vector<int>>() != TypeId::Get<std::vector<float>>());
+		}
+	}
+}